@@ -0,0 +1,83 @@
+/*-
+ * Copyright (c) 2014 Darran Hunt (darran [at] hunt dot net dot nz)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Count with an oledField and report, over the serial port, how many
+ * glyphs each tick redrew and how long it took. A counter in a fixed
+ * width font should redraw about one glyph per tick.
+ */
+
+#include <SPI.h>
+#include <oled256.h>
+#include <oledField.h>
+
+oled256 lcd(10, 9, 8);	// cs, dc, reset
+
+/**
+ * Run a counter for 100 ticks and print the glyphs and time per tick.
+ * @param name - name of the font, for the report
+ * @param align - OLED_ALIGN_LEFT or OLED_ALIGN_RIGHT
+ */
+void count(const char *name, uint8_t align)
+{
+    oledField field(lcd, 100, 20, 80, align);
+    uint16_t glyphs = 0;
+
+    lcd.clear();
+    field.update(123456L);
+    uint32_t start = micros();
+    for (long value=123457; value<123557; value++) {
+	glyphs += field.update(value);
+	lcd.flush();
+    }
+    uint32_t elapsed = micros() - start;
+
+    Serial.print(name);
+    Serial.print((align == OLED_ALIGN_LEFT) ? F(" left: ") : F(" right: "));
+    Serial.print(glyphs / 100.0);
+    Serial.print(F(" glyphs, "));
+    Serial.print(elapsed / 100);
+    Serial.println(F(" us per tick"));
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    lcd.begin(FONT_TEN_DOT);
+    lcd.setColour(15);
+    lcd.setBackground(0);
+
+    count("ten dot", OLED_ALIGN_RIGHT);
+    count("ten dot", OLED_ALIGN_LEFT);
+
+    // HQ digits are proportional, a right aligned counter moves them all
+    lcd.setFontHQ(0);
+    count("HQ", OLED_ALIGN_RIGHT);
+    count("HQ", OLED_ALIGN_LEFT);
+}
+
+void loop()
+{
+}
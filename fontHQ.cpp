@@ -4,10 +4,10 @@
 
 font_t fontsHQ[] = {
 #ifdef FONT_CHECKBOOK_12
-    { checkbook_12, checkbook_12_asciimap, CHECKBOOK_12_HEIGHT },
+    { checkbook_12, checkbook_12_asciimap, CHECKBOOK_12_HEIGHT, 1, NULL, 0, '?' },
 #endif
 #ifdef FONT_CHECKBOOK_14
-    { checkbook_14, checkbook_14_asciimap, CHECKBOOK_14_HEIGHT },
+    { checkbook_14, checkbook_14_asciimap, CHECKBOOK_14_HEIGHT, 1, NULL, 0, '?' },
 #endif
 };
 
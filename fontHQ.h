@@ -1,6 +1,8 @@
 #ifndef FONTHQ_H_
 #define FONTHQ_H_
 
+#include "fonts.h"
+
 // Font selection
 #undef FONT_CHECKBOOK_12
 #define FONT_CHECKBOOK_14
@@ -18,6 +20,10 @@ typedef struct {
     const glyph_t *glyphs;
     const uint8_t *map;
     uint8_t height;
+    uint8_t packed;		// glyph rows hold two pixels per byte, left pixel in the high nibble
+    const codepoint_t *cmap;	// glyph indexes of code points beyond 0x7F, sorted by code, or NULL
+    uint8_t cmapSize;		// entries in cmap
+    char fallback;		// character drawn for those the font does not have
 } font_t;
 
 #ifdef FONT_CHECKBOOK_12
@@ -2,1086 +2,1088 @@
  * Font checkbook_12
  *
  * Allen R. Walden Friendly Fonts, free license.
+ *
+ * Glyph rows are packed two pixels per byte, left pixel in the high nibble.
  */
 
 #define CHECKBOOK_12_HEIGHT 16
 
 const uint8_t checkbook_12_0x21[] __attribute__((__progmem__)) = {   /* '!' width: 4 */
-      0,   1,   1,   0,                                     /* [    ] */
-      0,  13,  14,   0,                                     /* [ ** ] */
-      1,  15,  15,   3,                                     /* [ ** ] */
-      1,  15,  15,   3,                                     /* [ ** ] */
-      0,  15,  15,   2,                                     /* [ ** ] */
-      0,  14,  15,   0,                                     /* [ ** ] */
-      0,  12,  14,   0,                                     /* [ ** ] */
-      0,  11,  12,   0,                                     /* [ ** ] */
-      0,   9,  10,   0,                                     /* [ ** ] */
-      0,   7,   8,   0,                                     /* [ ** ] */
-      0,   5,   6,   0,                                     /* [  * ] */
-      0,   0,   0,   0,                                     /* [    ] */
-      0,  15,  15,   0,                                     /* [ ** ] */
-      0,  15,  15,   0,                                     /* [ ** ] */
+    0x01, 0x10,                                             /* [    ] */
+    0x0d, 0xe0,                                             /* [ ** ] */
+    0x1f, 0xf3,                                             /* [ ** ] */
+    0x1f, 0xf3,                                             /* [ ** ] */
+    0x0f, 0xf2,                                             /* [ ** ] */
+    0x0e, 0xf0,                                             /* [ ** ] */
+    0x0c, 0xe0,                                             /* [ ** ] */
+    0x0b, 0xc0,                                             /* [ ** ] */
+    0x09, 0xa0,                                             /* [ ** ] */
+    0x07, 0x80,                                             /* [ ** ] */
+    0x05, 0x60,                                             /* [  * ] */
+    0x00, 0x00,                                             /* [    ] */
+    0x0f, 0xf0,                                             /* [ ** ] */
+    0x0f, 0xf0,                                             /* [ ** ] */
 };
 
 const uint8_t checkbook_12_0x24[] __attribute__((__progmem__)) = {   /* '$' width: 8 */
-      0,   0,   1,   0,   1,   0,   0,                      /* [       ] */
-      0,   0,  14,   3,  13,   0,   0,                      /* [  * *  ] */
-      0,  14,  15,  15,  15,  15,  12,                      /* [ ******] */
-      0,  15,  15,   1,  15,   0,   0,                      /* [ ** *  ] */
-      0,  15,  15,   0,  15,   0,   0,                      /* [ ** *  ] */
-      0,  15,  15,   0,  15,   0,   0,                      /* [ ** *  ] */
-      0,  15,  15,   0,  15,   0,   0,                      /* [ ** *  ] */
-      0,  15,  15,  13,  15,  13,  10,                      /* [ ******] */
-      0,  11,  15,  12,  15,  14,  15,                      /* [ ******] */
-      0,   0,  14,   0,  15,   0,  15,                      /* [  * * *] */
-      0,   0,  14,   0,  15,   0,  15,                      /* [  * * *] */
-      0,   0,  14,   0,  15,   0,  15,                      /* [  * * *] */
-      0,   0,  14,   1,  15,   3,  15,                      /* [  * * *] */
-      0,  13,  15,  15,  15,  15,  14,                      /* [ ******] */
-      0,   0,  14,   2,  14,   1,   0,                      /* [  * *  ] */
-      0,   0,   1,   0,   1,   0,   0,                      /* [       ] */
+    0x00, 0x10, 0x10, 0x00,                                 /* [       ] */
+    0x00, 0xe3, 0xd0, 0x00,                                 /* [  * *  ] */
+    0x0e, 0xff, 0xff, 0xc0,                                 /* [ ******] */
+    0x0f, 0xf1, 0xf0, 0x00,                                 /* [ ** *  ] */
+    0x0f, 0xf0, 0xf0, 0x00,                                 /* [ ** *  ] */
+    0x0f, 0xf0, 0xf0, 0x00,                                 /* [ ** *  ] */
+    0x0f, 0xf0, 0xf0, 0x00,                                 /* [ ** *  ] */
+    0x0f, 0xfd, 0xfd, 0xa0,                                 /* [ ******] */
+    0x0b, 0xfc, 0xfe, 0xf0,                                 /* [ ******] */
+    0x00, 0xe0, 0xf0, 0xf0,                                 /* [  * * *] */
+    0x00, 0xe0, 0xf0, 0xf0,                                 /* [  * * *] */
+    0x00, 0xe0, 0xf0, 0xf0,                                 /* [  * * *] */
+    0x00, 0xe1, 0xf3, 0xf0,                                 /* [  * * *] */
+    0x0d, 0xff, 0xff, 0xe0,                                 /* [ ******] */
+    0x00, 0xe2, 0xe1, 0x00,                                 /* [  * *  ] */
+    0x00, 0x10, 0x10, 0x00,                                 /* [       ] */
 };
 
 const uint8_t checkbook_12_0x25[] __attribute__((__progmem__)) = {   /* '%' width: 10 */
-     14,  15,  15,  14,   0,   0,   0,   4,   8,            /* [****    *] */
-     15,   0,   0,   8,   0,   0,   0,  13,   5,            /* [*  *   * ] */
-     15,   0,   0,  14,   0,   0,   8,  12,   0,            /* [*  *  ** ] */
-     15,   0,   0,  15,   0,   2,  15,   2,   0,            /* [*  *  *  ] */
-     14,  15,  15,  13,   0,  11,   8,   0,   0,            /* [**** **  ] */
-      0,   0,   0,   0,   5,  14,   0,   0,   0,            /* [     *   ] */
-      0,   0,   0,   0,  14,   5,   0,   0,   0,            /* [    *    ] */
-      0,   0,   0,   8,  11,  13,  15,  15,  14,            /* [   ******] */
-      0,   0,   2,  15,   2,  15,   1,   0,   9,            /* [   * *  *] */
-      0,   0,  11,   8,   0,  15,   0,   0,  11,            /* [  ** *  *] */
-      0,   5,  14,   0,   0,  15,   0,   0,  15,            /* [  *  *  *] */
-      0,  14,   5,   0,   0,  15,   0,   0,  15,            /* [ *   *  *] */
-      2,   9,   0,   0,   0,  14,  15,  15,  13,            /* [ *   ****] */
+    0xef, 0xfe, 0x00, 0x04, 0x80,                           /* [****    *] */
+    0xf0, 0x08, 0x00, 0x0d, 0x50,                           /* [*  *   * ] */
+    0xf0, 0x0e, 0x00, 0x8c, 0x00,                           /* [*  *  ** ] */
+    0xf0, 0x0f, 0x02, 0xf2, 0x00,                           /* [*  *  *  ] */
+    0xef, 0xfd, 0x0b, 0x80, 0x00,                           /* [**** **  ] */
+    0x00, 0x00, 0x5e, 0x00, 0x00,                           /* [     *   ] */
+    0x00, 0x00, 0xe5, 0x00, 0x00,                           /* [    *    ] */
+    0x00, 0x08, 0xbd, 0xff, 0xe0,                           /* [   ******] */
+    0x00, 0x2f, 0x2f, 0x10, 0x90,                           /* [   * *  *] */
+    0x00, 0xb8, 0x0f, 0x00, 0xb0,                           /* [  ** *  *] */
+    0x05, 0xe0, 0x0f, 0x00, 0xf0,                           /* [  *  *  *] */
+    0x0e, 0x50, 0x0f, 0x00, 0xf0,                           /* [ *   *  *] */
+    0x29, 0x00, 0x0e, 0xff, 0xd0,                           /* [ *   ****] */
 };
 
 const uint8_t checkbook_12_0x26[] __attribute__((__progmem__)) = {   /* '&' width: 10 */
-      6,  15,  15,  15,  15,  15,  14,   0,                 /* [******* ] */
-      7,   3,   0,   0,   0,   3,  15,   0,                 /* [*     * ] */
-      7,   0,   0,   0,   0,   0,  15,   0,                 /* [*     * ] */
-      7,   0,   0,   0,   0,   0,  15,   0,                 /* [*     * ] */
-      7,   1,   0,   0,   0,   0,  15,   0,                 /* [*     * ] */
-      7,   9,   0,   0,   0,   5,  15,   0,                 /* [**    * ] */
-     11,  15,  15,  15,  15,  15,  14,   0,                 /* [******* ] */
-     15,   8,  15,   3,   0,   0,   0,   0,                 /* [***     ] */
-     15,   0,   7,  13,   1,   0,   0,   0,                 /* [* **    ] */
-     15,   0,   0,  10,  11,   0,   1,   0,                 /* [*  **   ] */
-     15,   0,   0,   0,  12,  11,  14,   0,                 /* [*   *** ] */
-     15,   0,   0,   0,   1,  15,  15,   0,                 /* [*    ** ] */
-     15,  15,  15,  15,  15,  15,  15,   0,                 /* [******* ] */
-      0,   0,   0,   0,   0,   0,  12,   3,                 /* [      * ] */
-      0,   0,   0,   0,   0,   0,   0,   0,                 /* [        ] */
+    0x6f, 0xff, 0xff, 0xe0,                                 /* [******* ] */
+    0x73, 0x00, 0x03, 0xf0,                                 /* [*     * ] */
+    0x70, 0x00, 0x00, 0xf0,                                 /* [*     * ] */
+    0x70, 0x00, 0x00, 0xf0,                                 /* [*     * ] */
+    0x71, 0x00, 0x00, 0xf0,                                 /* [*     * ] */
+    0x79, 0x00, 0x05, 0xf0,                                 /* [**    * ] */
+    0xbf, 0xff, 0xff, 0xe0,                                 /* [******* ] */
+    0xf8, 0xf3, 0x00, 0x00,                                 /* [***     ] */
+    0xf0, 0x7d, 0x10, 0x00,                                 /* [* **    ] */
+    0xf0, 0x0a, 0xb0, 0x10,                                 /* [*  **   ] */
+    0xf0, 0x00, 0xcb, 0xe0,                                 /* [*   *** ] */
+    0xf0, 0x00, 0x1f, 0xf0,                                 /* [*    ** ] */
+    0xff, 0xff, 0xff, 0xf0,                                 /* [******* ] */
+    0x00, 0x00, 0x00, 0xc3,                                 /* [      * ] */
+    0x00, 0x00, 0x00, 0x00,                                 /* [        ] */
 };
 
 const uint8_t checkbook_12_0x27[] __attribute__((__progmem__)) = {   /* ''' width: 3 */
-      0,                                                    /* [ ] */
-      0,                                                    /* [ ] */
-      0,                                                    /* [ ] */
-      0,                                                    /* [ ] */
-      0,                                                    /* [ ] */
+    0x00,                                                   /* [ ] */
+    0x00,                                                   /* [ ] */
+    0x00,                                                   /* [ ] */
+    0x00,                                                   /* [ ] */
+    0x00,                                                   /* [ ] */
 };
 
 const uint8_t checkbook_12_0x28[] __attribute__((__progmem__)) = {   /* '(' width: 5 */
-      0,   0,   0,                                          /* [   ] */
-      0,   5,   4,                                          /* [   ] */
-      0,  12,   0,                                          /* [ * ] */
-      4,   9,   0,                                          /* [ * ] */
-      9,   5,   0,                                          /* [*  ] */
-     11,   4,   0,                                          /* [*  ] */
-     13,   2,   0,                                          /* [*  ] */
-     15,   0,   0,                                          /* [*  ] */
-     14,   1,   0,                                          /* [*  ] */
-     12,   2,   0,                                          /* [*  ] */
-     10,   3,   0,                                          /* [*  ] */
-      8,   5,   0,                                          /* [*  ] */
-      4,   8,   0,                                          /* [ * ] */
-      0,   9,   0,                                          /* [ * ] */
-      0,   3,   2,                                          /* [   ] */
+    0x00, 0x00,                                             /* [   ] */
+    0x05, 0x40,                                             /* [   ] */
+    0x0c, 0x00,                                             /* [ * ] */
+    0x49, 0x00,                                             /* [ * ] */
+    0x95, 0x00,                                             /* [*  ] */
+    0xb4, 0x00,                                             /* [*  ] */
+    0xd2, 0x00,                                             /* [*  ] */
+    0xf0, 0x00,                                             /* [*  ] */
+    0xe1, 0x00,                                             /* [*  ] */
+    0xc2, 0x00,                                             /* [*  ] */
+    0xa3, 0x00,                                             /* [*  ] */
+    0x85, 0x00,                                             /* [*  ] */
+    0x48, 0x00,                                             /* [ * ] */
+    0x09, 0x00,                                             /* [ * ] */
+    0x03, 0x20,                                             /* [   ] */
 };
 
 const uint8_t checkbook_12_0x29[] __attribute__((__progmem__)) = {   /* ')' width: 5 */
-      1,   0,   0,   0,                                     /* [    ] */
-      2,  10,   0,   0,                                     /* [ *  ] */
-      0,   8,   6,   0,                                     /* [ ** ] */
-      0,   0,  13,   1,                                     /* [  * ] */
-      0,   0,   9,   6,                                     /* [  **] */
-      0,   0,   6,   9,                                     /* [  **] */
-      0,   0,   3,  12,                                     /* [   *] */
-      0,   0,   1,  15,                                     /* [   *] */
-      0,   0,   2,  13,                                     /* [   *] */
-      0,   0,   4,  10,                                     /* [   *] */
-      0,   0,   7,   7,                                     /* [  **] */
-      0,   0,  10,   4,                                     /* [  * ] */
-      0,   0,  12,   0,                                     /* [  * ] */
-      0,   5,   4,   0,                                     /* [    ] */
-      1,   5,   0,   0,                                     /* [    ] */
+    0x10, 0x00,                                             /* [    ] */
+    0x2a, 0x00,                                             /* [ *  ] */
+    0x08, 0x60,                                             /* [ ** ] */
+    0x00, 0xd1,                                             /* [  * ] */
+    0x00, 0x96,                                             /* [  **] */
+    0x00, 0x69,                                             /* [  **] */
+    0x00, 0x3c,                                             /* [   *] */
+    0x00, 0x1f,                                             /* [   *] */
+    0x00, 0x2d,                                             /* [   *] */
+    0x00, 0x4a,                                             /* [   *] */
+    0x00, 0x77,                                             /* [  **] */
+    0x00, 0xa4,                                             /* [  * ] */
+    0x00, 0xc0,                                             /* [  * ] */
+    0x05, 0x40,                                             /* [    ] */
+    0x15, 0x00,                                             /* [    ] */
 };
 
 const uint8_t checkbook_12_0x2a[] __attribute__((__progmem__)) = {   /* '*' width: 5 */
-      0,   3,   0,                                          /* [   ] */
-      3,  15,   2,                                          /* [ * ] */
-     14,  15,  14,                                          /* [***] */
-      7,  15,   7,                                          /* [***] */
-      6,   7,   7,                                          /* [***] */
+    0x03, 0x00,                                             /* [   ] */
+    0x3f, 0x20,                                             /* [ * ] */
+    0xef, 0xe0,                                             /* [***] */
+    0x7f, 0x70,                                             /* [***] */
+    0x67, 0x70,                                             /* [***] */
 };
 
 const uint8_t checkbook_12_0x2c[] __attribute__((__progmem__)) = {   /* ',' width: 4 */
-     14,  14,                                               /* [**] */
-     15,  15,                                               /* [**] */
-     15,  15,                                               /* [**] */
-      4,  13,                                               /* [ *] */
-      9,   9,                                               /* [**] */
-      5,   0,                                               /* [  ] */
+    0xee,                                                   /* [**] */
+    0xff,                                                   /* [**] */
+    0xff,                                                   /* [**] */
+    0x4d,                                                   /* [ *] */
+    0x99,                                                   /* [**] */
+    0x50,                                                   /* [  ] */
 };
 
 const uint8_t checkbook_12_0x2e[] __attribute__((__progmem__)) = {   /* '.' width: 4 */
-     15,  15,                                               /* [**] */
-     15,  15,                                               /* [**] */
+    0xff,                                                   /* [**] */
+    0xff,                                                   /* [**] */
 };
 
 const uint8_t checkbook_12_0x2f[] __attribute__((__progmem__)) = {   /* '/' width: 9 */
-      0,   0,   0,   0,   0,   0,   1,                      /* [       ] */
-      0,   0,   0,   0,   0,   1,  13,                      /* [      *] */
-      0,   0,   0,   0,   0,   9,   6,                      /* [     **] */
-      0,   0,   0,   0,   1,  13,   0,                      /* [     * ] */
-      0,   0,   0,   0,   9,   6,   0,                      /* [    ** ] */
-      0,   0,   0,   1,  13,   0,   0,                      /* [    *  ] */
-      0,   0,   0,   9,   6,   0,   0,                      /* [   **  ] */
-      0,   0,   1,  13,   0,   0,   0,                      /* [   *   ] */
-      0,   0,   9,   6,   0,   0,   0,                      /* [  **   ] */
-      0,   2,  13,   0,   0,   0,   0,                      /* [  *    ] */
-      0,   9,   6,   0,   0,   0,   0,                      /* [ **    ] */
-      2,  13,   0,   0,   0,   0,   0,                      /* [ *     ] */
-      9,   6,   0,   0,   0,   0,   0,                      /* [**     ] */
-     10,   0,   0,   0,   0,   0,   0,                      /* [*      ] */
+    0x00, 0x00, 0x00, 0x10,                                 /* [       ] */
+    0x00, 0x00, 0x01, 0xd0,                                 /* [      *] */
+    0x00, 0x00, 0x09, 0x60,                                 /* [     **] */
+    0x00, 0x00, 0x1d, 0x00,                                 /* [     * ] */
+    0x00, 0x00, 0x96, 0x00,                                 /* [    ** ] */
+    0x00, 0x01, 0xd0, 0x00,                                 /* [    *  ] */
+    0x00, 0x09, 0x60, 0x00,                                 /* [   **  ] */
+    0x00, 0x1d, 0x00, 0x00,                                 /* [   *   ] */
+    0x00, 0x96, 0x00, 0x00,                                 /* [  **   ] */
+    0x02, 0xd0, 0x00, 0x00,                                 /* [  *    ] */
+    0x09, 0x60, 0x00, 0x00,                                 /* [ **    ] */
+    0x2d, 0x00, 0x00, 0x00,                                 /* [ *     ] */
+    0x96, 0x00, 0x00, 0x00,                                 /* [**     ] */
+    0xa0, 0x00, 0x00, 0x00,                                 /* [*      ] */
 };
 
 const uint8_t checkbook_12_0x30[] __attribute__((__progmem__)) = {   /* '0' width: 11 */
-      1,  10,  15,  15,  15,  15,  15,  14,   4,            /* [ ******* ] */
-     11,   7,   0,   0,   0,   0,   1,   9,  11,            /* [**     **] */
-     15,   0,   0,   0,   0,   0,   0,   0,  15,            /* [*       *] */
-     15,   0,   0,   0,   0,   0,   0,   0,  15,            /* [*       *] */
-     15,   0,   0,   0,   0,   0,   0,   0,  15,            /* [*       *] */
-     15,   0,   0,   0,   0,   0,   0,   0,  15,            /* [*       *] */
-     15,   0,   0,   0,   0,   0,   0,   0,  15,            /* [*       *] */
-     15,   0,   0,  15,  15,   0,   0,   0,  15,            /* [*  **   *] */
-     15,   0,   0,  15,  15,   0,   0,   0,  15,            /* [*  **   *] */
-     15,   0,   0,   0,   0,   0,   0,   0,  15,            /* [*       *] */
-     15,   1,   0,   0,   0,   0,   0,   0,  14,            /* [*       *] */
-     11,   9,   0,   0,   0,   0,   2,  11,  10,            /* [**     **] */
-      4,  14,  15,  15,  15,  15,  15,  10,   1,            /* [ ******* ] */
+    0x1a, 0xff, 0xff, 0xfe, 0x40,                           /* [ ******* ] */
+    0xb7, 0x00, 0x00, 0x19, 0xb0,                           /* [**     **] */
+    0xf0, 0x00, 0x00, 0x00, 0xf0,                           /* [*       *] */
+    0xf0, 0x00, 0x00, 0x00, 0xf0,                           /* [*       *] */
+    0xf0, 0x00, 0x00, 0x00, 0xf0,                           /* [*       *] */
+    0xf0, 0x00, 0x00, 0x00, 0xf0,                           /* [*       *] */
+    0xf0, 0x00, 0x00, 0x00, 0xf0,                           /* [*       *] */
+    0xf0, 0x0f, 0xf0, 0x00, 0xf0,                           /* [*  **   *] */
+    0xf0, 0x0f, 0xf0, 0x00, 0xf0,                           /* [*  **   *] */
+    0xf0, 0x00, 0x00, 0x00, 0xf0,                           /* [*       *] */
+    0xf1, 0x00, 0x00, 0x00, 0xe0,                           /* [*       *] */
+    0xb9, 0x00, 0x00, 0x2b, 0xa0,                           /* [**     **] */
+    0x4e, 0xff, 0xff, 0xfa, 0x10,                           /* [ ******* ] */
 };
 
 const uint8_t checkbook_12_0x31[] __attribute__((__progmem__)) = {   /* '1' width: 7 */
-      0,   5,   4,   0,   0,   0,   0,                      /* [       ] */
-      5,  15,  15,   0,   0,   0,   0,                      /* [ **    ] */
-      3,  14,  15,   0,   0,   0,   0,                      /* [ **    ] */
-      0,   1,  15,   0,   0,   0,   0,                      /* [  *    ] */
-      0,   0,  15,   0,   0,   0,   0,                      /* [  *    ] */
-      0,   0,  15,   0,   0,   0,   0,                      /* [  *    ] */
-      0,   0,  15,   0,   0,   0,   0,                      /* [  *    ] */
-      0,   2,  15,   2,   0,   0,   0,                      /* [  *    ] */
-      4,  15,  15,  15,  15,  15,   4,                      /* [ ***** ] */
-      7,  15,  15,  15,  15,  15,   7,                      /* [*******] */
-      7,  15,  15,  15,  15,  15,   7,                      /* [*******] */
-      7,  15,  15,  15,  15,  15,   7,                      /* [*******] */
-      7,  15,  15,  15,  15,  15,   7,                      /* [*******] */
-      5,  15,  15,  15,  15,  15,   5,                      /* [ ***** ] */
+    0x05, 0x40, 0x00, 0x00,                                 /* [       ] */
+    0x5f, 0xf0, 0x00, 0x00,                                 /* [ **    ] */
+    0x3e, 0xf0, 0x00, 0x00,                                 /* [ **    ] */
+    0x01, 0xf0, 0x00, 0x00,                                 /* [  *    ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *    ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *    ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *    ] */
+    0x02, 0xf2, 0x00, 0x00,                                 /* [  *    ] */
+    0x4f, 0xff, 0xff, 0x40,                                 /* [ ***** ] */
+    0x7f, 0xff, 0xff, 0x70,                                 /* [*******] */
+    0x7f, 0xff, 0xff, 0x70,                                 /* [*******] */
+    0x7f, 0xff, 0xff, 0x70,                                 /* [*******] */
+    0x7f, 0xff, 0xff, 0x70,                                 /* [*******] */
+    0x5f, 0xff, 0xff, 0x50,                                 /* [ ***** ] */
 };
 
 const uint8_t checkbook_12_0x32[] __attribute__((__progmem__)) = {   /* '2' width: 7 */
-     11,  15,  15,  15,  15,                                /* [*****] */
-      0,   0,   0,   1,  15,                                /* [    *] */
-      0,   0,   0,   0,  15,                                /* [    *] */
-      0,   0,   0,   0,  15,                                /* [    *] */
-      0,   0,   0,   0,  15,                                /* [    *] */
-      0,   0,   0,   1,  15,                                /* [    *] */
-     14,  15,  15,  15,  14,                                /* [*****] */
-     15,   2,   0,   0,   0,                                /* [*    ] */
-     15,   0,   0,   0,   0,                                /* [*    ] */
-     15,   0,   0,   0,   0,                                /* [*    ] */
-     15,   0,   0,   0,   0,                                /* [*    ] */
-     15,   1,   0,   0,   0,                                /* [*    ] */
-     14,  15,  15,  15,  11,                                /* [*****] */
+    0xbf, 0xff, 0xf0,                                       /* [*****] */
+    0x00, 0x01, 0xf0,                                       /* [    *] */
+    0x00, 0x00, 0xf0,                                       /* [    *] */
+    0x00, 0x00, 0xf0,                                       /* [    *] */
+    0x00, 0x00, 0xf0,                                       /* [    *] */
+    0x00, 0x01, 0xf0,                                       /* [    *] */
+    0xef, 0xff, 0xe0,                                       /* [*****] */
+    0xf2, 0x00, 0x00,                                       /* [*    ] */
+    0xf0, 0x00, 0x00,                                       /* [*    ] */
+    0xf0, 0x00, 0x00,                                       /* [*    ] */
+    0xf0, 0x00, 0x00,                                       /* [*    ] */
+    0xf1, 0x00, 0x00,                                       /* [*    ] */
+    0xef, 0xff, 0xb0,                                       /* [*****] */
 };
 
 const uint8_t checkbook_12_0x33[] __attribute__((__progmem__)) = {   /* '3' width: 8 */
-      2,  14,  15,  15,  15,  15,  14,   0,   0,            /* [ ******  ] */
-      0,   0,   0,   0,   0,   2,  15,   0,   0,            /* [      *  ] */
-      0,   0,   0,   0,   0,   0,  15,   0,   0,            /* [      *  ] */
-      0,   0,   0,   0,   0,   0,  15,   0,   0,            /* [      *  ] */
-      0,   0,   0,   0,   0,   0,  15,   0,   0,            /* [      *  ] */
-      0,   0,   0,   0,   0,   2,  15,   0,   0,            /* [      *  ] */
-      3,  14,  15,  15,  15,  15,  15,  11,   2,            /* [ ******* ] */
-      0,   0,   0,   0,   0,   2,  15,  15,   7,            /* [      ***] */
-      0,   0,   0,   0,   0,   0,  15,  15,   7,            /* [      ***] */
-      0,   0,   0,   0,   0,   0,  15,  15,   7,            /* [      ***] */
-      0,   0,   0,   0,   0,   0,  15,  15,   7,            /* [      ***] */
-      0,   0,   0,   0,   0,   3,  15,  15,   7,            /* [      ***] */
-      3,  15,  15,  15,  15,  15,  15,  15,   5,            /* [ ******* ] */
+    0x2e, 0xff, 0xff, 0xe0, 0x00,                           /* [ ******  ] */
+    0x00, 0x00, 0x02, 0xf0, 0x00,                           /* [      *  ] */
+    0x00, 0x00, 0x00, 0xf0, 0x00,                           /* [      *  ] */
+    0x00, 0x00, 0x00, 0xf0, 0x00,                           /* [      *  ] */
+    0x00, 0x00, 0x00, 0xf0, 0x00,                           /* [      *  ] */
+    0x00, 0x00, 0x02, 0xf0, 0x00,                           /* [      *  ] */
+    0x3e, 0xff, 0xff, 0xfb, 0x20,                           /* [ ******* ] */
+    0x00, 0x00, 0x02, 0xff, 0x70,                           /* [      ***] */
+    0x00, 0x00, 0x00, 0xff, 0x70,                           /* [      ***] */
+    0x00, 0x00, 0x00, 0xff, 0x70,                           /* [      ***] */
+    0x00, 0x00, 0x00, 0xff, 0x70,                           /* [      ***] */
+    0x00, 0x00, 0x03, 0xff, 0x70,                           /* [      ***] */
+    0x3f, 0xff, 0xff, 0xff, 0x50,                           /* [ ******* ] */
 };
 
 const uint8_t checkbook_12_0x34[] __attribute__((__progmem__)) = {   /* '4' width: 10 */
-      0,   3,   3,   0,   0,   0,   0,   0,                 /* [        ] */
-      0,  15,  15,   0,   0,   0,   0,   0,                 /* [ **     ] */
-      0,  15,  15,   0,   0,   0,   0,   0,                 /* [ **     ] */
-      0,  15,  15,   0,   0,   0,   0,   0,                 /* [ **     ] */
-      0,  15,  15,   0,   0,   0,   0,   0,                 /* [ **     ] */
-      0,  15,  15,   0,   0,   0,   0,   0,                 /* [ **     ] */
-      0,  15,  15,   0,   0,   0,   0,   0,                 /* [ **     ] */
-      0,  15,  15,   0,   0,   0,   0,   0,                 /* [ **     ] */
-      0,  15,  15,   0,   0,   0,   5,   5,                 /* [ **     ] */
-      0,  15,  15,   2,   0,   1,  15,  15,                 /* [ **   **] */
-      0,  15,  15,  15,  15,  15,  15,  15,                 /* [ *******] */
-      0,   0,   0,   0,   0,   1,  15,  15,                 /* [      **] */
-      0,   0,   0,   0,   0,   0,  15,  15,                 /* [      **] */
-      0,   0,   0,   0,   0,   0,  14,  14,                 /* [      **] */
+    0x03, 0x30, 0x00, 0x00,                                 /* [        ] */
+    0x0f, 0xf0, 0x00, 0x00,                                 /* [ **     ] */
+    0x0f, 0xf0, 0x00, 0x00,                                 /* [ **     ] */
+    0x0f, 0xf0, 0x00, 0x00,                                 /* [ **     ] */
+    0x0f, 0xf0, 0x00, 0x00,                                 /* [ **     ] */
+    0x0f, 0xf0, 0x00, 0x00,                                 /* [ **     ] */
+    0x0f, 0xf0, 0x00, 0x00,                                 /* [ **     ] */
+    0x0f, 0xf0, 0x00, 0x00,                                 /* [ **     ] */
+    0x0f, 0xf0, 0x00, 0x55,                                 /* [ **     ] */
+    0x0f, 0xf2, 0x01, 0xff,                                 /* [ **   **] */
+    0x0f, 0xff, 0xff, 0xff,                                 /* [ *******] */
+    0x00, 0x00, 0x01, 0xff,                                 /* [      **] */
+    0x00, 0x00, 0x00, 0xff,                                 /* [      **] */
+    0x00, 0x00, 0x00, 0xee,                                 /* [      **] */
 };
 
 const uint8_t checkbook_12_0x35[] __attribute__((__progmem__)) = {   /* '5' width: 8 */
-      0,  13,  15,  15,  15,  15,  12,                      /* [ ******] */
-      0,  15,   4,   0,   0,   0,   0,                      /* [ *     ] */
-      0,  15,   0,   0,   0,   0,   0,                      /* [ *     ] */
-      0,  15,   0,   0,   0,   0,   0,                      /* [ *     ] */
-      0,  15,   0,   0,   0,   0,   0,                      /* [ *     ] */
-      0,  15,   2,   0,   0,   0,   0,                      /* [ *     ] */
-      0,  14,  15,  15,  15,  15,  12,                      /* [ ******] */
-      0,   0,   0,   0,   0,   2,  15,                      /* [      *] */
-      0,   0,   0,   0,   0,   0,  15,                      /* [      *] */
-      0,   0,   0,   0,   0,   0,  15,                      /* [      *] */
-      0,   0,   0,   0,   0,   0,  15,                      /* [      *] */
-      0,   0,   0,   0,   0,   2,  15,                      /* [      *] */
-      0,  13,  15,  15,  15,  15,  15,                      /* [ ******] */
+    0x0d, 0xff, 0xff, 0xc0,                                 /* [ ******] */
+    0x0f, 0x40, 0x00, 0x00,                                 /* [ *     ] */
+    0x0f, 0x00, 0x00, 0x00,                                 /* [ *     ] */
+    0x0f, 0x00, 0x00, 0x00,                                 /* [ *     ] */
+    0x0f, 0x00, 0x00, 0x00,                                 /* [ *     ] */
+    0x0f, 0x20, 0x00, 0x00,                                 /* [ *     ] */
+    0x0e, 0xff, 0xff, 0xc0,                                 /* [ ******] */
+    0x00, 0x00, 0x02, 0xf0,                                 /* [      *] */
+    0x00, 0x00, 0x00, 0xf0,                                 /* [      *] */
+    0x00, 0x00, 0x00, 0xf0,                                 /* [      *] */
+    0x00, 0x00, 0x00, 0xf0,                                 /* [      *] */
+    0x00, 0x00, 0x02, 0xf0,                                 /* [      *] */
+    0x0d, 0xff, 0xff, 0xf0,                                 /* [ ******] */
 };
 
 const uint8_t checkbook_12_0x36[] __attribute__((__progmem__)) = {   /* '6' width: 10 */
-     14,  15,  15,  15,  15,  11,   0,   0,                 /* [******  ] */
-     15,   2,   0,   1,  15,  15,   0,   0,                 /* [*   **  ] */
-     15,   0,   0,   0,  12,  13,   0,   0,                 /* [*   **  ] */
-     15,   0,   0,   0,   0,   0,   0,   0,                 /* [*       ] */
-     15,   0,   0,   0,   0,   0,   0,   0,                 /* [*       ] */
-     15,   0,   0,   0,   0,   0,   0,   0,                 /* [*       ] */
-     15,   2,   0,   0,   0,   0,   0,   0,                 /* [*       ] */
-     15,  15,  15,  15,  15,  15,  15,  14,                 /* [********] */
-     15,   2,   0,   0,   0,   0,   2,  15,                 /* [*      *] */
-     15,   0,   0,   0,   0,   0,   0,  15,                 /* [*      *] */
-     15,   0,   0,   0,   0,   0,   0,  15,                 /* [*      *] */
-     15,   2,   0,   0,   0,   0,   3,  15,                 /* [*      *] */
-     14,  15,  15,  15,  15,  15,  15,  14,                 /* [********] */
+    0xef, 0xff, 0xfb, 0x00,                                 /* [******  ] */
+    0xf2, 0x01, 0xff, 0x00,                                 /* [*   **  ] */
+    0xf0, 0x00, 0xcd, 0x00,                                 /* [*   **  ] */
+    0xf0, 0x00, 0x00, 0x00,                                 /* [*       ] */
+    0xf0, 0x00, 0x00, 0x00,                                 /* [*       ] */
+    0xf0, 0x00, 0x00, 0x00,                                 /* [*       ] */
+    0xf2, 0x00, 0x00, 0x00,                                 /* [*       ] */
+    0xff, 0xff, 0xff, 0xfe,                                 /* [********] */
+    0xf2, 0x00, 0x00, 0x2f,                                 /* [*      *] */
+    0xf0, 0x00, 0x00, 0x0f,                                 /* [*      *] */
+    0xf0, 0x00, 0x00, 0x0f,                                 /* [*      *] */
+    0xf2, 0x00, 0x00, 0x3f,                                 /* [*      *] */
+    0xef, 0xff, 0xff, 0xfe,                                 /* [********] */
 };
 
 const uint8_t checkbook_12_0x37[] __attribute__((__progmem__)) = {   /* '7' width: 9 */
-     14,  15,  15,  15,  15,  15,  14,                      /* [*******] */
-     15,   3,   0,   0,   0,   2,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     14,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-      1,   0,   0,   0,   2,   9,  15,                      /* [     **] */
-      0,   0,   0,   9,  15,  15,  14,                      /* [   ****] */
-      0,   0,   0,  15,  12,   6,   0,                      /* [   *** ] */
-      0,   0,   0,  15,   0,   0,   0,                      /* [   *   ] */
-      0,   0,   0,  15,   0,   0,   0,                      /* [   *   ] */
-      0,   0,   0,  15,   0,   0,   0,                      /* [   *   ] */
-      0,   0,   0,  15,   0,   0,   0,                      /* [   *   ] */
-      0,   0,   0,  15,   0,   0,   0,                      /* [   *   ] */
-      0,   0,   0,  12,   0,   0,   0,                      /* [   *   ] */
+    0xef, 0xff, 0xff, 0xe0,                                 /* [*******] */
+    0xf3, 0x00, 0x02, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xe0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0x10, 0x00, 0x29, 0xf0,                                 /* [     **] */
+    0x00, 0x09, 0xff, 0xe0,                                 /* [   ****] */
+    0x00, 0x0f, 0xc6, 0x00,                                 /* [   *** ] */
+    0x00, 0x0f, 0x00, 0x00,                                 /* [   *   ] */
+    0x00, 0x0f, 0x00, 0x00,                                 /* [   *   ] */
+    0x00, 0x0f, 0x00, 0x00,                                 /* [   *   ] */
+    0x00, 0x0f, 0x00, 0x00,                                 /* [   *   ] */
+    0x00, 0x0f, 0x00, 0x00,                                 /* [   *   ] */
+    0x00, 0x0c, 0x00, 0x00,                                 /* [   *   ] */
 };
 
 const uint8_t checkbook_12_0x38[] __attribute__((__progmem__)) = {   /* '8' width: 11 */
-      0,  11,  15,  15,  15,  15,  13,   0,   0,            /* [ ******  ] */
-      0,  15,   1,   0,   0,   1,  15,   0,   0,            /* [ *    *  ] */
-      0,  15,   0,   0,   0,   0,  15,   0,   0,            /* [ *    *  ] */
-      0,  15,   0,   0,   0,   0,  15,   0,   0,            /* [ *    *  ] */
-      0,  15,   0,   0,   0,   0,  15,   0,   0,            /* [ *    *  ] */
-      0,  15,   1,   0,   0,   1,  15,   0,   0,            /* [ *    *  ] */
-      8,  15,  15,  15,  15,  15,  15,  10,   2,            /* [******** ] */
-     15,  15,   1,   0,   0,   1,  15,  15,   6,            /* [**    ***] */
-     15,  15,   0,   0,   0,   0,  15,  15,   6,            /* [**    ***] */
-     15,  15,   0,   0,   0,   0,  15,  15,   6,            /* [**    ***] */
-     15,  15,   0,   0,   0,   0,  15,  15,   6,            /* [**    ***] */
-     15,  15,   1,   0,   0,   1,  15,  15,   6,            /* [**    ***] */
-     14,  15,  15,  15,  15,  15,  15,  15,   4,            /* [******** ] */
+    0x0b, 0xff, 0xff, 0xd0, 0x00,                           /* [ ******  ] */
+    0x0f, 0x10, 0x01, 0xf0, 0x00,                           /* [ *    *  ] */
+    0x0f, 0x00, 0x00, 0xf0, 0x00,                           /* [ *    *  ] */
+    0x0f, 0x00, 0x00, 0xf0, 0x00,                           /* [ *    *  ] */
+    0x0f, 0x00, 0x00, 0xf0, 0x00,                           /* [ *    *  ] */
+    0x0f, 0x10, 0x01, 0xf0, 0x00,                           /* [ *    *  ] */
+    0x8f, 0xff, 0xff, 0xfa, 0x20,                           /* [******** ] */
+    0xff, 0x10, 0x01, 0xff, 0x60,                           /* [**    ***] */
+    0xff, 0x00, 0x00, 0xff, 0x60,                           /* [**    ***] */
+    0xff, 0x00, 0x00, 0xff, 0x60,                           /* [**    ***] */
+    0xff, 0x00, 0x00, 0xff, 0x60,                           /* [**    ***] */
+    0xff, 0x10, 0x01, 0xff, 0x60,                           /* [**    ***] */
+    0xef, 0xff, 0xff, 0xff, 0x40,                           /* [******** ] */
 };
 
 const uint8_t checkbook_12_0x39[] __attribute__((__progmem__)) = {   /* '9' width: 10 */
-     13,  15,  15,  15,  15,  15,  15,  12,                 /* [********] */
-     15,   2,   0,   0,   0,   0,   2,  15,                 /* [*      *] */
-     15,   0,   0,   0,   0,   0,   1,  15,                 /* [*      *] */
-     15,   0,   0,   0,   0,   0,   1,  15,                 /* [*      *] */
-     15,   0,   0,   0,   0,   0,   1,  15,                 /* [*      *] */
-     15,   3,   0,   0,   0,   0,   5,  15,                 /* [*      *] */
-     12,  15,  15,  15,  15,  15,  15,  15,                 /* [********] */
-      0,   0,   0,   0,   0,   1,  15,  15,                 /* [      **] */
-      0,   0,   0,   0,   0,   0,  15,  15,                 /* [      **] */
-      0,   0,   0,   0,   0,   0,  15,  15,                 /* [      **] */
-      0,   0,   0,   0,   0,   0,  15,  15,                 /* [      **] */
-      0,   0,   0,   0,   0,   0,  15,  15,                 /* [      **] */
-      0,   0,   0,   0,   0,   0,  14,  14,                 /* [      **] */
+    0xdf, 0xff, 0xff, 0xfc,                                 /* [********] */
+    0xf2, 0x00, 0x00, 0x2f,                                 /* [*      *] */
+    0xf0, 0x00, 0x00, 0x1f,                                 /* [*      *] */
+    0xf0, 0x00, 0x00, 0x1f,                                 /* [*      *] */
+    0xf0, 0x00, 0x00, 0x1f,                                 /* [*      *] */
+    0xf3, 0x00, 0x00, 0x5f,                                 /* [*      *] */
+    0xcf, 0xff, 0xff, 0xff,                                 /* [********] */
+    0x00, 0x00, 0x01, 0xff,                                 /* [      **] */
+    0x00, 0x00, 0x00, 0xff,                                 /* [      **] */
+    0x00, 0x00, 0x00, 0xff,                                 /* [      **] */
+    0x00, 0x00, 0x00, 0xff,                                 /* [      **] */
+    0x00, 0x00, 0x00, 0xff,                                 /* [      **] */
+    0x00, 0x00, 0x00, 0xee,                                 /* [      **] */
 };
 
 const uint8_t checkbook_12_0x3a[] __attribute__((__progmem__)) = {   /* ':' width: 4 */
-     15,  15,                                               /* [**] */
-     15,  15,                                               /* [**] */
-      0,   0,                                               /* [  ] */
-      0,   0,                                               /* [  ] */
-      0,   0,                                               /* [  ] */
-      0,   0,                                               /* [  ] */
-      0,   0,                                               /* [  ] */
-     15,  15,                                               /* [**] */
-     15,  15,                                               /* [**] */
+    0xff,                                                   /* [**] */
+    0xff,                                                   /* [**] */
+    0x00,                                                   /* [  ] */
+    0x00,                                                   /* [  ] */
+    0x00,                                                   /* [  ] */
+    0x00,                                                   /* [  ] */
+    0x00,                                                   /* [  ] */
+    0xff,                                                   /* [**] */
+    0xff,                                                   /* [**] */
 };
 
 const uint8_t checkbook_12_0x3b[] __attribute__((__progmem__)) = {   /* ';' width: 4 */
-     15,  15,                                               /* [**] */
-     15,  15,                                               /* [**] */
-      0,   0,                                               /* [  ] */
-      0,   0,                                               /* [  ] */
-     14,  14,                                               /* [**] */
-     15,  15,                                               /* [**] */
-     15,  15,                                               /* [**] */
-      4,  13,                                               /* [ *] */
-      9,   9,                                               /* [**] */
-      5,   0,                                               /* [  ] */
+    0xff,                                                   /* [**] */
+    0xff,                                                   /* [**] */
+    0x00,                                                   /* [  ] */
+    0x00,                                                   /* [  ] */
+    0xee,                                                   /* [**] */
+    0xff,                                                   /* [**] */
+    0xff,                                                   /* [**] */
+    0x4d,                                                   /* [ *] */
+    0x99,                                                   /* [**] */
+    0x50,                                                   /* [  ] */
 };
 
 const uint8_t checkbook_12_0x3f[] __attribute__((__progmem__)) = {   /* '?' width: 8 */
-     14,  15,  15,  15,  15,  15,                           /* [******] */
-     15,   3,   0,   0,   2,  15,                           /* [*    *] */
-     15,   0,   0,   0,   0,  15,                           /* [*    *] */
-     14,   0,   0,   0,   0,  15,                           /* [*    *] */
-      3,   0,   0,   0,   1,  15,                           /* [     *] */
-      0,   0,   0,   5,  14,  15,                           /* [    **] */
-      0,   0,   6,  15,  14,   4,                           /* [  *** ] */
-      0,   0,   8,  14,   1,   0,                           /* [  **  ] */
-      0,   0,   8,  11,   0,   0,                           /* [  **  ] */
-      0,   0,   7,  10,   0,   0,                           /* [  **  ] */
-      0,   0,   1,   2,   0,   0,                           /* [      ] */
-      0,   0,  15,  15,   0,   0,                           /* [  **  ] */
-      0,   0,  15,  15,   0,   0,                           /* [  **  ] */
+    0xef, 0xff, 0xff,                                       /* [******] */
+    0xf3, 0x00, 0x2f,                                       /* [*    *] */
+    0xf0, 0x00, 0x0f,                                       /* [*    *] */
+    0xe0, 0x00, 0x0f,                                       /* [*    *] */
+    0x30, 0x00, 0x1f,                                       /* [     *] */
+    0x00, 0x05, 0xef,                                       /* [    **] */
+    0x00, 0x6f, 0xe4,                                       /* [  *** ] */
+    0x00, 0x8e, 0x10,                                       /* [  **  ] */
+    0x00, 0x8b, 0x00,                                       /* [  **  ] */
+    0x00, 0x7a, 0x00,                                       /* [  **  ] */
+    0x00, 0x12, 0x00,                                       /* [      ] */
+    0x00, 0xff, 0x00,                                       /* [  **  ] */
+    0x00, 0xff, 0x00,                                       /* [  **  ] */
 };
 
 const uint8_t checkbook_12_0x41[] __attribute__((__progmem__)) = {   /* 'A' width: 10 */
-      6,  15,  15,  15,  15,  15,  14,                      /* [*******] */
-      7,   2,   0,   0,   0,   1,  15,                      /* [*     *] */
-      6,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-      6,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-      6,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-      7,   1,   0,   0,   0,   2,  15,                      /* [*     *] */
-     10,  15,  15,  15,  15,  15,  15,                      /* [*******] */
-     15,   3,   0,   0,   0,   3,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     13,   0,   0,   0,   0,   0,  12,                      /* [*     *] */
+    0x6f, 0xff, 0xff, 0xe0,                                 /* [*******] */
+    0x72, 0x00, 0x01, 0xf0,                                 /* [*     *] */
+    0x60, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0x60, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0x60, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0x71, 0x00, 0x02, 0xf0,                                 /* [*     *] */
+    0xaf, 0xff, 0xff, 0xf0,                                 /* [*******] */
+    0xf3, 0x00, 0x03, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xd0, 0x00, 0x00, 0xc0,                                 /* [*     *] */
 };
 
 const uint8_t checkbook_12_0x42[] __attribute__((__progmem__)) = {   /* 'B' width: 10 */
-     14,  15,  15,  15,  15,  15,  14,   0,                 /* [******* ] */
-     15,  15,   4,   0,   0,   4,  15,   0,                 /* [**    * ] */
-     15,  15,   0,   0,   0,   0,  15,   0,                 /* [**    * ] */
-     15,  15,   0,   0,   0,   0,  15,   0,                 /* [**    * ] */
-     15,  15,   0,   0,   0,   0,  15,   0,                 /* [**    * ] */
-     15,  15,   4,   0,   0,   5,  15,   1,                 /* [**    * ] */
-     15,  15,  15,  15,  15,  15,  15,  14,                 /* [********] */
-     15,  15,   4,   0,   0,   0,   2,  15,                 /* [**     *] */
-     15,  15,   0,   0,   0,   0,   0,  15,                 /* [**     *] */
-     15,  15,   0,   0,   0,   0,   0,  15,                 /* [**     *] */
-     15,  15,   0,   0,   0,   0,   0,  15,                 /* [**     *] */
-     15,  15,   4,   0,   0,   0,   3,  15,                 /* [**     *] */
-     14,  15,  15,  15,  15,  15,  15,  14,                 /* [********] */
+    0xef, 0xff, 0xff, 0xe0,                                 /* [******* ] */
+    0xff, 0x40, 0x04, 0xf0,                                 /* [**    * ] */
+    0xff, 0x00, 0x00, 0xf0,                                 /* [**    * ] */
+    0xff, 0x00, 0x00, 0xf0,                                 /* [**    * ] */
+    0xff, 0x00, 0x00, 0xf0,                                 /* [**    * ] */
+    0xff, 0x40, 0x05, 0xf1,                                 /* [**    * ] */
+    0xff, 0xff, 0xff, 0xfe,                                 /* [********] */
+    0xff, 0x40, 0x00, 0x2f,                                 /* [**     *] */
+    0xff, 0x00, 0x00, 0x0f,                                 /* [**     *] */
+    0xff, 0x00, 0x00, 0x0f,                                 /* [**     *] */
+    0xff, 0x00, 0x00, 0x0f,                                 /* [**     *] */
+    0xff, 0x40, 0x00, 0x3f,                                 /* [**     *] */
+    0xef, 0xff, 0xff, 0xfe,                                 /* [********] */
 };
 
 const uint8_t checkbook_12_0x43[] __attribute__((__progmem__)) = {   /* 'C' width: 9 */
-     13,  15,  15,  15,  15,  15,  15,                      /* [*******] */
-     15,   6,   0,   0,   0,   4,  15,                      /* [**    *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  14,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,   0,                      /* [*      ] */
-     15,   0,   0,   0,   0,   0,   0,                      /* [*      ] */
-     15,   0,   0,   0,   0,   0,   0,                      /* [*      ] */
-     15,   0,   0,   0,   0,   0,   0,                      /* [*      ] */
-     15,   0,   0,   0,   0,   0,   0,                      /* [*      ] */
-     15,   0,   0,   0,   0,   0,   6,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,   7,                      /* [*     *] */
-     15,   4,   0,   0,   0,   0,   9,                      /* [*     *] */
-     14,  15,  15,  15,  15,  15,  13,                      /* [*******] */
+    0xdf, 0xff, 0xff, 0xf0,                                 /* [*******] */
+    0xf6, 0x00, 0x04, 0xf0,                                 /* [**    *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xe0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0x00,                                 /* [*      ] */
+    0xf0, 0x00, 0x00, 0x00,                                 /* [*      ] */
+    0xf0, 0x00, 0x00, 0x00,                                 /* [*      ] */
+    0xf0, 0x00, 0x00, 0x00,                                 /* [*      ] */
+    0xf0, 0x00, 0x00, 0x00,                                 /* [*      ] */
+    0xf0, 0x00, 0x00, 0x60,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0x70,                                 /* [*     *] */
+    0xf4, 0x00, 0x00, 0x90,                                 /* [*     *] */
+    0xef, 0xff, 0xff, 0xd0,                                 /* [*******] */
 };
 
 const uint8_t checkbook_12_0x44[] __attribute__((__progmem__)) = {   /* 'D' width: 10 */
-     13,  15,  15,  15,  15,  15,  11,   1,                 /* [******* ] */
-     15,  15,   5,   0,   0,   0,   9,  10,                 /* [**    **] */
-     15,  15,   0,   0,   0,   0,   0,  14,                 /* [**     *] */
-     15,  15,   0,   0,   0,   0,   0,  15,                 /* [**     *] */
-     15,  15,   0,   0,   0,   0,   0,  15,                 /* [**     *] */
-     15,  15,   0,   0,   0,   0,   0,  15,                 /* [**     *] */
-     15,  15,   0,   0,   0,   0,   0,  15,                 /* [**     *] */
-     15,  15,   0,   0,   0,   0,   0,  15,                 /* [**     *] */
-     15,  15,   0,   0,   0,   0,   0,  15,                 /* [**     *] */
-     15,  15,   0,   0,   0,   0,   0,  15,                 /* [**     *] */
-     15,  15,   0,   0,   0,   0,   2,  15,                 /* [**     *] */
-     15,  15,   5,   0,   0,   1,   9,  10,                 /* [**    **] */
-     13,  15,  15,  15,  15,  15,  11,   1,                 /* [******* ] */
+    0xdf, 0xff, 0xff, 0xb1,                                 /* [******* ] */
+    0xff, 0x50, 0x00, 0x9a,                                 /* [**    **] */
+    0xff, 0x00, 0x00, 0x0e,                                 /* [**     *] */
+    0xff, 0x00, 0x00, 0x0f,                                 /* [**     *] */
+    0xff, 0x00, 0x00, 0x0f,                                 /* [**     *] */
+    0xff, 0x00, 0x00, 0x0f,                                 /* [**     *] */
+    0xff, 0x00, 0x00, 0x0f,                                 /* [**     *] */
+    0xff, 0x00, 0x00, 0x0f,                                 /* [**     *] */
+    0xff, 0x00, 0x00, 0x0f,                                 /* [**     *] */
+    0xff, 0x00, 0x00, 0x0f,                                 /* [**     *] */
+    0xff, 0x00, 0x00, 0x2f,                                 /* [**     *] */
+    0xff, 0x50, 0x01, 0x9a,                                 /* [**    **] */
+    0xdf, 0xff, 0xff, 0xb1,                                 /* [******* ] */
 };
 
 const uint8_t checkbook_12_0x45[] __attribute__((__progmem__)) = {   /* 'E' width: 8 */
-     15,  15,  15,  15,  15,   5,                           /* [***** ] */
-      9,   0,   0,   0,   0,   0,                           /* [*     ] */
-      7,   0,   0,   0,   0,   0,                           /* [*     ] */
-      7,   0,   0,   0,   0,   0,                           /* [*     ] */
-      7,   0,   0,   0,   0,   0,                           /* [*     ] */
-      9,   0,   0,   0,   0,   0,                           /* [*     ] */
-     15,  15,  15,  15,  15,   5,                           /* [***** ] */
-     15,   3,   0,   0,   0,   0,                           /* [*     ] */
-     15,   0,   0,   0,   0,   0,                           /* [*     ] */
-     15,   0,   0,   0,   0,   0,                           /* [*     ] */
-     15,   0,   0,   0,   0,   0,                           /* [*     ] */
-     15,   3,   0,   0,   0,   0,                           /* [*     ] */
-     14,  15,  15,  15,  15,   5,                           /* [***** ] */
+    0xff, 0xff, 0xf5,                                       /* [***** ] */
+    0x90, 0x00, 0x00,                                       /* [*     ] */
+    0x70, 0x00, 0x00,                                       /* [*     ] */
+    0x70, 0x00, 0x00,                                       /* [*     ] */
+    0x70, 0x00, 0x00,                                       /* [*     ] */
+    0x90, 0x00, 0x00,                                       /* [*     ] */
+    0xff, 0xff, 0xf5,                                       /* [***** ] */
+    0xf3, 0x00, 0x00,                                       /* [*     ] */
+    0xf0, 0x00, 0x00,                                       /* [*     ] */
+    0xf0, 0x00, 0x00,                                       /* [*     ] */
+    0xf0, 0x00, 0x00,                                       /* [*     ] */
+    0xf3, 0x00, 0x00,                                       /* [*     ] */
+    0xef, 0xff, 0xf5,                                       /* [***** ] */
 };
 
 const uint8_t checkbook_12_0x46[] __attribute__((__progmem__)) = {   /* 'F' width: 8 */
-      5,  15,  15,  15,  15,  15,  15,   6,                 /* [ *******] */
-      7,  15,  15,   5,   0,   0,   0,   0,                 /* [***     ] */
-      7,  15,  15,   0,   0,   0,   0,   0,                 /* [***     ] */
-      7,  15,  15,   0,   0,   0,   0,   0,                 /* [***     ] */
-      7,  15,  15,   0,   0,   0,   0,   0,                 /* [***     ] */
-      6,  15,  15,   5,   0,   0,   0,   0,                 /* [***     ] */
-      0,   4,  15,  15,  15,  15,  15,   4,                 /* [  ***** ] */
-      0,   0,  15,   3,   0,   0,   0,   0,                 /* [  *     ] */
-      0,   0,  15,   0,   0,   0,   0,   0,                 /* [  *     ] */
-      0,   0,  15,   0,   0,   0,   0,   0,                 /* [  *     ] */
-      0,   0,  15,   0,   0,   0,   0,   0,                 /* [  *     ] */
-      0,   0,  15,   0,   0,   0,   0,   0,                 /* [  *     ] */
-      0,   0,  12,   0,   0,   0,   0,   0,                 /* [  *     ] */
+    0x5f, 0xff, 0xff, 0xf6,                                 /* [ *******] */
+    0x7f, 0xf5, 0x00, 0x00,                                 /* [***     ] */
+    0x7f, 0xf0, 0x00, 0x00,                                 /* [***     ] */
+    0x7f, 0xf0, 0x00, 0x00,                                 /* [***     ] */
+    0x7f, 0xf0, 0x00, 0x00,                                 /* [***     ] */
+    0x6f, 0xf5, 0x00, 0x00,                                 /* [***     ] */
+    0x04, 0xff, 0xff, 0xf4,                                 /* [  ***** ] */
+    0x00, 0xf3, 0x00, 0x00,                                 /* [  *     ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *     ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *     ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *     ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *     ] */
+    0x00, 0xc0, 0x00, 0x00,                                 /* [  *     ] */
 };
 
 const uint8_t checkbook_12_0x47[] __attribute__((__progmem__)) = {   /* 'G' width: 10 */
-     13,  15,  15,  15,  15,  15,  15,  11,                 /* [********] */
-     15,  15,   3,   0,   0,  10,  15,  13,                 /* [**   ***] */
-     15,  15,   0,   0,   0,   8,  15,  13,                 /* [**   ***] */
-     15,  15,   0,   0,   0,   3,   9,   7,                 /* [**    **] */
-     15,  15,   0,   0,   0,   0,   0,   0,                 /* [**      ] */
-     15,  15,   0,   0,   0,   0,   0,   0,                 /* [**      ] */
-     15,  15,   0,   0,   7,  15,  15,  14,                 /* [**  ****] */
-     15,  15,   0,   0,   0,   0,   4,  15,                 /* [**     *] */
-     15,  15,   0,   0,   0,   0,   0,  15,                 /* [**     *] */
-     15,  15,   0,   0,   0,   0,   0,  15,                 /* [**     *] */
-     15,  15,   0,   0,   0,   0,   0,  15,                 /* [**     *] */
-     15,  15,   2,   0,   0,   0,   4,  15,                 /* [**     *] */
-     14,  15,  15,  15,  15,  15,  15,  14,                 /* [********] */
+    0xdf, 0xff, 0xff, 0xfb,                                 /* [********] */
+    0xff, 0x30, 0x0a, 0xfd,                                 /* [**   ***] */
+    0xff, 0x00, 0x08, 0xfd,                                 /* [**   ***] */
+    0xff, 0x00, 0x03, 0x97,                                 /* [**    **] */
+    0xff, 0x00, 0x00, 0x00,                                 /* [**      ] */
+    0xff, 0x00, 0x00, 0x00,                                 /* [**      ] */
+    0xff, 0x00, 0x7f, 0xfe,                                 /* [**  ****] */
+    0xff, 0x00, 0x00, 0x4f,                                 /* [**     *] */
+    0xff, 0x00, 0x00, 0x0f,                                 /* [**     *] */
+    0xff, 0x00, 0x00, 0x0f,                                 /* [**     *] */
+    0xff, 0x00, 0x00, 0x0f,                                 /* [**     *] */
+    0xff, 0x20, 0x00, 0x4f,                                 /* [**     *] */
+    0xef, 0xff, 0xff, 0xfe,                                 /* [********] */
 };
 
 const uint8_t checkbook_12_0x48[] __attribute__((__progmem__)) = {   /* 'H' width: 10 */
-      1,   0,   0,   0,   0,   0,   0,   0,                 /* [        ] */
-     15,   0,   0,   0,   0,   0,   6,   3,                 /* [*     * ] */
-     15,   0,   0,   0,   0,   0,   7,   4,                 /* [*     * ] */
-     15,   0,   0,   0,   0,   0,   7,   4,                 /* [*     * ] */
-     15,   0,   0,   0,   0,   0,   7,   4,                 /* [*     * ] */
-     15,   0,   0,   0,   0,   0,   7,   4,                 /* [*     * ] */
-     15,   3,   0,   0,   0,   0,   8,   7,                 /* [*     **] */
-     15,  15,  15,  15,  15,  15,  15,  15,                 /* [********] */
-     15,  15,  13,   0,   0,   0,   3,  15,                 /* [***    *] */
-     15,  15,  10,   0,   0,   0,   0,  15,                 /* [***    *] */
-     15,  15,  10,   0,   0,   0,   0,  15,                 /* [***    *] */
-     15,  15,  10,   0,   0,   0,   0,  15,                 /* [***    *] */
-     15,  15,  10,   0,   0,   0,   0,  15,                 /* [***    *] */
-     15,  15,   9,   0,   0,   0,   0,  15,                 /* [***    *] */
+    0x10, 0x00, 0x00, 0x00,                                 /* [        ] */
+    0xf0, 0x00, 0x00, 0x63,                                 /* [*     * ] */
+    0xf0, 0x00, 0x00, 0x74,                                 /* [*     * ] */
+    0xf0, 0x00, 0x00, 0x74,                                 /* [*     * ] */
+    0xf0, 0x00, 0x00, 0x74,                                 /* [*     * ] */
+    0xf0, 0x00, 0x00, 0x74,                                 /* [*     * ] */
+    0xf3, 0x00, 0x00, 0x87,                                 /* [*     **] */
+    0xff, 0xff, 0xff, 0xff,                                 /* [********] */
+    0xff, 0xd0, 0x00, 0x3f,                                 /* [***    *] */
+    0xff, 0xa0, 0x00, 0x0f,                                 /* [***    *] */
+    0xff, 0xa0, 0x00, 0x0f,                                 /* [***    *] */
+    0xff, 0xa0, 0x00, 0x0f,                                 /* [***    *] */
+    0xff, 0xa0, 0x00, 0x0f,                                 /* [***    *] */
+    0xff, 0x90, 0x00, 0x0f,                                 /* [***    *] */
 };
 
 const uint8_t checkbook_12_0x49[] __attribute__((__progmem__)) = {   /* 'I' width: 4 */
-      0,   0,   0,                                          /* [   ] */
-      0,   0,  14,                                          /* [  *] */
-      0,   0,  15,                                          /* [  *] */
-      0,   0,  15,                                          /* [  *] */
-      0,   0,  15,                                          /* [  *] */
-      0,   0,  15,                                          /* [  *] */
-      0,   0,  15,                                          /* [  *] */
-      0,   7,  15,                                          /* [ **] */
-      8,  15,  15,                                          /* [***] */
-      9,  15,  15,                                          /* [***] */
-      9,  15,  15,                                          /* [***] */
-      9,  15,  15,                                          /* [***] */
-      9,  15,  15,                                          /* [***] */
-      8,  15,  15,                                          /* [***] */
+    0x00, 0x00,                                             /* [   ] */
+    0x00, 0xe0,                                             /* [  *] */
+    0x00, 0xf0,                                             /* [  *] */
+    0x00, 0xf0,                                             /* [  *] */
+    0x00, 0xf0,                                             /* [  *] */
+    0x00, 0xf0,                                             /* [  *] */
+    0x00, 0xf0,                                             /* [  *] */
+    0x07, 0xf0,                                             /* [ **] */
+    0x8f, 0xf0,                                             /* [***] */
+    0x9f, 0xf0,                                             /* [***] */
+    0x9f, 0xf0,                                             /* [***] */
+    0x9f, 0xf0,                                             /* [***] */
+    0x9f, 0xf0,                                             /* [***] */
+    0x8f, 0xf0,                                             /* [***] */
 };
 
 const uint8_t checkbook_12_0x4a[] __attribute__((__progmem__)) = {   /* 'J' width: 10 */
-      0,   0,   0,   0,   0,   1,   0,                      /* [       ] */
-      0,   0,   0,   0,   0,  14,   0,                      /* [     * ] */
-      0,   0,   0,   0,   0,  15,   0,                      /* [     * ] */
-      0,   0,   0,   0,   0,  15,   0,                      /* [     * ] */
-      0,   0,   0,   0,   0,  15,   0,                      /* [     * ] */
-      0,   0,   0,   0,   0,  15,   0,                      /* [     * ] */
-      0,   0,   0,   0,   0,  15,   6,                      /* [     **] */
-      0,   0,   0,   0,   0,  15,  15,                      /* [     **] */
-      0,   0,   0,   0,   0,  15,  15,                      /* [     **] */
-      4,   0,   0,   0,   0,  15,  15,                      /* [     **] */
-     15,   0,   0,   0,   0,  15,  15,                      /* [*    **] */
-     15,   0,   0,   0,   0,  15,  15,                      /* [*    **] */
-     15,   2,   0,   0,   3,  15,  15,                      /* [*    **] */
-     15,  15,  15,  15,  15,  15,  14,                      /* [*******] */
+    0x00, 0x00, 0x01, 0x00,                                 /* [       ] */
+    0x00, 0x00, 0x0e, 0x00,                                 /* [     * ] */
+    0x00, 0x00, 0x0f, 0x00,                                 /* [     * ] */
+    0x00, 0x00, 0x0f, 0x00,                                 /* [     * ] */
+    0x00, 0x00, 0x0f, 0x00,                                 /* [     * ] */
+    0x00, 0x00, 0x0f, 0x00,                                 /* [     * ] */
+    0x00, 0x00, 0x0f, 0x60,                                 /* [     **] */
+    0x00, 0x00, 0x0f, 0xf0,                                 /* [     **] */
+    0x00, 0x00, 0x0f, 0xf0,                                 /* [     **] */
+    0x40, 0x00, 0x0f, 0xf0,                                 /* [     **] */
+    0xf0, 0x00, 0x0f, 0xf0,                                 /* [*    **] */
+    0xf0, 0x00, 0x0f, 0xf0,                                 /* [*    **] */
+    0xf2, 0x00, 0x3f, 0xf0,                                 /* [*    **] */
+    0xff, 0xff, 0xff, 0xe0,                                 /* [*******] */
 };
 
 const uint8_t checkbook_12_0x4b[] __attribute__((__progmem__)) = {   /* 'K' width: 10 */
-      2,   0,   0,   0,   0,   0,   0,   3,   0,            /* [         ] */
-     15,   0,   0,   0,   0,   0,  11,  13,   0,            /* [*     ** ] */
-     15,   0,   0,   0,   0,  10,  14,   1,   0,            /* [*    **  ] */
-     15,   0,   0,   0,  10,  14,   2,   0,   0,            /* [*   **   ] */
-     15,   0,   0,   9,  15,   3,   0,   0,   0,            /* [*  **    ] */
-     15,   0,   9,  15,   4,   0,   0,   0,   0,            /* [* **     ] */
-     15,   9,  15,   7,   0,   0,   0,   0,   0,            /* [****     ] */
-     15,  15,  15,  15,  15,  15,  15,  14,   0,            /* [******** ] */
-     15,  15,   3,   0,   0,   2,  15,  15,   0,            /* [**    ** ] */
-     15,  15,   0,   0,   0,   0,  15,  15,   0,            /* [**    ** ] */
-     15,  15,   0,   0,   0,   0,  15,  15,   0,            /* [**    ** ] */
-     15,  15,   0,   0,   0,   0,  15,  15,   0,            /* [**    ** ] */
-     15,  15,   0,   0,   0,   0,  15,  15,   0,            /* [**    ** ] */
-     14,  14,   0,   0,   0,   0,  14,  14,   0,            /* [**    ** ] */
+    0x20, 0x00, 0x00, 0x03, 0x00,                           /* [         ] */
+    0xf0, 0x00, 0x00, 0xbd, 0x00,                           /* [*     ** ] */
+    0xf0, 0x00, 0x0a, 0xe1, 0x00,                           /* [*    **  ] */
+    0xf0, 0x00, 0xae, 0x20, 0x00,                           /* [*   **   ] */
+    0xf0, 0x09, 0xf3, 0x00, 0x00,                           /* [*  **    ] */
+    0xf0, 0x9f, 0x40, 0x00, 0x00,                           /* [* **     ] */
+    0xf9, 0xf7, 0x00, 0x00, 0x00,                           /* [****     ] */
+    0xff, 0xff, 0xff, 0xfe, 0x00,                           /* [******** ] */
+    0xff, 0x30, 0x02, 0xff, 0x00,                           /* [**    ** ] */
+    0xff, 0x00, 0x00, 0xff, 0x00,                           /* [**    ** ] */
+    0xff, 0x00, 0x00, 0xff, 0x00,                           /* [**    ** ] */
+    0xff, 0x00, 0x00, 0xff, 0x00,                           /* [**    ** ] */
+    0xff, 0x00, 0x00, 0xff, 0x00,                           /* [**    ** ] */
+    0xee, 0x00, 0x00, 0xee, 0x00,                           /* [**    ** ] */
 };
 
 const uint8_t checkbook_12_0x4c[] __attribute__((__progmem__)) = {   /* 'L' width: 8 */
-      0,   0,   2,   0,   0,   0,   0,   0,                 /* [        ] */
-      0,   0,  15,   0,   0,   0,   0,   0,                 /* [  *     ] */
-      0,   0,  15,   0,   0,   0,   0,   0,                 /* [  *     ] */
-      0,   0,  15,   0,   0,   0,   0,   0,                 /* [  *     ] */
-      0,   0,  15,   0,   0,   0,   0,   0,                 /* [  *     ] */
-      0,   0,  15,   0,   0,   0,   0,   0,                 /* [  *     ] */
-      0,   0,  15,   0,   0,   0,   0,   0,                 /* [  *     ] */
-      0,   7,  15,   0,   0,   0,   0,   0,                 /* [ **     ] */
-      8,  15,  15,   0,   0,   0,   0,   0,                 /* [***     ] */
-      9,  15,  15,   0,   0,   0,   0,   0,                 /* [***     ] */
-      9,  15,  15,   0,   0,   0,   0,   0,                 /* [***     ] */
-      9,  15,  15,   0,   0,   0,   0,   0,                 /* [***     ] */
-      9,  15,  15,   2,   0,   0,   0,   0,                 /* [***     ] */
-      7,  15,  15,  15,  15,  15,  15,   5,                 /* [******* ] */
+    0x00, 0x20, 0x00, 0x00,                                 /* [        ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *     ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *     ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *     ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *     ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *     ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *     ] */
+    0x07, 0xf0, 0x00, 0x00,                                 /* [ **     ] */
+    0x8f, 0xf0, 0x00, 0x00,                                 /* [***     ] */
+    0x9f, 0xf0, 0x00, 0x00,                                 /* [***     ] */
+    0x9f, 0xf0, 0x00, 0x00,                                 /* [***     ] */
+    0x9f, 0xf0, 0x00, 0x00,                                 /* [***     ] */
+    0x9f, 0xf2, 0x00, 0x00,                                 /* [***     ] */
+    0x7f, 0xff, 0xff, 0xf5,                                 /* [******* ] */
 };
 
 const uint8_t checkbook_12_0x4d[] __attribute__((__progmem__)) = {   /* 'M' width: 12 */
-      2,   3,   1,   0,   0,   0,   1,   3,   3,   2,       /* [          ] */
-     15,  15,  12,   0,   0,   4,  15,  15,  15,  15,       /* [***   ****] */
-     15,   6,  15,   2,   0,  13,  14,   5,  15,  15,       /* [***  ** **] */
-     15,   0,  12,   7,   7,  15,   6,   0,  15,  15,       /* [* ***** **] */
-     15,   0,   5,  14,  15,  12,   0,   0,  15,  15,       /* [*  ***  **] */
-     15,   0,   0,  13,  15,   2,   0,   0,  15,  15,       /* [*  **   **] */
-     15,   0,   0,   4,   6,   0,   0,   0,  15,  15,       /* [*   *   **] */
-     15,   0,   0,   0,   0,   0,   0,   0,  15,  15,       /* [*       **] */
-     15,   0,   0,   0,   0,   0,   0,   0,  15,  15,       /* [*       **] */
-     15,   0,   0,   0,   0,   0,   0,   0,  15,  15,       /* [*       **] */
-     15,   0,   0,  13,  13,   0,   0,   0,  15,  15,       /* [*  **   **] */
-     15,   0,   0,  15,  15,   0,   0,   0,  15,  15,       /* [*  **   **] */
-     15,   0,   0,  15,  15,   0,   0,   0,  15,  15,       /* [*  **   **] */
-     12,   0,   0,  14,  14,   0,   0,   0,  15,  14,       /* [*  **   **] */
+    0x23, 0x10, 0x00, 0x13, 0x32,                           /* [          ] */
+    0xff, 0xc0, 0x04, 0xff, 0xff,                           /* [***   ****] */
+    0xf6, 0xf2, 0x0d, 0xe5, 0xff,                           /* [***  ** **] */
+    0xf0, 0xc7, 0x7f, 0x60, 0xff,                           /* [* ***** **] */
+    0xf0, 0x5e, 0xfc, 0x00, 0xff,                           /* [*  ***  **] */
+    0xf0, 0x0d, 0xf2, 0x00, 0xff,                           /* [*  **   **] */
+    0xf0, 0x04, 0x60, 0x00, 0xff,                           /* [*   *   **] */
+    0xf0, 0x00, 0x00, 0x00, 0xff,                           /* [*       **] */
+    0xf0, 0x00, 0x00, 0x00, 0xff,                           /* [*       **] */
+    0xf0, 0x00, 0x00, 0x00, 0xff,                           /* [*       **] */
+    0xf0, 0x0d, 0xd0, 0x00, 0xff,                           /* [*  **   **] */
+    0xf0, 0x0f, 0xf0, 0x00, 0xff,                           /* [*  **   **] */
+    0xf0, 0x0f, 0xf0, 0x00, 0xff,                           /* [*  **   **] */
+    0xc0, 0x0e, 0xe0, 0x00, 0xfe,                           /* [*  **   **] */
 };
 
 const uint8_t checkbook_12_0x4e[] __attribute__((__progmem__)) = {   /* 'N' width: 10 */
-      3,   5,   2,   0,   0,   0,   0,   1,                 /* [        ] */
-     15,  15,  14,   1,   0,   0,   0,  14,                 /* [***    *] */
-     15,   2,  13,  11,   0,   0,   0,  15,                 /* [* **   *] */
-     15,   0,   3,  15,   6,   0,   0,  15,                 /* [*  **  *] */
-     15,   0,   0,   7,  15,   2,   0,  15,                 /* [*  **  *] */
-     15,   0,   0,   0,  11,  12,   0,  15,                 /* [*   ** *] */
-     15,   0,   0,   0,   1,  14,  10,  15,                 /* [*    ***] */
-     15,   0,   0,   0,   0,   4,  15,  15,                 /* [*     **] */
-     15,   0,   0,   0,   0,   0,   9,  15,                 /* [*     **] */
-     15,   0,   0,   0,   0,   0,   1,  15,                 /* [*      *] */
-     15,   0,   0,  14,  14,   0,   0,  15,                 /* [*  **  *] */
-     15,   0,   0,  15,  15,   0,   0,  15,                 /* [*  **  *] */
-     15,   0,   0,  15,  15,   0,   0,  15,                 /* [*  **  *] */
-     13,   0,   0,  14,  14,   0,   0,  12,                 /* [*  **  *] */
+    0x35, 0x20, 0x00, 0x01,                                 /* [        ] */
+    0xff, 0xe1, 0x00, 0x0e,                                 /* [***    *] */
+    0xf2, 0xdb, 0x00, 0x0f,                                 /* [* **   *] */
+    0xf0, 0x3f, 0x60, 0x0f,                                 /* [*  **  *] */
+    0xf0, 0x07, 0xf2, 0x0f,                                 /* [*  **  *] */
+    0xf0, 0x00, 0xbc, 0x0f,                                 /* [*   ** *] */
+    0xf0, 0x00, 0x1e, 0xaf,                                 /* [*    ***] */
+    0xf0, 0x00, 0x04, 0xff,                                 /* [*     **] */
+    0xf0, 0x00, 0x00, 0x9f,                                 /* [*     **] */
+    0xf0, 0x00, 0x00, 0x1f,                                 /* [*      *] */
+    0xf0, 0x0e, 0xe0, 0x0f,                                 /* [*  **  *] */
+    0xf0, 0x0f, 0xf0, 0x0f,                                 /* [*  **  *] */
+    0xf0, 0x0f, 0xf0, 0x0f,                                 /* [*  **  *] */
+    0xd0, 0x0e, 0xe0, 0x0c,                                 /* [*  **  *] */
 };
 
 const uint8_t checkbook_12_0x4f[] __attribute__((__progmem__)) = {   /* 'O' width: 10 */
-     13,  15,  15,  15,  15,  15,  15,  14,                 /* [********] */
-     15,   4,   0,   0,   0,   0,   1,  14,                 /* [*      *] */
-     15,   0,   0,   0,   0,   0,   0,  13,                 /* [*      *] */
-     15,   0,   0,   0,   0,   0,   0,  13,                 /* [*      *] */
-     15,   0,   0,   0,   0,   0,   0,  13,                 /* [*      *] */
-     15,   0,   0,   0,   0,   0,   8,  15,                 /* [*     **] */
-     15,   0,   0,   0,   0,   0,  15,  15,                 /* [*     **] */
-     15,   0,   0,   0,   0,   0,  15,  15,                 /* [*     **] */
-     15,   0,   0,   0,   0,   0,  15,  15,                 /* [*     **] */
-     15,   0,   0,   0,   0,   0,  15,  15,                 /* [*     **] */
-     15,   0,   0,   0,   0,   0,  15,  15,                 /* [*     **] */
-     15,   5,   0,   0,   0,   3,  15,  15,                 /* [*     **] */
-     14,  15,  15,  15,  15,  15,  15,  13,                 /* [********] */
+    0xdf, 0xff, 0xff, 0xfe,                                 /* [********] */
+    0xf4, 0x00, 0x00, 0x1e,                                 /* [*      *] */
+    0xf0, 0x00, 0x00, 0x0d,                                 /* [*      *] */
+    0xf0, 0x00, 0x00, 0x0d,                                 /* [*      *] */
+    0xf0, 0x00, 0x00, 0x0d,                                 /* [*      *] */
+    0xf0, 0x00, 0x00, 0x8f,                                 /* [*     **] */
+    0xf0, 0x00, 0x00, 0xff,                                 /* [*     **] */
+    0xf0, 0x00, 0x00, 0xff,                                 /* [*     **] */
+    0xf0, 0x00, 0x00, 0xff,                                 /* [*     **] */
+    0xf0, 0x00, 0x00, 0xff,                                 /* [*     **] */
+    0xf0, 0x00, 0x00, 0xff,                                 /* [*     **] */
+    0xf5, 0x00, 0x03, 0xff,                                 /* [*     **] */
+    0xef, 0xff, 0xff, 0xfd,                                 /* [********] */
 };
 
 const uint8_t checkbook_12_0x50[] __attribute__((__progmem__)) = {   /* 'P' width: 9 */
-     13,  15,  15,  15,  15,  15,  12,                      /* [*******] */
-     15,   2,   0,   0,   0,   3,  15,                      /* [*     *] */
-     14,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     14,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     14,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   2,   0,   0,   0,   4,  15,                      /* [*     *] */
-     15,  15,  15,  15,  15,  15,  13,                      /* [*******] */
-     15,  15,   2,   0,   0,   0,   0,                      /* [**     ] */
-     15,  15,   0,   0,   0,   0,   0,                      /* [**     ] */
-     15,  15,   0,   0,   0,   0,   0,                      /* [**     ] */
-     15,  15,   0,   0,   0,   0,   0,                      /* [**     ] */
-     15,  15,   0,   0,   0,   0,   0,                      /* [**     ] */
-     14,  14,   0,   0,   0,   0,   0,                      /* [**     ] */
+    0xdf, 0xff, 0xff, 0xc0,                                 /* [*******] */
+    0xf2, 0x00, 0x03, 0xf0,                                 /* [*     *] */
+    0xe0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xe0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xe0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf2, 0x00, 0x04, 0xf0,                                 /* [*     *] */
+    0xff, 0xff, 0xff, 0xd0,                                 /* [*******] */
+    0xff, 0x20, 0x00, 0x00,                                 /* [**     ] */
+    0xff, 0x00, 0x00, 0x00,                                 /* [**     ] */
+    0xff, 0x00, 0x00, 0x00,                                 /* [**     ] */
+    0xff, 0x00, 0x00, 0x00,                                 /* [**     ] */
+    0xff, 0x00, 0x00, 0x00,                                 /* [**     ] */
+    0xee, 0x00, 0x00, 0x00,                                 /* [**     ] */
 };
 
 const uint8_t checkbook_12_0x51[] __attribute__((__progmem__)) = {   /* 'Q' width: 10 */
-     14,  15,  15,  15,  15,  15,  13,                      /* [*******] */
-     10,   0,   0,   0,   0,   4,  15,                      /* [*     *] */
-      8,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-      9,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   7,   1,   0,  15,                      /* [*  *  *] */
-     15,   0,   0,  15,   9,   0,  15,                      /* [*  ** *] */
-     15,   0,   0,  10,  15,   5,  15,                      /* [*  ** *] */
-     14,  15,  15,  15,  15,  15,  13,                      /* [*******] */
-      0,   0,   0,   0,  10,  15,   0,                      /* [    ** ] */
-      0,   0,   0,   0,   2,  13,   1,                      /* [     * ] */
+    0xef, 0xff, 0xff, 0xd0,                                 /* [*******] */
+    0xa0, 0x00, 0x04, 0xf0,                                 /* [*     *] */
+    0x80, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0x90, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x07, 0x10, 0xf0,                                 /* [*  *  *] */
+    0xf0, 0x0f, 0x90, 0xf0,                                 /* [*  ** *] */
+    0xf0, 0x0a, 0xf5, 0xf0,                                 /* [*  ** *] */
+    0xef, 0xff, 0xff, 0xd0,                                 /* [*******] */
+    0x00, 0x00, 0xaf, 0x00,                                 /* [    ** ] */
+    0x00, 0x00, 0x2d, 0x10,                                 /* [     * ] */
 };
 
 const uint8_t checkbook_12_0x52[] __attribute__((__progmem__)) = {   /* 'R' width: 10 */
-     14,  15,  15,  15,  15,  15,  13,   0,                 /* [******* ] */
-      8,   0,   0,   0,   0,   3,  15,   0,                 /* [*     * ] */
-      7,   0,   0,   0,   0,   0,  15,   0,                 /* [*     * ] */
-      7,   0,   0,   0,   0,   0,  15,   0,                 /* [*     * ] */
-      7,   0,   0,   0,   0,   0,  15,   0,                 /* [*     * ] */
-      9,   0,   0,   0,   0,   5,  15,   2,                 /* [*     * ] */
-     15,  15,  15,  15,  15,  15,  15,  15,                 /* [********] */
-     15,   4,   0,   0,   0,   4,  15,  15,                 /* [*     **] */
-     15,   0,   0,   0,   0,   0,  15,  15,                 /* [*     **] */
-     15,   0,   0,   0,   0,   0,  15,  15,                 /* [*     **] */
-     15,   0,   0,   0,   0,   0,  15,  15,                 /* [*     **] */
-     15,   0,   0,   0,   0,   0,  15,  15,                 /* [*     **] */
-     14,   0,   0,   0,   0,   0,  14,  14,                 /* [*     **] */
+    0xef, 0xff, 0xff, 0xd0,                                 /* [******* ] */
+    0x80, 0x00, 0x03, 0xf0,                                 /* [*     * ] */
+    0x70, 0x00, 0x00, 0xf0,                                 /* [*     * ] */
+    0x70, 0x00, 0x00, 0xf0,                                 /* [*     * ] */
+    0x70, 0x00, 0x00, 0xf0,                                 /* [*     * ] */
+    0x90, 0x00, 0x05, 0xf2,                                 /* [*     * ] */
+    0xff, 0xff, 0xff, 0xff,                                 /* [********] */
+    0xf4, 0x00, 0x04, 0xff,                                 /* [*     **] */
+    0xf0, 0x00, 0x00, 0xff,                                 /* [*     **] */
+    0xf0, 0x00, 0x00, 0xff,                                 /* [*     **] */
+    0xf0, 0x00, 0x00, 0xff,                                 /* [*     **] */
+    0xf0, 0x00, 0x00, 0xff,                                 /* [*     **] */
+    0xe0, 0x00, 0x00, 0xee,                                 /* [*     **] */
 };
 
 const uint8_t checkbook_12_0x53[] __attribute__((__progmem__)) = {   /* 'S' width: 9 */
-     14,  15,  15,  15,  15,  15,  14,                      /* [*******] */
-     15,   4,   0,   0,   0,   1,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  12,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,   0,                      /* [*      ] */
-     15,   4,   0,   0,   0,   0,   0,                      /* [*      ] */
-     14,  15,  15,  15,  15,  15,  14,                      /* [*******] */
-      0,   0,   0,   0,   0,   2,  15,                      /* [      *] */
-      0,   0,   0,   0,   0,   0,  15,                      /* [      *] */
-     13,  15,   8,   0,   0,   0,  15,                      /* [***   *] */
-     15,  15,  10,   0,   0,   0,  15,                      /* [***   *] */
-     15,  15,  13,   0,   0,   3,  15,                      /* [***   *] */
-     13,  15,  15,  15,  15,  15,  14,                      /* [*******] */
+    0xef, 0xff, 0xff, 0xe0,                                 /* [*******] */
+    0xf4, 0x00, 0x01, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xc0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0x00,                                 /* [*      ] */
+    0xf4, 0x00, 0x00, 0x00,                                 /* [*      ] */
+    0xef, 0xff, 0xff, 0xe0,                                 /* [*******] */
+    0x00, 0x00, 0x02, 0xf0,                                 /* [      *] */
+    0x00, 0x00, 0x00, 0xf0,                                 /* [      *] */
+    0xdf, 0x80, 0x00, 0xf0,                                 /* [***   *] */
+    0xff, 0xa0, 0x00, 0xf0,                                 /* [***   *] */
+    0xff, 0xd0, 0x03, 0xf0,                                 /* [***   *] */
+    0xdf, 0xff, 0xff, 0xe0,                                 /* [*******] */
 };
 
 const uint8_t checkbook_12_0x54[] __attribute__((__progmem__)) = {   /* 'T' width: 10 */
-      5,  15,  15,  15,  15,  15,  15,  15,  15,   6,       /* [ *********] */
-      0,   0,   0,   0,   4,  15,   2,   0,   0,   0,       /* [     *    ] */
-      0,   0,   0,   0,   0,  15,   0,   0,   0,   0,       /* [     *    ] */
-      0,   0,   0,   0,   0,  15,   0,   0,   0,   0,       /* [     *    ] */
-      0,   0,   0,   0,   0,  15,   0,   0,   0,   0,       /* [     *    ] */
-      0,   0,   0,   0,   0,  15,   0,   0,   0,   0,       /* [     *    ] */
-      0,   0,   0,   0,   0,  15,   0,   0,   0,   0,       /* [     *    ] */
-      0,   0,   0,   0,   0,  15,   0,   0,   0,   0,       /* [     *    ] */
-      0,   0,   0,   0,   0,  15,   0,   0,   0,   0,       /* [     *    ] */
-      0,   0,   0,   0,   0,  15,   0,   0,   0,   0,       /* [     *    ] */
-      0,   0,   0,   0,   0,  15,   0,   0,   0,   0,       /* [     *    ] */
-      0,   0,   0,   0,   0,  15,   0,   0,   0,   0,       /* [     *    ] */
-      0,   0,   0,   0,   0,  14,   0,   0,   0,   0,       /* [     *    ] */
+    0x5f, 0xff, 0xff, 0xff, 0xf6,                           /* [ *********] */
+    0x00, 0x00, 0x4f, 0x20, 0x00,                           /* [     *    ] */
+    0x00, 0x00, 0x0f, 0x00, 0x00,                           /* [     *    ] */
+    0x00, 0x00, 0x0f, 0x00, 0x00,                           /* [     *    ] */
+    0x00, 0x00, 0x0f, 0x00, 0x00,                           /* [     *    ] */
+    0x00, 0x00, 0x0f, 0x00, 0x00,                           /* [     *    ] */
+    0x00, 0x00, 0x0f, 0x00, 0x00,                           /* [     *    ] */
+    0x00, 0x00, 0x0f, 0x00, 0x00,                           /* [     *    ] */
+    0x00, 0x00, 0x0f, 0x00, 0x00,                           /* [     *    ] */
+    0x00, 0x00, 0x0f, 0x00, 0x00,                           /* [     *    ] */
+    0x00, 0x00, 0x0f, 0x00, 0x00,                           /* [     *    ] */
+    0x00, 0x00, 0x0f, 0x00, 0x00,                           /* [     *    ] */
+    0x00, 0x00, 0x0e, 0x00, 0x00,                           /* [     *    ] */
 };
 
 const uint8_t checkbook_12_0x55[] __attribute__((__progmem__)) = {   /* 'U' width: 9 */
-      1,   0,   0,   0,   0,   0,   3,                      /* [       ] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   4,   0,   0,   0,   3,  15,                      /* [*     *] */
-     14,  15,  15,  15,  15,  15,  14,                      /* [*******] */
+    0x10, 0x00, 0x00, 0x30,                                 /* [       ] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf4, 0x00, 0x03, 0xf0,                                 /* [*     *] */
+    0xef, 0xff, 0xff, 0xe0,                                 /* [*******] */
 };
 
 const uint8_t checkbook_12_0x56[] __attribute__((__progmem__)) = {   /* 'V' width: 9 */
-      2,   0,   0,   0,   0,   4,   4,                      /* [       ] */
-     15,   0,   0,   0,   0,  15,  15,                      /* [*    **] */
-     15,   0,   0,   0,   0,  15,  15,                      /* [*    **] */
-     15,   0,   0,   0,   0,  15,  15,                      /* [*    **] */
-     15,   0,   0,   0,   0,  15,  15,                      /* [*    **] */
-     15,   0,   0,   0,   0,  15,  15,                      /* [*    **] */
-     15,   0,   0,   0,   0,  15,  15,                      /* [*    **] */
-     15,   0,   0,   0,   0,  15,  15,                      /* [*    **] */
-     15,   0,   0,   0,   0,  15,  15,                      /* [*    **] */
-     13,   4,   0,   0,   0,  15,  15,                      /* [*    **] */
-      4,  14,   1,   0,   0,  15,  15,                      /* [ *   **] */
-      0,  10,  11,   0,   1,  15,   6,                      /* [ **  **] */
-      0,   1,  14,   8,  10,   8,   0,                      /* [  **** ] */
-      0,   0,   5,  15,  10,   0,   0,                      /* [   **  ] */
+    0x20, 0x00, 0x04, 0x40,                                 /* [       ] */
+    0xf0, 0x00, 0x0f, 0xf0,                                 /* [*    **] */
+    0xf0, 0x00, 0x0f, 0xf0,                                 /* [*    **] */
+    0xf0, 0x00, 0x0f, 0xf0,                                 /* [*    **] */
+    0xf0, 0x00, 0x0f, 0xf0,                                 /* [*    **] */
+    0xf0, 0x00, 0x0f, 0xf0,                                 /* [*    **] */
+    0xf0, 0x00, 0x0f, 0xf0,                                 /* [*    **] */
+    0xf0, 0x00, 0x0f, 0xf0,                                 /* [*    **] */
+    0xf0, 0x00, 0x0f, 0xf0,                                 /* [*    **] */
+    0xd4, 0x00, 0x0f, 0xf0,                                 /* [*    **] */
+    0x4e, 0x10, 0x0f, 0xf0,                                 /* [ *   **] */
+    0x0a, 0xb0, 0x1f, 0x60,                                 /* [ **  **] */
+    0x01, 0xe8, 0xa8, 0x00,                                 /* [  **** ] */
+    0x00, 0x5f, 0xa0, 0x00,                                 /* [   **  ] */
 };
 
 const uint8_t checkbook_12_0x57[] __attribute__((__progmem__)) = {   /* 'W' width: 12 */
-      2,   0,   0,   0,   0,   2,   2,   0,   0,   1,       /* [          ] */
-     15,   0,   0,   0,   0,  15,  15,   0,   0,  14,       /* [*    **  *] */
-     15,   0,   0,   0,   0,  15,  15,   0,   0,  15,       /* [*    **  *] */
-     15,   0,   0,   0,   0,  15,  15,   0,   0,  15,       /* [*    **  *] */
-     15,   0,   0,   0,   0,  12,  12,   0,   0,  15,       /* [*    **  *] */
-     15,   0,   0,   0,   1,   0,   0,   0,   0,  15,       /* [*        *] */
-     15,   0,   0,  11,  15,  11,   0,   0,   0,  15,       /* [*  ***   *] */
-     15,   0,   4,  15,  15,  15,   3,   0,   0,  15,       /* [*  ***   *] */
-     15,   0,  12,  15,  15,  10,  10,   0,   0,  15,       /* [* *****  *] */
-     15,   5,  15,  15,  11,   3,  15,   1,   0,  15,       /* [* *** *  *] */
-     15,  15,  15,  15,   6,   0,  13,   7,   0,  15,       /* [***** ** *] */
-     15,  15,  15,  15,   1,   0,   8,  13,   0,  15,       /* [****  ** *] */
-     15,  15,  15,  11,   0,   0,   2,  15,   5,  15,       /* [****   * *] */
-     13,  15,  14,   3,   0,   0,   0,  10,  15,  14,       /* [***    ***] */
+    0x20, 0x00, 0x02, 0x20, 0x01,                           /* [          ] */
+    0xf0, 0x00, 0x0f, 0xf0, 0x0e,                           /* [*    **  *] */
+    0xf0, 0x00, 0x0f, 0xf0, 0x0f,                           /* [*    **  *] */
+    0xf0, 0x00, 0x0f, 0xf0, 0x0f,                           /* [*    **  *] */
+    0xf0, 0x00, 0x0c, 0xc0, 0x0f,                           /* [*    **  *] */
+    0xf0, 0x00, 0x10, 0x00, 0x0f,                           /* [*        *] */
+    0xf0, 0x0b, 0xfb, 0x00, 0x0f,                           /* [*  ***   *] */
+    0xf0, 0x4f, 0xff, 0x30, 0x0f,                           /* [*  ***   *] */
+    0xf0, 0xcf, 0xfa, 0xa0, 0x0f,                           /* [* *****  *] */
+    0xf5, 0xff, 0xb3, 0xf1, 0x0f,                           /* [* *** *  *] */
+    0xff, 0xff, 0x60, 0xd7, 0x0f,                           /* [***** ** *] */
+    0xff, 0xff, 0x10, 0x8d, 0x0f,                           /* [****  ** *] */
+    0xff, 0xfb, 0x00, 0x2f, 0x5f,                           /* [****   * *] */
+    0xdf, 0xe3, 0x00, 0x0a, 0xfe,                           /* [***    ***] */
 };
 
 const uint8_t checkbook_12_0x58[] __attribute__((__progmem__)) = {   /* 'X' width: 9 */
-      2,   0,   0,   0,   0,   0,   1,                      /* [       ] */
-     14,   0,   0,   0,   0,   0,  14,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     13,   8,   0,   0,   0,   7,  14,                      /* [**   **] */
-      2,  13,  11,   5,  11,  14,   3,                      /* [ ** ** ] */
-      0,   3,  15,  15,  15,   3,   0,                      /* [  ***  ] */
-      0,   6,  15,  15,  15,   5,   0,                      /* [ ****  ] */
-      4,  15,  10,   4,  10,  15,   4,                      /* [ ** ** ] */
-     14,   6,   0,   0,   0,   6,  14,                      /* [**   **] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     12,   0,   0,   0,   0,   0,  12,                      /* [*     *] */
+    0x20, 0x00, 0x00, 0x10,                                 /* [       ] */
+    0xe0, 0x00, 0x00, 0xe0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xd8, 0x00, 0x07, 0xe0,                                 /* [**   **] */
+    0x2d, 0xb5, 0xbe, 0x30,                                 /* [ ** ** ] */
+    0x03, 0xff, 0xf3, 0x00,                                 /* [  ***  ] */
+    0x06, 0xff, 0xf5, 0x00,                                 /* [ ****  ] */
+    0x4f, 0xa4, 0xaf, 0x40,                                 /* [ ** ** ] */
+    0xe6, 0x00, 0x06, 0xe0,                                 /* [**   **] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xc0, 0x00, 0x00, 0xc0,                                 /* [*     *] */
 };
 
 const uint8_t checkbook_12_0x59[] __attribute__((__progmem__)) = {   /* 'Y' width: 9 */
-      0,   0,   0,   0,   0,   0,   1,                      /* [       ] */
-     14,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   0,   0,   0,   0,   0,  15,                      /* [*     *] */
-     15,   1,   0,   0,   0,   2,  15,                      /* [*     *] */
-     11,   9,   0,   2,   8,  14,  11,                      /* [**  ***] */
-      0,  11,  11,  15,  11,   4,   0,                      /* [ ****  ] */
-      0,   1,  15,   6,   0,   0,   0,                      /* [  **   ] */
-      0,   0,  15,   0,   0,   0,   0,                      /* [  *    ] */
-      0,   0,  15,   0,   0,   0,   0,                      /* [  *    ] */
-      0,   0,  15,   0,   0,   0,   0,                      /* [  *    ] */
-      0,   0,  15,   0,   0,   0,   0,                      /* [  *    ] */
-      0,   0,  14,   0,   0,   0,   0,                      /* [  *    ] */
+    0x00, 0x00, 0x00, 0x10,                                 /* [       ] */
+    0xe0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf0, 0x00, 0x00, 0xf0,                                 /* [*     *] */
+    0xf1, 0x00, 0x02, 0xf0,                                 /* [*     *] */
+    0xb9, 0x02, 0x8e, 0xb0,                                 /* [**  ***] */
+    0x0b, 0xbf, 0xb4, 0x00,                                 /* [ ****  ] */
+    0x01, 0xf6, 0x00, 0x00,                                 /* [  **   ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *    ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *    ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *    ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *    ] */
+    0x00, 0xe0, 0x00, 0x00,                                 /* [  *    ] */
 };
 
 const uint8_t checkbook_12_0x5a[] __attribute__((__progmem__)) = {   /* 'Z' width: 10 */
-     14,  15,  15,  15,  15,  15,  15,  11,                 /* [********] */
-     15,   4,   0,   0,   0,   0,  13,   4,                 /* [*     * ] */
-     15,   0,   0,   0,   0,   5,  11,   0,                 /* [*     * ] */
-     13,   0,   0,   0,   0,  14,   3,   0,                 /* [*    *  ] */
-      0,   0,   0,   0,   8,  10,   0,   0,                 /* [    **  ] */
-      0,   0,   0,   1,  14,   2,   0,   0,                 /* [    *   ] */
-      0,   0,   0,  10,   9,   0,   0,   0,                 /* [   **   ] */
-      0,   0,   3,  15,   1,   0,   0,   0,                 /* [   *    ] */
-      0,   0,  12,   7,   0,   0,   3,   4,                 /* [  **    ] */
-      0,   5,  14,   0,   0,   0,  15,  15,                 /* [  *   **] */
-      0,  13,   6,   0,   0,   0,  15,  15,                 /* [ **   **] */
-      7,  14,   0,   0,   0,   0,  15,  15,                 /* [**    **] */
-     13,  15,  15,  15,  15,  15,  15,  14,                 /* [********] */
-      0,   0,   0,   0,   0,   0,   0,   0,                 /* [        ] */
+    0xef, 0xff, 0xff, 0xfb,                                 /* [********] */
+    0xf4, 0x00, 0x00, 0xd4,                                 /* [*     * ] */
+    0xf0, 0x00, 0x05, 0xb0,                                 /* [*     * ] */
+    0xd0, 0x00, 0x0e, 0x30,                                 /* [*    *  ] */
+    0x00, 0x00, 0x8a, 0x00,                                 /* [    **  ] */
+    0x00, 0x01, 0xe2, 0x00,                                 /* [    *   ] */
+    0x00, 0x0a, 0x90, 0x00,                                 /* [   **   ] */
+    0x00, 0x3f, 0x10, 0x00,                                 /* [   *    ] */
+    0x00, 0xc7, 0x00, 0x34,                                 /* [  **    ] */
+    0x05, 0xe0, 0x00, 0xff,                                 /* [  *   **] */
+    0x0d, 0x60, 0x00, 0xff,                                 /* [ **   **] */
+    0x7e, 0x00, 0x00, 0xff,                                 /* [**    **] */
+    0xdf, 0xff, 0xff, 0xfe,                                 /* [********] */
+    0x00, 0x00, 0x00, 0x00,                                 /* [        ] */
 };
 
 const uint8_t checkbook_12_0x61[] __attribute__((__progmem__)) = {   /* 'a' width: 6 */
-      6,  15,  15,  14,                                     /* [****] */
-      6,   0,   0,  15,                                     /* [*  *] */
-      6,   0,   0,  15,                                     /* [*  *] */
-      7,  15,  15,  15,                                     /* [****] */
-     14,   0,   1,  15,                                     /* [*  *] */
-     15,   0,   0,  15,                                     /* [*  *] */
-     15,   0,   0,  15,                                     /* [*  *] */
-     14,   0,   0,  13,                                     /* [*  *] */
+    0x6f, 0xfe,                                             /* [****] */
+    0x60, 0x0f,                                             /* [*  *] */
+    0x60, 0x0f,                                             /* [*  *] */
+    0x7f, 0xff,                                             /* [****] */
+    0xe0, 0x1f,                                             /* [*  *] */
+    0xf0, 0x0f,                                             /* [*  *] */
+    0xf0, 0x0f,                                             /* [*  *] */
+    0xe0, 0x0d,                                             /* [*  *] */
 };
 
 const uint8_t checkbook_12_0x62[] __attribute__((__progmem__)) = {   /* 'b' width: 6 */
-     15,  15,  15,  14,                                     /* [****] */
-     15,   0,   0,  15,                                     /* [*  *] */
-     15,   0,   1,  15,                                     /* [*  *] */
-     15,  15,  15,  14,                                     /* [****] */
-     15,   1,   0,  14,                                     /* [*  *] */
-     15,   0,   0,  15,                                     /* [*  *] */
-     15,   1,   0,  13,                                     /* [*  *] */
-     15,  15,  15,  14,                                     /* [****] */
+    0xff, 0xfe,                                             /* [****] */
+    0xf0, 0x0f,                                             /* [*  *] */
+    0xf0, 0x1f,                                             /* [*  *] */
+    0xff, 0xfe,                                             /* [****] */
+    0xf1, 0x0e,                                             /* [*  *] */
+    0xf0, 0x0f,                                             /* [*  *] */
+    0xf1, 0x0d,                                             /* [*  *] */
+    0xff, 0xfe,                                             /* [****] */
 };
 
 const uint8_t checkbook_12_0x63[] __attribute__((__progmem__)) = {   /* 'c' width: 6 */
-     14,  15,  15,  15,  15,                                /* [*****] */
-     15,   2,   0,   1,  15,                                /* [*   *] */
-     15,   0,   0,   0,   9,                                /* [*   *] */
-     15,   0,   0,   0,   0,                                /* [*    ] */
-     15,   0,   0,   0,   0,                                /* [*    ] */
-     15,   0,   0,   0,   4,                                /* [*    ] */
-     15,   1,   0,   0,   8,                                /* [*   *] */
-     14,  15,  15,  15,  14,                                /* [*****] */
+    0xef, 0xff, 0xf0,                                       /* [*****] */
+    0xf2, 0x01, 0xf0,                                       /* [*   *] */
+    0xf0, 0x00, 0x90,                                       /* [*   *] */
+    0xf0, 0x00, 0x00,                                       /* [*    ] */
+    0xf0, 0x00, 0x00,                                       /* [*    ] */
+    0xf0, 0x00, 0x40,                                       /* [*    ] */
+    0xf1, 0x00, 0x80,                                       /* [*   *] */
+    0xef, 0xff, 0xe0,                                       /* [*****] */
 };
 
 const uint8_t checkbook_12_0x64[] __attribute__((__progmem__)) = {   /* 'd' width: 6 */
-     15,  15,  15,   8,                                     /* [****] */
-     15,   1,   2,  15,                                     /* [*  *] */
-     15,   0,   0,  15,                                     /* [*  *] */
-     15,   0,   0,  15,                                     /* [*  *] */
-     15,   0,   0,  15,                                     /* [*  *] */
-     15,   0,   0,  15,                                     /* [*  *] */
-     15,   1,   2,  14,                                     /* [*  *] */
-     15,  15,  14,   4,                                     /* [*** ] */
+    0xff, 0xf8,                                             /* [****] */
+    0xf1, 0x2f,                                             /* [*  *] */
+    0xf0, 0x0f,                                             /* [*  *] */
+    0xf0, 0x0f,                                             /* [*  *] */
+    0xf0, 0x0f,                                             /* [*  *] */
+    0xf0, 0x0f,                                             /* [*  *] */
+    0xf1, 0x2e,                                             /* [*  *] */
+    0xff, 0xe4,                                             /* [*** ] */
 };
 
 const uint8_t checkbook_12_0x65[] __attribute__((__progmem__)) = {   /* 'e' width: 5 */
-     15,  15,  15,   9,                                     /* [****] */
-      8,   0,   0,   0,                                     /* [*   ] */
-      8,   0,   0,   0,                                     /* [*   ] */
-     15,  15,  15,   9,                                     /* [****] */
-     15,   1,   0,   0,                                     /* [*   ] */
-     15,   0,   0,   0,                                     /* [*   ] */
-     15,   1,   0,   0,                                     /* [*   ] */
-     15,  15,  15,   9,                                     /* [****] */
+    0xff, 0xf9,                                             /* [****] */
+    0x80, 0x00,                                             /* [*   ] */
+    0x80, 0x00,                                             /* [*   ] */
+    0xff, 0xf9,                                             /* [****] */
+    0xf1, 0x00,                                             /* [*   ] */
+    0xf0, 0x00,                                             /* [*   ] */
+    0xf1, 0x00,                                             /* [*   ] */
+    0xff, 0xf9,                                             /* [****] */
 };
 
 const uint8_t checkbook_12_0x66[] __attribute__((__progmem__)) = {   /* 'f' width: 5 */
-     14,  15,  15,  15,   9,                                /* [*****] */
-     15,  15,   1,   0,   0,                                /* [**   ] */
-     15,  15,   1,   0,   0,                                /* [**   ] */
-      3,  15,  15,  15,   8,                                /* [ ****] */
-      0,  15,   1,   0,   0,                                /* [ *   ] */
-      0,  15,   0,   0,   0,                                /* [ *   ] */
-      0,  15,   0,   0,   0,                                /* [ *   ] */
-      0,  14,   0,   0,   0,                                /* [ *   ] */
+    0xef, 0xff, 0x90,                                       /* [*****] */
+    0xff, 0x10, 0x00,                                       /* [**   ] */
+    0xff, 0x10, 0x00,                                       /* [**   ] */
+    0x3f, 0xff, 0x80,                                       /* [ ****] */
+    0x0f, 0x10, 0x00,                                       /* [ *   ] */
+    0x0f, 0x00, 0x00,                                       /* [ *   ] */
+    0x0f, 0x00, 0x00,                                       /* [ *   ] */
+    0x0e, 0x00, 0x00,                                       /* [ *   ] */
 };
 
 const uint8_t checkbook_12_0x67[] __attribute__((__progmem__)) = {   /* 'g' width: 6 */
-     15,  15,  15,  12,                                     /* [****] */
-     15,   0,   9,  13,                                     /* [* **] */
-     15,   0,   0,   0,                                     /* [*   ] */
-     15,   0,  10,  14,                                     /* [* **] */
-     15,   0,   1,  15,                                     /* [*  *] */
-     15,   0,   0,  15,                                     /* [*  *] */
-     15,   0,   1,  15,                                     /* [*  *] */
-     15,  15,  15,  14,                                     /* [****] */
+    0xff, 0xfc,                                             /* [****] */
+    0xf0, 0x9d,                                             /* [* **] */
+    0xf0, 0x00,                                             /* [*   ] */
+    0xf0, 0xae,                                             /* [* **] */
+    0xf0, 0x1f,                                             /* [*  *] */
+    0xf0, 0x0f,                                             /* [*  *] */
+    0xf0, 0x1f,                                             /* [*  *] */
+    0xff, 0xfe,                                             /* [****] */
 };
 
 const uint8_t checkbook_12_0x68[] __attribute__((__progmem__)) = {   /* 'h' width: 6 */
-     13,   0,   0,   1,   5,                                /* [*    ] */
-     15,   0,   0,   2,   7,                                /* [*   *] */
-     15,   0,   0,   2,   7,                                /* [*   *] */
-     15,   1,   0,   2,   7,                                /* [*   *] */
-     15,  15,  15,  15,  15,                                /* [*****] */
-     15,  14,   0,   0,  15,                                /* [**  *] */
-     15,  13,   0,   0,  15,                                /* [**  *] */
-     15,  12,   0,   0,  15,                                /* [**  *] */
+    0xd0, 0x01, 0x50,                                       /* [*    ] */
+    0xf0, 0x02, 0x70,                                       /* [*   *] */
+    0xf0, 0x02, 0x70,                                       /* [*   *] */
+    0xf1, 0x02, 0x70,                                       /* [*   *] */
+    0xff, 0xff, 0xf0,                                       /* [*****] */
+    0xfe, 0x00, 0xf0,                                       /* [**  *] */
+    0xfd, 0x00, 0xf0,                                       /* [**  *] */
+    0xfc, 0x00, 0xf0,                                       /* [**  *] */
 };
 
 const uint8_t checkbook_12_0x69[] __attribute__((__progmem__)) = {   /* 'i' width: 3 */
-      0,   0,  12,                                          /* [  *] */
-      0,   0,  15,                                          /* [  *] */
-      0,   0,  15,                                          /* [  *] */
-      0,   0,  15,                                          /* [  *] */
-      0,  12,  15,                                          /* [ **] */
-      0,  15,  15,                                          /* [ **] */
-      0,  15,  15,                                          /* [ **] */
-      0,  15,  15,                                          /* [ **] */
+    0x00, 0xc0,                                             /* [  *] */
+    0x00, 0xf0,                                             /* [  *] */
+    0x00, 0xf0,                                             /* [  *] */
+    0x00, 0xf0,                                             /* [  *] */
+    0x0c, 0xf0,                                             /* [ **] */
+    0x0f, 0xf0,                                             /* [ **] */
+    0x0f, 0xf0,                                             /* [ **] */
+    0x0f, 0xf0,                                             /* [ **] */
 };
 
 const uint8_t checkbook_12_0x6a[] __attribute__((__progmem__)) = {   /* 'j' width: 7 */
-      0,   0,   0,   0,   6,                                /* [    *] */
-      0,   0,   0,   0,   7,                                /* [    *] */
-      0,   0,   0,   0,   7,                                /* [    *] */
-      0,   0,   0,   0,  11,                                /* [    *] */
-      0,   0,   0,   0,  15,                                /* [    *] */
-      8,   0,   0,   0,  15,                                /* [*   *] */
-     15,   0,   0,   1,  15,                                /* [*   *] */
-     15,  15,  15,  15,  15,                                /* [*****] */
+    0x00, 0x00, 0x60,                                       /* [    *] */
+    0x00, 0x00, 0x70,                                       /* [    *] */
+    0x00, 0x00, 0x70,                                       /* [    *] */
+    0x00, 0x00, 0xb0,                                       /* [    *] */
+    0x00, 0x00, 0xf0,                                       /* [    *] */
+    0x80, 0x00, 0xf0,                                       /* [*   *] */
+    0xf0, 0x01, 0xf0,                                       /* [*   *] */
+    0xff, 0xff, 0xf0,                                       /* [*****] */
 };
 
 const uint8_t checkbook_12_0x6b[] __attribute__((__progmem__)) = {   /* 'k' width: 7 */
-      7,   0,   0,   3,   8,   0,                           /* [*   * ] */
-      8,   0,   7,   8,   0,   0,                           /* [* **  ] */
-     10,  12,   6,   0,   0,   0,                           /* [***   ] */
-     15,  15,  15,  15,  15,   0,                           /* [***** ] */
-     15,   1,   0,   1,  15,   0,                           /* [*   * ] */
-     15,   0,   0,   0,  15,   0,                           /* [*   * ] */
-     15,   0,   0,   0,  15,   0,                           /* [*   * ] */
-     14,   0,   0,   0,  15,   0,                           /* [*   * ] */
+    0x70, 0x03, 0x80,                                       /* [*   * ] */
+    0x80, 0x78, 0x00,                                       /* [* **  ] */
+    0xac, 0x60, 0x00,                                       /* [***   ] */
+    0xff, 0xff, 0xf0,                                       /* [***** ] */
+    0xf1, 0x01, 0xf0,                                       /* [*   * ] */
+    0xf0, 0x00, 0xf0,                                       /* [*   * ] */
+    0xf0, 0x00, 0xf0,                                       /* [*   * ] */
+    0xe0, 0x00, 0xf0,                                       /* [*   * ] */
 };
 
 const uint8_t checkbook_12_0x6c[] __attribute__((__progmem__)) = {   /* 'l' width: 5 */
-      0,   0,  13,   0,   0,   0,                           /* [  *   ] */
-      0,   0,  15,   0,   0,   0,                           /* [  *   ] */
-      0,   0,  15,   0,   0,   0,                           /* [  *   ] */
-      0,   0,  15,   0,   0,   0,                           /* [  *   ] */
-      0,  12,  15,   0,   0,   0,                           /* [ **   ] */
-      0,  15,  15,   0,   0,   0,                           /* [ **   ] */
-      0,  15,  15,   0,   0,   0,                           /* [ **   ] */
-      0,  15,  15,  15,  15,   9,                           /* [ *****] */
+    0x00, 0xd0, 0x00,                                       /* [  *   ] */
+    0x00, 0xf0, 0x00,                                       /* [  *   ] */
+    0x00, 0xf0, 0x00,                                       /* [  *   ] */
+    0x00, 0xf0, 0x00,                                       /* [  *   ] */
+    0x0c, 0xf0, 0x00,                                       /* [ **   ] */
+    0x0f, 0xf0, 0x00,                                       /* [ **   ] */
+    0x0f, 0xf0, 0x00,                                       /* [ **   ] */
+    0x0f, 0xff, 0xf9,                                       /* [ *****] */
 };
 
 const uint8_t checkbook_12_0x6d[] __attribute__((__progmem__)) = {   /* 'm' width: 7 */
-     14,  14,  10,   0,  11,  14,                           /* [*** **] */
-     15,   1,  14,   4,   8,  15,                           /* [* * **] */
-     15,   0,   5,  15,   1,  15,                           /* [*  * *] */
-     15,   0,   0,   5,   0,  15,                           /* [*    *] */
-     15,   0,   0,   0,   0,  15,                           /* [*    *] */
-     15,   0,   0,   0,   0,  15,                           /* [*    *] */
-     15,   0,   0,  15,   0,  15,                           /* [*  * *] */
-     13,   0,   0,  15,   0,  15,                           /* [*  * *] */
-      0,   0,   0,   0,   0,   0,                           /* [      ] */
+    0xee, 0xa0, 0xbe,                                       /* [*** **] */
+    0xf1, 0xe4, 0x8f,                                       /* [* * **] */
+    0xf0, 0x5f, 0x1f,                                       /* [*  * *] */
+    0xf0, 0x05, 0x0f,                                       /* [*    *] */
+    0xf0, 0x00, 0x0f,                                       /* [*    *] */
+    0xf0, 0x00, 0x0f,                                       /* [*    *] */
+    0xf0, 0x0f, 0x0f,                                       /* [*  * *] */
+    0xd0, 0x0f, 0x0f,                                       /* [*  * *] */
+    0x00, 0x00, 0x00,                                       /* [      ] */
 };
 
 const uint8_t checkbook_12_0x6e[] __attribute__((__progmem__)) = {   /* 'n' width: 7 */
-     14,  14,  13,   0,   0,  12,                           /* [***  *] */
-     15,   0,  12,   7,   0,  15,                           /* [* ** *] */
-     15,   0,   2,  14,   2,  15,                           /* [*  * *] */
-     15,   0,   0,   4,  12,  15,                           /* [*   **] */
-     15,   0,   0,   0,   7,  15,                           /* [*   **] */
-     15,   0,   0,   0,   0,  15,                           /* [*    *] */
-     15,   0,   0,  15,   0,  15,                           /* [*  * *] */
-     14,   0,   0,  15,   0,  14,                           /* [*  * *] */
+    0xee, 0xd0, 0x0c,                                       /* [***  *] */
+    0xf0, 0xc7, 0x0f,                                       /* [* ** *] */
+    0xf0, 0x2e, 0x2f,                                       /* [*  * *] */
+    0xf0, 0x04, 0xcf,                                       /* [*   **] */
+    0xf0, 0x00, 0x7f,                                       /* [*   **] */
+    0xf0, 0x00, 0x0f,                                       /* [*    *] */
+    0xf0, 0x0f, 0x0f,                                       /* [*  * *] */
+    0xe0, 0x0f, 0x0e,                                       /* [*  * *] */
 };
 
 const uint8_t checkbook_12_0x6f[] __attribute__((__progmem__)) = {   /* 'o' width: 6 */
-     14,  15,  15,  15,  15,                                /* [*****] */
-     15,   1,   0,   0,   7,                                /* [*   *] */
-     15,   0,   0,   0,   7,                                /* [*   *] */
-     15,   0,   0,   0,  12,                                /* [*   *] */
-     15,   0,   0,   0,  15,                                /* [*   *] */
-     15,   0,   0,   0,  15,                                /* [*   *] */
-     15,   1,   0,   1,  15,                                /* [*   *] */
-     14,  15,  15,  15,  15,                                /* [*****] */
+    0xef, 0xff, 0xf0,                                       /* [*****] */
+    0xf1, 0x00, 0x70,                                       /* [*   *] */
+    0xf0, 0x00, 0x70,                                       /* [*   *] */
+    0xf0, 0x00, 0xc0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xf1, 0x01, 0xf0,                                       /* [*   *] */
+    0xef, 0xff, 0xf0,                                       /* [*****] */
 };
 
 const uint8_t checkbook_12_0x70[] __attribute__((__progmem__)) = {   /* 'p' width: 6 */
-     15,  15,  15,  14,                                     /* [****] */
-      8,   0,   0,  15,                                     /* [*  *] */
-      7,   0,   0,  15,                                     /* [*  *] */
-     15,  15,  15,  14,                                     /* [****] */
-     15,   0,   0,   0,                                     /* [*   ] */
-     15,   0,   0,   0,                                     /* [*   ] */
-     15,   0,   0,   0,                                     /* [*   ] */
-     15,   0,   0,   0,                                     /* [*   ] */
+    0xff, 0xfe,                                             /* [****] */
+    0x80, 0x0f,                                             /* [*  *] */
+    0x70, 0x0f,                                             /* [*  *] */
+    0xff, 0xfe,                                             /* [****] */
+    0xf0, 0x00,                                             /* [*   ] */
+    0xf0, 0x00,                                             /* [*   ] */
+    0xf0, 0x00,                                             /* [*   ] */
+    0xf0, 0x00,                                             /* [*   ] */
 };
 
 const uint8_t checkbook_12_0x71[] __attribute__((__progmem__)) = {   /* 'q' width: 6 */
-     15,  15,  15,  14,                                     /* [****] */
-      9,   0,   1,  15,                                     /* [*  *] */
-     11,   0,   0,  15,                                     /* [*  *] */
-     15,   0,   0,  15,                                     /* [*  *] */
-     15,   0,   0,  15,                                     /* [*  *] */
-     15,   0,   1,  15,                                     /* [*  *] */
-     15,   0,   9,  15,                                     /* [* **] */
-     14,  15,  15,  13,                                     /* [****] */
-      0,   0,   9,   1,                                     /* [  * ] */
-      0,   0,   0,   0,                                     /* [    ] */
+    0xff, 0xfe,                                             /* [****] */
+    0x90, 0x1f,                                             /* [*  *] */
+    0xb0, 0x0f,                                             /* [*  *] */
+    0xf0, 0x0f,                                             /* [*  *] */
+    0xf0, 0x0f,                                             /* [*  *] */
+    0xf0, 0x1f,                                             /* [*  *] */
+    0xf0, 0x9f,                                             /* [* **] */
+    0xef, 0xfd,                                             /* [****] */
+    0x00, 0x91,                                             /* [  * ] */
+    0x00, 0x00,                                             /* [    ] */
 };
 
 const uint8_t checkbook_12_0x72[] __attribute__((__progmem__)) = {   /* 'r' width: 7 */
-     15,  15,  15,  15,   7,                                /* [*****] */
-      7,   0,   0,   0,   7,                                /* [*   *] */
-      7,   0,   0,   1,   8,                                /* [*   *] */
-     15,  15,  15,  15,  15,                                /* [*****] */
-     15,   1,   0,   1,  15,                                /* [*   *] */
-     15,   0,   0,   0,  15,                                /* [*   *] */
-     15,   0,   0,   0,  15,                                /* [*   *] */
-     15,   0,   0,   0,  14,                                /* [*   *] */
+    0xff, 0xff, 0x70,                                       /* [*****] */
+    0x70, 0x00, 0x70,                                       /* [*   *] */
+    0x70, 0x01, 0x80,                                       /* [*   *] */
+    0xff, 0xff, 0xf0,                                       /* [*****] */
+    0xf1, 0x01, 0xf0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xf0, 0x00, 0xe0,                                       /* [*   *] */
 };
 
 const uint8_t checkbook_12_0x73[] __attribute__((__progmem__)) = {   /* 's' width: 6 */
-     14,  15,  15,  15,  14,                                /* [*****] */
-     15,   1,   0,   0,  14,                                /* [*   *] */
-     15,   1,   0,   0,   0,                                /* [*    ] */
-     14,  15,  15,  15,  14,                                /* [*****] */
-      0,   0,   0,   0,  15,                                /* [    *] */
-     11,  10,   0,   0,  15,                                /* [**  *] */
-     15,  14,   0,   1,  15,                                /* [**  *] */
-     14,  15,  15,  15,  15,                                /* [*****] */
+    0xef, 0xff, 0xe0,                                       /* [*****] */
+    0xf1, 0x00, 0xe0,                                       /* [*   *] */
+    0xf1, 0x00, 0x00,                                       /* [*    ] */
+    0xef, 0xff, 0xe0,                                       /* [*****] */
+    0x00, 0x00, 0xf0,                                       /* [    *] */
+    0xba, 0x00, 0xf0,                                       /* [**  *] */
+    0xfe, 0x01, 0xf0,                                       /* [**  *] */
+    0xef, 0xff, 0xf0,                                       /* [*****] */
 };
 
 const uint8_t checkbook_12_0x74[] __attribute__((__progmem__)) = {   /* 't' width: 6 */
-      8,  15,  15,  15,  15,  10,                           /* [******] */
-      0,   0,   1,  15,   0,   0,                           /* [   *  ] */
-      0,   0,   0,  15,   0,   0,                           /* [   *  ] */
-      0,   0,   0,  15,   0,   0,                           /* [   *  ] */
-      0,   0,   0,  15,   0,   0,                           /* [   *  ] */
-      0,   0,   0,  15,   0,   0,                           /* [   *  ] */
-      0,   0,   0,  15,   0,   0,                           /* [   *  ] */
-      0,   0,   0,  15,   0,   0,                           /* [   *  ] */
+    0x8f, 0xff, 0xfa,                                       /* [******] */
+    0x00, 0x1f, 0x00,                                       /* [   *  ] */
+    0x00, 0x0f, 0x00,                                       /* [   *  ] */
+    0x00, 0x0f, 0x00,                                       /* [   *  ] */
+    0x00, 0x0f, 0x00,                                       /* [   *  ] */
+    0x00, 0x0f, 0x00,                                       /* [   *  ] */
+    0x00, 0x0f, 0x00,                                       /* [   *  ] */
+    0x00, 0x0f, 0x00,                                       /* [   *  ] */
 };
 
 const uint8_t checkbook_12_0x75[] __attribute__((__progmem__)) = {   /* 'u' width: 6 */
-     13,   0,   0,   0,  14,                                /* [*   *] */
-     15,   0,   0,   0,  15,                                /* [*   *] */
-     15,   0,   0,   0,  15,                                /* [*   *] */
-     15,   0,   0,   0,  15,                                /* [*   *] */
-     15,   0,   0,   0,  15,                                /* [*   *] */
-     15,   0,   0,   0,  15,                                /* [*   *] */
-     15,   1,   0,   1,  15,                                /* [*   *] */
-     14,  15,  15,  15,  15,                                /* [*****] */
+    0xd0, 0x00, 0xe0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xf1, 0x01, 0xf0,                                       /* [*   *] */
+    0xef, 0xff, 0xf0,                                       /* [*****] */
 };
 
 const uint8_t checkbook_12_0x76[] __attribute__((__progmem__)) = {   /* 'v' width: 6 */
-     13,   0,   0,   0,  15,                                /* [*   *] */
-     15,   0,   0,   0,  15,                                /* [*   *] */
-     15,   0,   0,   0,  15,                                /* [*   *] */
-     15,   0,   0,   0,  15,                                /* [*   *] */
-     15,   0,   0,   0,  15,                                /* [*   *] */
-     11,   6,   0,   0,  15,                                /* [**  *] */
-      0,  12,   4,   1,   9,                                /* [ *  *] */
-      0,   1,  13,   8,   0,                                /* [  ** ] */
+    0xd0, 0x00, 0xf0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xb6, 0x00, 0xf0,                                       /* [**  *] */
+    0x0c, 0x41, 0x90,                                       /* [ *  *] */
+    0x01, 0xd8, 0x00,                                       /* [  ** ] */
 };
 
 const uint8_t checkbook_12_0x77[] __attribute__((__progmem__)) = {   /* 'w' width: 7 */
-      0,   0,   0,   0,   0,                                /* [     ] */
-     15,   0,   0,  15,  13,                                /* [*  **] */
-     15,   0,   0,  15,  15,                                /* [*  **] */
-     15,   0,   4,   1,  15,                                /* [*   *] */
-     15,   1,  15,   7,  15,                                /* [* ***] */
-     15,   6,  15,   8,  15,                                /* [*****] */
-     15,  13,  10,   5,  15,                                /* [*** *] */
-     15,  15,   2,   3,  15,                                /* [**  *] */
-     15,   7,   0,   0,  15,                                /* [**  *] */
+    0x00, 0x00, 0x00,                                       /* [     ] */
+    0xf0, 0x0f, 0xd0,                                       /* [*  **] */
+    0xf0, 0x0f, 0xf0,                                       /* [*  **] */
+    0xf0, 0x41, 0xf0,                                       /* [*   *] */
+    0xf1, 0xf7, 0xf0,                                       /* [* ***] */
+    0xf6, 0xf8, 0xf0,                                       /* [*****] */
+    0xfd, 0xa5, 0xf0,                                       /* [*** *] */
+    0xff, 0x23, 0xf0,                                       /* [**  *] */
+    0xf7, 0x00, 0xf0,                                       /* [**  *] */
 };
 
 const uint8_t checkbook_12_0x78[] __attribute__((__progmem__)) = {   /* 'x' width: 6 */
-     13,   0,   0,   0,  12,                                /* [*   *] */
-     15,   0,   0,   0,  14,                                /* [*   *] */
-     10,   9,   0,   8,  10,                                /* [** **] */
-      0,   9,  15,   9,   0,                                /* [ *** ] */
-      3,  13,   9,  12,   3,                                /* [ *** ] */
-     15,   2,   0,   2,  14,                                /* [*   *] */
-     15,   0,   0,   0,  15,                                /* [*   *] */
-     13,   0,   0,   0,  13,                                /* [*   *] */
+    0xd0, 0x00, 0xc0,                                       /* [*   *] */
+    0xf0, 0x00, 0xe0,                                       /* [*   *] */
+    0xa9, 0x08, 0xa0,                                       /* [** **] */
+    0x09, 0xf9, 0x00,                                       /* [ *** ] */
+    0x3d, 0x9c, 0x30,                                       /* [ *** ] */
+    0xf2, 0x02, 0xe0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xd0, 0x00, 0xd0,                                       /* [*   *] */
 };
 
 const uint8_t checkbook_12_0x79[] __attribute__((__progmem__)) = {   /* 'y' width: 6 */
-     12,   0,   0,   0,  13,                                /* [*   *] */
-     15,   0,   0,   0,  15,                                /* [*   *] */
-     15,   0,   0,   0,  15,                                /* [*   *] */
-     10,   9,   0,   8,  10,                                /* [** **] */
-      0,   4,  15,   5,   0,                                /* [  *  ] */
-      0,   0,  15,   0,   0,                                /* [  *  ] */
-      0,   0,  15,   0,   0,                                /* [  *  ] */
-      0,   0,  15,   0,   0,                                /* [  *  ] */
+    0xc0, 0x00, 0xd0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xa9, 0x08, 0xa0,                                       /* [** **] */
+    0x04, 0xf5, 0x00,                                       /* [  *  ] */
+    0x00, 0xf0, 0x00,                                       /* [  *  ] */
+    0x00, 0xf0, 0x00,                                       /* [  *  ] */
+    0x00, 0xf0, 0x00,                                       /* [  *  ] */
 };
 
 const uint8_t checkbook_12_0x7a[] __attribute__((__progmem__)) = {   /* 'z' width: 6 */
-     14,  15,  15,  15,  13,                                /* [*****] */
-     15,   1,   0,   1,   6,                                /* [*   *] */
-      8,   0,   0,   9,   0,                                /* [*  * ] */
-      0,   0,   6,   5,   0,                                /* [  *  ] */
-      0,   1,  11,   0,   0,                                /* [  *  ] */
-      0,  11,   4,   0,  12,                                /* [ *  *] */
-      6,  11,   0,   0,  15,                                /* [**  *] */
-     13,  15,  15,  15,  15,                                /* [*****] */
-      0,   0,   0,   0,   0,                                /* [     ] */
+    0xef, 0xff, 0xd0,                                       /* [*****] */
+    0xf1, 0x01, 0x60,                                       /* [*   *] */
+    0x80, 0x09, 0x00,                                       /* [*  * ] */
+    0x00, 0x65, 0x00,                                       /* [  *  ] */
+    0x01, 0xb0, 0x00,                                       /* [  *  ] */
+    0x0b, 0x40, 0xc0,                                       /* [ *  *] */
+    0x6b, 0x00, 0xf0,                                       /* [**  *] */
+    0xdf, 0xff, 0xf0,                                       /* [*****] */
+    0x00, 0x00, 0x00,                                       /* [     ] */
 };
 
 
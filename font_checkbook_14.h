@@ -2,1248 +2,1250 @@
  * Font checkbook_14
  *
  * Allen R. Walden Friendly Fonts, free license.
+ *
+ * Glyph rows are packed two pixels per byte, left pixel in the high nibble.
  */
 
 #define CHECKBOOK_14_HEIGHT 19
 
 const uint8_t checkbook_14_0x21[] __attribute__((__progmem__)) = {   /* '!' width: 5 */
-      0,   1,   6,   6,   1,   0,                                /* [  **  ] */
-      0,  12,  15,  15,  13,   0,                                /* [ **** ] */
-      2,  15,  15,  15,  15,   4,                                /* [ **** ] */
-      1,  15,  15,  15,  15,   3,                                /* [ **** ] */
-      0,  14,  15,  15,  15,   0,                                /* [ **** ] */
-      0,  11,  15,  15,  12,   0,                                /* [ **** ] */
-      0,   8,  15,  15,   9,   0,                                /* [ **** ] */
-      0,   5,  15,  15,   5,   0,                                /* [  **  ] */
-      0,   2,  15,  15,   2,   0,                                /* [  **  ] */
-      0,   0,  15,  14,   0,   0,                                /* [  **  ] */
-      0,   0,  11,  10,   0,   0,                                /* [  **  ] */
-      0,   0,   0,   0,   0,   0,                                /* [      ] */
-      0,  12,  15,  15,  13,   0,                                /* [ **** ] */
-      0,  15,  15,  15,  15,   0,                                /* [ **** ] */
-      0,  15,  15,  15,  15,   0,                                /* [ **** ] */
-      0,  13,  15,  15,  14,   0,                                /* [ **** ] */
+    0x01, 0x66, 0x10,                                       /* [  **  ] */
+    0x0c, 0xff, 0xd0,                                       /* [ **** ] */
+    0x2f, 0xff, 0xf4,                                       /* [ **** ] */
+    0x1f, 0xff, 0xf3,                                       /* [ **** ] */
+    0x0e, 0xff, 0xf0,                                       /* [ **** ] */
+    0x0b, 0xff, 0xc0,                                       /* [ **** ] */
+    0x08, 0xff, 0x90,                                       /* [ **** ] */
+    0x05, 0xff, 0x50,                                       /* [  **  ] */
+    0x02, 0xff, 0x20,                                       /* [  **  ] */
+    0x00, 0xfe, 0x00,                                       /* [  **  ] */
+    0x00, 0xba, 0x00,                                       /* [  **  ] */
+    0x00, 0x00, 0x00,                                       /* [      ] */
+    0x0c, 0xff, 0xd0,                                       /* [ **** ] */
+    0x0f, 0xff, 0xf0,                                       /* [ **** ] */
+    0x0f, 0xff, 0xf0,                                       /* [ **** ] */
+    0x0d, 0xff, 0xe0,                                       /* [ **** ] */
 };
 
 const uint8_t checkbook_14_0x24[] __attribute__((__progmem__)) = {   /* '$' width: 9 */
-      0,   0,   2,   0,   2,   1,   0,   0,                      /* [        ] */
-      0,   0,   9,   7,  11,   6,   0,   0,                      /* [  ****  ] */
-      0,  11,  15,  15,  15,  15,  15,  10,                      /* [ *******] */
-      0,  15,  15,  15,  15,  15,  15,  11,                      /* [ *******] */
-      0,  15,  15,  15,  15,  15,   0,   0,                      /* [ *****  ] */
-      0,  15,  15,  15,  15,  15,   0,   0,                      /* [ *****  ] */
-      0,  15,  15,  15,  15,  15,   0,   0,                      /* [ *****  ] */
-      0,  15,  15,  15,  15,  15,   0,   0,                      /* [ *****  ] */
-      0,  15,  15,  15,  15,  15,   6,   3,                      /* [ ****** ] */
-      0,  15,  15,  15,  15,  15,  15,  15,                      /* [ *******] */
-      0,   4,  15,  15,  15,  15,  15,  15,                      /* [  ******] */
-      0,   0,  13,  15,  14,  15,  15,  15,                      /* [  ******] */
-      0,   0,  13,  15,  14,  15,  15,  15,                      /* [  ******] */
-      0,   0,  13,  15,  14,  15,  15,  15,                      /* [  ******] */
-      0,   0,  13,  15,  14,  15,  15,  15,                      /* [  ******] */
-      0,  11,  15,  15,  15,  15,  15,  15,                      /* [ *******] */
-      0,  12,  15,  15,  15,  15,  15,  13,                      /* [ *******] */
-      0,   0,  13,  11,   3,  15,   0,   0,                      /* [  ** *  ] */
-      0,   0,   3,   2,   0,   3,   0,   0,                      /* [        ] */
+    0x00, 0x20, 0x21, 0x00,                                 /* [        ] */
+    0x00, 0x97, 0xb6, 0x00,                                 /* [  ****  ] */
+    0x0b, 0xff, 0xff, 0xfa,                                 /* [ *******] */
+    0x0f, 0xff, 0xff, 0xfb,                                 /* [ *******] */
+    0x0f, 0xff, 0xff, 0x00,                                 /* [ *****  ] */
+    0x0f, 0xff, 0xff, 0x00,                                 /* [ *****  ] */
+    0x0f, 0xff, 0xff, 0x00,                                 /* [ *****  ] */
+    0x0f, 0xff, 0xff, 0x00,                                 /* [ *****  ] */
+    0x0f, 0xff, 0xff, 0x63,                                 /* [ ****** ] */
+    0x0f, 0xff, 0xff, 0xff,                                 /* [ *******] */
+    0x04, 0xff, 0xff, 0xff,                                 /* [  ******] */
+    0x00, 0xdf, 0xef, 0xff,                                 /* [  ******] */
+    0x00, 0xdf, 0xef, 0xff,                                 /* [  ******] */
+    0x00, 0xdf, 0xef, 0xff,                                 /* [  ******] */
+    0x00, 0xdf, 0xef, 0xff,                                 /* [  ******] */
+    0x0b, 0xff, 0xff, 0xff,                                 /* [ *******] */
+    0x0c, 0xff, 0xff, 0xfd,                                 /* [ *******] */
+    0x00, 0xdb, 0x3f, 0x00,                                 /* [  ** *  ] */
+    0x00, 0x32, 0x03, 0x00,                                 /* [        ] */
 };
 
 const uint8_t checkbook_14_0x25[] __attribute__((__progmem__)) = {   /* '%' width: 12 */
-     13,  15,  15,  13,   0,   0,   0,   0,   9,   3,            /* [****    * ] */
-     15,   0,   1,  15,   0,   0,   0,   4,  15,   1,            /* [*  *    * ] */
-     15,   0,   1,  15,   0,   0,   0,  12,   8,   0,            /* [*  *   ** ] */
-     15,   0,  14,  15,   0,   0,   5,  14,   0,   0,            /* [* **   *  ] */
-     15,   0,  15,  15,   0,   0,  13,   7,   0,   0,            /* [* **  **  ] */
-     15,   0,  15,  15,   0,   5,  14,   0,   0,   0,            /* [* **  *   ] */
-     13,  15,  15,  13,   0,  13,   6,   0,   0,   0,            /* [**** **   ] */
-      0,   0,   0,   0,   6,  14,   0,   0,   0,   0,            /* [    **    ] */
-      0,   0,   0,   0,  14,   6,   0,   0,   0,   0,            /* [    **    ] */
-      0,   0,   0,   6,  13,  13,  15,  15,  15,  13,            /* [   *******] */
-      0,   0,   0,  14,   5,  15,   1,   0,   2,  15,            /* [   * *   *] */
-      0,   0,   7,  13,   0,  15,   0,   0,   1,  15,            /* [  ** *   *] */
-      0,   0,  14,   4,   0,  15,   0,   0,  14,  15,            /* [  *  *  **] */
-      0,   7,  12,   0,   0,  15,   0,   0,  15,  15,            /* [ **  *  **] */
-      0,  14,   4,   0,   0,  15,   1,   1,  15,  15,            /* [ *   *  **] */
-      2,   9,   0,   0,   0,  13,  15,  15,  15,  12,            /* [ *   *****] */
+    0xdf, 0xfd, 0x00, 0x00, 0x93,                           /* [****    * ] */
+    0xf0, 0x1f, 0x00, 0x04, 0xf1,                           /* [*  *    * ] */
+    0xf0, 0x1f, 0x00, 0x0c, 0x80,                           /* [*  *   ** ] */
+    0xf0, 0xef, 0x00, 0x5e, 0x00,                           /* [* **   *  ] */
+    0xf0, 0xff, 0x00, 0xd7, 0x00,                           /* [* **  **  ] */
+    0xf0, 0xff, 0x05, 0xe0, 0x00,                           /* [* **  *   ] */
+    0xdf, 0xfd, 0x0d, 0x60, 0x00,                           /* [**** **   ] */
+    0x00, 0x00, 0x6e, 0x00, 0x00,                           /* [    **    ] */
+    0x00, 0x00, 0xe6, 0x00, 0x00,                           /* [    **    ] */
+    0x00, 0x06, 0xdd, 0xff, 0xfd,                           /* [   *******] */
+    0x00, 0x0e, 0x5f, 0x10, 0x2f,                           /* [   * *   *] */
+    0x00, 0x7d, 0x0f, 0x00, 0x1f,                           /* [  ** *   *] */
+    0x00, 0xe4, 0x0f, 0x00, 0xef,                           /* [  *  *  **] */
+    0x07, 0xc0, 0x0f, 0x00, 0xff,                           /* [ **  *  **] */
+    0x0e, 0x40, 0x0f, 0x11, 0xff,                           /* [ *   *  **] */
+    0x29, 0x00, 0x0d, 0xff, 0xfc,                           /* [ *   *****] */
 };
 
 const uint8_t checkbook_14_0x26[] __attribute__((__progmem__)) = {   /* '&' width: 12 */
-      0,   0,   7,  15,  15,  15,  15,  15,  15,  15,  11,   0,  /* [  ********* ] */
-      0,   0,  13,  15,  15,  15,  15,  15,  15,  15,  15,   0,  /* [  ********* ] */
-      0,   0,  13,  15,   3,   0,   0,   0,   3,  15,  15,   0,  /* [  **     ** ] */
-      0,   0,  13,  15,   1,   0,   0,   0,   0,  15,  15,   0,  /* [  **     ** ] */
-      0,   0,  13,  15,   1,   0,   0,   0,   0,  15,  15,   0,  /* [  **     ** ] */
-      0,   0,  13,  15,   1,   0,   0,   0,   0,  15,  15,   0,  /* [  **     ** ] */
-      0,   0,  13,  15,   9,   0,   0,   0,   5,  15,  15,   0,  /* [  ***    ** ] */
-      0,   1,  15,  15,  15,  15,  15,  15,  15,  15,  15,   0,  /* [  ********* ] */
-      9,  15,  15,  15,  15,  15,  15,  15,  15,  15,  10,   0,  /* [*********** ] */
-     15,  15,  15,  15,   9,  15,   2,   0,   0,   0,   0,   0,  /* [******      ] */
-     15,  15,  15,  15,   0,  10,  11,   0,   0,   0,   0,   0,  /* [**** **     ] */
-     15,  15,  15,  15,   0,   1,  14,   6,   0,   0,   0,   0,  /* [****  **    ] */
-     15,  15,  15,  15,   0,   0,   4,  15,   2,   5,   6,   0,  /* [****   *  * ] */
-     15,  15,  15,  15,   0,   0,   0,   9,  14,  15,  14,   0,  /* [****   **** ] */
-     15,  15,  15,  15,   0,   0,   0,   1,  15,  15,  14,   0,  /* [****    *** ] */
-     12,  15,  15,  15,  15,  15,  15,  15,  15,  15,  14,   0,  /* [*********** ] */
-      0,   0,   0,   0,   0,   0,   0,   0,   0,  10,  15,   3,  /* [         ** ] */
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,  /* [            ] */
+    0x00, 0x7f, 0xff, 0xff, 0xff, 0xb0,                     /* [  ********* ] */
+    0x00, 0xdf, 0xff, 0xff, 0xff, 0xf0,                     /* [  ********* ] */
+    0x00, 0xdf, 0x30, 0x00, 0x3f, 0xf0,                     /* [  **     ** ] */
+    0x00, 0xdf, 0x10, 0x00, 0x0f, 0xf0,                     /* [  **     ** ] */
+    0x00, 0xdf, 0x10, 0x00, 0x0f, 0xf0,                     /* [  **     ** ] */
+    0x00, 0xdf, 0x10, 0x00, 0x0f, 0xf0,                     /* [  **     ** ] */
+    0x00, 0xdf, 0x90, 0x00, 0x5f, 0xf0,                     /* [  ***    ** ] */
+    0x01, 0xff, 0xff, 0xff, 0xff, 0xf0,                     /* [  ********* ] */
+    0x9f, 0xff, 0xff, 0xff, 0xff, 0xa0,                     /* [*********** ] */
+    0xff, 0xff, 0x9f, 0x20, 0x00, 0x00,                     /* [******      ] */
+    0xff, 0xff, 0x0a, 0xb0, 0x00, 0x00,                     /* [**** **     ] */
+    0xff, 0xff, 0x01, 0xe6, 0x00, 0x00,                     /* [****  **    ] */
+    0xff, 0xff, 0x00, 0x4f, 0x25, 0x60,                     /* [****   *  * ] */
+    0xff, 0xff, 0x00, 0x09, 0xef, 0xe0,                     /* [****   **** ] */
+    0xff, 0xff, 0x00, 0x01, 0xff, 0xe0,                     /* [****    *** ] */
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xe0,                     /* [*********** ] */
+    0x00, 0x00, 0x00, 0x00, 0x0a, 0xf3,                     /* [         ** ] */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30,                     /* [            ] */
 };
 
 const uint8_t checkbook_14_0x27[] __attribute__((__progmem__)) = {   /* ''' width: 4 */
-      6,   8,   6,                                               /* [***] */
-     15,  15,  15,                                               /* [***] */
-     14,  15,  15,                                               /* [***] */
-      0,  14,  14,                                               /* [ **] */
-      6,  15,   7,                                               /* [***] */
-      5,   4,   0,                                               /* [   ] */
+    0x68, 0x60,                                             /* [***] */
+    0xff, 0xf0,                                             /* [***] */
+    0xef, 0xf0,                                             /* [***] */
+    0x0e, 0xe0,                                             /* [ **] */
+    0x6f, 0x70,                                             /* [***] */
+    0x54, 0x00,                                             /* [   ] */
 };
 
 const uint8_t checkbook_14_0x28[] __attribute__((__progmem__)) = {   /* '(' width: 6 */
-      0,   0,   0,   0,   1,   2,                                /* [      ] */
-      0,   0,   0,   8,  14,   0,                                /* [   ** ] */
-      0,   0,   7,  15,   8,   0,                                /* [  *** ] */
-      0,   4,  15,  15,   1,   0,                                /* [  **  ] */
-      0,  14,  15,  10,   0,   0,                                /* [ ***  ] */
-      5,  15,  15,   7,   0,   0,                                /* [ ***  ] */
-     11,  15,  15,   5,   0,   0,                                /* [***   ] */
-     13,  15,  15,   3,   0,   0,                                /* [***   ] */
-     15,  15,  15,   0,   0,   0,                                /* [***   ] */
-     14,  15,  15,   1,   0,   0,                                /* [***   ] */
-     12,  15,  15,   3,   0,   0,                                /* [***   ] */
-     10,  15,  15,   5,   0,   0,                                /* [***   ] */
-      4,  15,  15,   7,   0,   0,                                /* [ ***  ] */
-      0,  13,  15,   9,   0,   0,                                /* [ ***  ] */
-      0,   3,  14,  14,   0,   0,                                /* [  **  ] */
-      0,   0,   3,  15,   7,   0,                                /* [   ** ] */
-      0,   0,   0,   3,  12,   0,                                /* [    * ] */
-      0,   0,   0,   0,   0,   0,                                /* [      ] */
+    0x00, 0x00, 0x12,                                       /* [      ] */
+    0x00, 0x08, 0xe0,                                       /* [   ** ] */
+    0x00, 0x7f, 0x80,                                       /* [  *** ] */
+    0x04, 0xff, 0x10,                                       /* [  **  ] */
+    0x0e, 0xfa, 0x00,                                       /* [ ***  ] */
+    0x5f, 0xf7, 0x00,                                       /* [ ***  ] */
+    0xbf, 0xf5, 0x00,                                       /* [***   ] */
+    0xdf, 0xf3, 0x00,                                       /* [***   ] */
+    0xff, 0xf0, 0x00,                                       /* [***   ] */
+    0xef, 0xf1, 0x00,                                       /* [***   ] */
+    0xcf, 0xf3, 0x00,                                       /* [***   ] */
+    0xaf, 0xf5, 0x00,                                       /* [***   ] */
+    0x4f, 0xf7, 0x00,                                       /* [ ***  ] */
+    0x0d, 0xf9, 0x00,                                       /* [ ***  ] */
+    0x03, 0xee, 0x00,                                       /* [  **  ] */
+    0x00, 0x3f, 0x70,                                       /* [   ** ] */
+    0x00, 0x03, 0xc0,                                       /* [    * ] */
+    0x00, 0x00, 0x00,                                       /* [      ] */
 };
 
 const uint8_t checkbook_14_0x29[] __attribute__((__progmem__)) = {   /* ')' width: 6 */
-      2,   1,   0,   0,   0,                                     /* [     ] */
-      2,  14,   4,   0,   0,                                     /* [ *   ] */
-      0,  14,  14,   0,   0,                                     /* [ **  ] */
-      0,   9,  15,   9,   0,                                     /* [ *** ] */
-      0,   6,  15,  15,   2,                                     /* [ *** ] */
-      0,   4,  15,  15,   5,                                     /* [  ** ] */
-      0,   3,  15,  15,   8,                                     /* [  ***] */
-      0,   1,  15,  15,  12,                                     /* [  ***] */
-      0,   0,  15,  15,  15,                                     /* [  ***] */
-      0,   0,  15,  15,  14,                                     /* [  ***] */
-      0,   1,  15,  15,  13,                                     /* [  ***] */
-      0,   1,  15,  15,  11,                                     /* [  ***] */
-      0,   3,  15,  15,   6,                                     /* [  ***] */
-      0,   5,  15,  15,   1,                                     /* [  ** ] */
-      0,   8,  15,   7,   0,                                     /* [ *** ] */
-      0,  11,  11,   0,   0,                                     /* [ **  ] */
-      0,  11,   1,   0,   0,                                     /* [ *   ] */
-      0,   0,   0,   0,   0,                                     /* [     ] */
+    0x21, 0x00, 0x00,                                       /* [     ] */
+    0x2e, 0x40, 0x00,                                       /* [ *   ] */
+    0x0e, 0xe0, 0x00,                                       /* [ **  ] */
+    0x09, 0xf9, 0x00,                                       /* [ *** ] */
+    0x06, 0xff, 0x20,                                       /* [ *** ] */
+    0x04, 0xff, 0x50,                                       /* [  ** ] */
+    0x03, 0xff, 0x80,                                       /* [  ***] */
+    0x01, 0xff, 0xc0,                                       /* [  ***] */
+    0x00, 0xff, 0xf0,                                       /* [  ***] */
+    0x00, 0xff, 0xe0,                                       /* [  ***] */
+    0x01, 0xff, 0xd0,                                       /* [  ***] */
+    0x01, 0xff, 0xb0,                                       /* [  ***] */
+    0x03, 0xff, 0x60,                                       /* [  ***] */
+    0x05, 0xff, 0x10,                                       /* [  ** ] */
+    0x08, 0xf7, 0x00,                                       /* [ *** ] */
+    0x0b, 0xb0, 0x00,                                       /* [ **  ] */
+    0x0b, 0x10, 0x00,                                       /* [ *   ] */
+    0x00, 0x00, 0x00,                                       /* [     ] */
 };
 
 const uint8_t checkbook_14_0x2a[] __attribute__((__progmem__)) = {   /* '*' width: 6 */
-      0,   0,   6,   7,   0,   0,                                /* [  **  ] */
-      3,   3,  14,  15,   3,   3,                                /* [  **  ] */
-     14,  15,  15,  15,  15,  14,                                /* [******] */
-      2,  14,  15,  15,  14,   2,                                /* [ **** ] */
-      2,  15,  13,  13,  15,   3,                                /* [ **** ] */
-      0,   3,   0,   1,   3,   0,                                /* [      ] */
+    0x00, 0x67, 0x00,                                       /* [  **  ] */
+    0x33, 0xef, 0x33,                                       /* [  **  ] */
+    0xef, 0xff, 0xfe,                                       /* [******] */
+    0x2e, 0xff, 0xe2,                                       /* [ **** ] */
+    0x2f, 0xdd, 0xf3,                                       /* [ **** ] */
+    0x03, 0x01, 0x30,                                       /* [      ] */
 };
 
 const uint8_t checkbook_14_0x2c[] __attribute__((__progmem__)) = {   /* ',' width: 5 */
-      5,   7,   7,   5,                                          /* [ ** ] */
-     15,  15,  15,  15,                                          /* [****] */
-     15,  15,  15,  15,                                          /* [****] */
-     14,  15,  15,  15,                                          /* [****] */
-      0,   9,  15,  11,                                          /* [ ***] */
-      1,  13,  15,   5,                                          /* [ ** ] */
-     10,  11,   4,   0,                                          /* [**  ] */
+    0x57, 0x75,                                             /* [ ** ] */
+    0xff, 0xff,                                             /* [****] */
+    0xff, 0xff,                                             /* [****] */
+    0xef, 0xff,                                             /* [****] */
+    0x09, 0xfb,                                             /* [ ***] */
+    0x1d, 0xf5,                                             /* [ ** ] */
+    0xab, 0x40,                                             /* [**  ] */
 };
 
 const uint8_t checkbook_14_0x2e[] __attribute__((__progmem__)) = {   /* '.' width: 4 */
-     13,  15,  15,  13,                                          /* [****] */
-     15,  15,  15,  15,                                          /* [****] */
-     15,  15,  15,  15,                                          /* [****] */
-     13,  15,  15,  13,                                          /* [****] */
+    0xdf, 0xfd,                                             /* [****] */
+    0xff, 0xff,                                             /* [****] */
+    0xff, 0xff,                                             /* [****] */
+    0xdf, 0xfd,                                             /* [****] */
 };
 
 const uint8_t checkbook_14_0x2f[] __attribute__((__progmem__)) = {   /* '/' width: 10 */
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   4,            /* [          ] */
-      0,   0,   0,   0,   0,   0,   0,   0,   9,  13,            /* [        **] */
-      0,   0,   0,   0,   0,   0,   0,   3,  15,   3,            /* [        * ] */
-      0,   0,   0,   0,   0,   0,   0,  13,   9,   0,            /* [       ** ] */
-      0,   0,   0,   0,   0,   0,   7,  14,   1,   0,            /* [      **  ] */
-      0,   0,   0,   0,   0,   1,  15,   6,   0,   0,            /* [      **  ] */
-      0,   0,   0,   0,   0,  10,  12,   0,   0,   0,            /* [     **   ] */
-      0,   0,   0,   0,   4,  15,   2,   0,   0,   0,            /* [     *    ] */
-      0,   0,   0,   0,  13,   8,   0,   0,   0,   0,            /* [    **    ] */
-      0,   0,   0,   8,  13,   0,   0,   0,   0,   0,            /* [   **     ] */
-      0,   0,   2,  15,   4,   0,   0,   0,   0,   0,            /* [   *      ] */
-      0,   0,  12,  10,   0,   0,   0,   0,   0,   0,            /* [  **      ] */
-      0,   6,  15,   1,   0,   0,   0,   0,   0,   0,            /* [ **       ] */
-      1,  14,   6,   0,   0,   0,   0,   0,   0,   0,            /* [ **       ] */
-      9,  12,   0,   0,   0,   0,   0,   0,   0,   0,            /* [**        ] */
-     11,   3,   0,   0,   0,   0,   0,   0,   0,   0,            /* [*         ] */
+    0x00, 0x00, 0x00, 0x00, 0x04,                           /* [          ] */
+    0x00, 0x00, 0x00, 0x00, 0x9d,                           /* [        **] */
+    0x00, 0x00, 0x00, 0x03, 0xf3,                           /* [        * ] */
+    0x00, 0x00, 0x00, 0x0d, 0x90,                           /* [       ** ] */
+    0x00, 0x00, 0x00, 0x7e, 0x10,                           /* [      **  ] */
+    0x00, 0x00, 0x01, 0xf6, 0x00,                           /* [      **  ] */
+    0x00, 0x00, 0x0a, 0xc0, 0x00,                           /* [     **   ] */
+    0x00, 0x00, 0x4f, 0x20, 0x00,                           /* [     *    ] */
+    0x00, 0x00, 0xd8, 0x00, 0x00,                           /* [    **    ] */
+    0x00, 0x08, 0xd0, 0x00, 0x00,                           /* [   **     ] */
+    0x00, 0x2f, 0x40, 0x00, 0x00,                           /* [   *      ] */
+    0x00, 0xca, 0x00, 0x00, 0x00,                           /* [  **      ] */
+    0x06, 0xf1, 0x00, 0x00, 0x00,                           /* [ **       ] */
+    0x1e, 0x60, 0x00, 0x00, 0x00,                           /* [ **       ] */
+    0x9c, 0x00, 0x00, 0x00, 0x00,                           /* [**        ] */
+    0xb3, 0x00, 0x00, 0x00, 0x00,                           /* [*         ] */
 };
 
 const uint8_t checkbook_14_0x30[] __attribute__((__progmem__)) = {   /* '0' width: 13 */
-      0,   8,  14,  15,  15,  15,  15,  15,  13,   7,   0,       /* [ ********* ] */
-      7,  15,  15,  15,  15,  15,  15,  15,  15,  15,   4,       /* [********** ] */
-     13,  15,   9,   1,   0,   0,   0,   0,   4,  15,  11,       /* [***      **] */
-     15,  15,   0,   0,   0,   0,   0,   0,   0,  15,  15,       /* [**       **] */
-     15,  15,   0,   0,   0,   0,   0,   0,   0,  15,  15,       /* [**       **] */
-     15,  15,   0,   0,   0,   0,   0,   0,   0,  15,  15,       /* [**       **] */
-     15,  15,   0,   0,   0,   0,   0,   0,   0,  15,  15,       /* [**       **] */
-     15,  15,   0,   0,   0,   0,   0,   0,   0,  15,  15,       /* [**       **] */
-     15,  15,   0,   0,   0,   0,   0,   0,   0,  15,  15,       /* [**       **] */
-     15,  15,   0,   0,  13,  15,  15,  13,   0,  15,  15,       /* [**  **** **] */
-     15,  15,   0,   0,  15,  15,  15,  15,   0,  15,  15,       /* [**  **** **] */
-     15,  15,   0,   0,  15,  15,  15,  15,   0,  15,  15,       /* [**  **** **] */
-     15,  15,   0,   0,  13,  15,  15,  13,   0,  15,  15,       /* [**  **** **] */
-     10,  15,   4,   0,   0,   0,   0,   0,   4,  15,  13,       /* [**       **] */
-      4,  15,  15,  15,  15,  15,  15,  15,  15,  15,   7,       /* [ **********] */
-      0,   4,  12,  15,  15,  15,  15,  15,  14,   7,   0,       /* [  ******** ] */
+    0x08, 0xef, 0xff, 0xff, 0xd7, 0x00,                     /* [ ********* ] */
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0x40,                     /* [********** ] */
+    0xdf, 0x91, 0x00, 0x00, 0x4f, 0xb0,                     /* [***      **] */
+    0xff, 0x00, 0x00, 0x00, 0x0f, 0xf0,                     /* [**       **] */
+    0xff, 0x00, 0x00, 0x00, 0x0f, 0xf0,                     /* [**       **] */
+    0xff, 0x00, 0x00, 0x00, 0x0f, 0xf0,                     /* [**       **] */
+    0xff, 0x00, 0x00, 0x00, 0x0f, 0xf0,                     /* [**       **] */
+    0xff, 0x00, 0x00, 0x00, 0x0f, 0xf0,                     /* [**       **] */
+    0xff, 0x00, 0x00, 0x00, 0x0f, 0xf0,                     /* [**       **] */
+    0xff, 0x00, 0xdf, 0xfd, 0x0f, 0xf0,                     /* [**  **** **] */
+    0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0,                     /* [**  **** **] */
+    0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0,                     /* [**  **** **] */
+    0xff, 0x00, 0xdf, 0xfd, 0x0f, 0xf0,                     /* [**  **** **] */
+    0xaf, 0x40, 0x00, 0x00, 0x4f, 0xd0,                     /* [**       **] */
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0x70,                     /* [ **********] */
+    0x04, 0xcf, 0xff, 0xff, 0xe7, 0x00,                     /* [  ******** ] */
 };
 
 const uint8_t checkbook_14_0x31[] __attribute__((__progmem__)) = {   /* '1' width: 8 */
-      2,   9,   9,   5,   0,   0,   0,   0,                      /* [ **     ] */
-      9,  15,  15,  14,   0,   0,   0,   0,                      /* [****    ] */
-      7,  15,  15,  15,   0,   0,   0,   0,                      /* [****    ] */
-      0,   4,  15,  15,   0,   0,   0,   0,                      /* [  **    ] */
-      0,   0,  15,  15,   0,   0,   0,   0,                      /* [  **    ] */
-      0,   0,  15,  15,   0,   0,   0,   0,                      /* [  **    ] */
-      0,   0,  15,  15,   0,   0,   0,   0,                      /* [  **    ] */
-      0,   0,  15,  15,   0,   0,   0,   0,                      /* [  **    ] */
-      0,   2,  15,  15,   2,   0,   0,   0,                      /* [  **    ] */
-      7,  15,  15,  15,  15,  15,  15,   3,                      /* [******* ] */
-     11,  15,  15,  15,  15,  15,  15,   6,                      /* [********] */
-     11,  15,  15,  15,  15,  15,  15,   6,                      /* [********] */
-     11,  15,  15,  15,  15,  15,  15,   6,                      /* [********] */
-     11,  15,  15,  15,  15,  15,  15,   6,                      /* [********] */
-     11,  15,  15,  15,  15,  15,  15,   6,                      /* [********] */
-      8,  15,  15,  15,  15,  15,  15,   3,                      /* [******* ] */
+    0x29, 0x95, 0x00, 0x00,                                 /* [ **     ] */
+    0x9f, 0xfe, 0x00, 0x00,                                 /* [****    ] */
+    0x7f, 0xff, 0x00, 0x00,                                 /* [****    ] */
+    0x04, 0xff, 0x00, 0x00,                                 /* [  **    ] */
+    0x00, 0xff, 0x00, 0x00,                                 /* [  **    ] */
+    0x00, 0xff, 0x00, 0x00,                                 /* [  **    ] */
+    0x00, 0xff, 0x00, 0x00,                                 /* [  **    ] */
+    0x00, 0xff, 0x00, 0x00,                                 /* [  **    ] */
+    0x02, 0xff, 0x20, 0x00,                                 /* [  **    ] */
+    0x7f, 0xff, 0xff, 0xf3,                                 /* [******* ] */
+    0xbf, 0xff, 0xff, 0xf6,                                 /* [********] */
+    0xbf, 0xff, 0xff, 0xf6,                                 /* [********] */
+    0xbf, 0xff, 0xff, 0xf6,                                 /* [********] */
+    0xbf, 0xff, 0xff, 0xf6,                                 /* [********] */
+    0xbf, 0xff, 0xff, 0xf6,                                 /* [********] */
+    0x8f, 0xff, 0xff, 0xf3,                                 /* [******* ] */
 };
 
 const uint8_t checkbook_14_0x32[] __attribute__((__progmem__)) = {   /* '2' width: 8 */
-     10,  15,  15,  15,  15,  12,                                /* [******] */
-     11,  15,  15,  15,  15,  15,                                /* [******] */
-      0,   0,   0,   1,  15,  15,                                /* [    **] */
-      0,   0,   0,   0,  15,  15,                                /* [    **] */
-      0,   0,   0,   0,  15,  15,                                /* [    **] */
-      0,   0,   0,   0,  15,  15,                                /* [    **] */
-      0,   0,   0,   0,  15,  15,                                /* [    **] */
-     11,  15,  15,  15,  15,  15,                                /* [******] */
-     15,  15,  15,  15,  15,  11,                                /* [******] */
-     15,  15,   1,   0,   0,   0,                                /* [**    ] */
-     15,  15,   0,   0,   0,   0,                                /* [**    ] */
-     15,  15,   0,   0,   0,   0,                                /* [**    ] */
-     15,  15,   0,   0,   0,   0,                                /* [**    ] */
-     15,  15,   0,   0,   0,   0,                                /* [**    ] */
-     15,  15,  15,  15,  15,  10,                                /* [******] */
-     13,  15,  15,  15,  15,  11,                                /* [******] */
+    0xaf, 0xff, 0xfc,                                       /* [******] */
+    0xbf, 0xff, 0xff,                                       /* [******] */
+    0x00, 0x01, 0xff,                                       /* [    **] */
+    0x00, 0x00, 0xff,                                       /* [    **] */
+    0x00, 0x00, 0xff,                                       /* [    **] */
+    0x00, 0x00, 0xff,                                       /* [    **] */
+    0x00, 0x00, 0xff,                                       /* [    **] */
+    0xbf, 0xff, 0xff,                                       /* [******] */
+    0xff, 0xff, 0xfb,                                       /* [******] */
+    0xff, 0x10, 0x00,                                       /* [**    ] */
+    0xff, 0x00, 0x00,                                       /* [**    ] */
+    0xff, 0x00, 0x00,                                       /* [**    ] */
+    0xff, 0x00, 0x00,                                       /* [**    ] */
+    0xff, 0x00, 0x00,                                       /* [**    ] */
+    0xff, 0xff, 0xfa,                                       /* [******] */
+    0xdf, 0xff, 0xfb,                                       /* [******] */
 };
 
 const uint8_t checkbook_14_0x33[] __attribute__((__progmem__)) = {   /* '3' width: 10 */
-      0,  13,  15,  15,  15,  15,  15,  12,   0,   0,            /* [ *******  ] */
-      0,  13,  15,  15,  15,  15,  15,  15,   0,   0,            /* [ *******  ] */
-      0,   0,   0,   0,   0,   2,  15,  15,   0,   0,            /* [      **  ] */
-      0,   0,   0,   0,   0,   0,  15,  15,   0,   0,            /* [      **  ] */
-      0,   0,   0,   0,   0,   0,  15,  15,   0,   0,            /* [      **  ] */
-      0,   0,   0,   0,   0,   0,  15,  15,   0,   0,            /* [      **  ] */
-      0,   0,   0,   0,   0,   2,  15,  15,   0,   0,            /* [      **  ] */
-      1,  14,  15,  15,  15,  15,  15,  15,   4,   0,            /* [ *******  ] */
-      1,  13,  15,  15,  15,  15,  15,  15,  15,   7,            /* [ *********] */
-      0,   0,   0,   0,   0,   2,  15,  15,  15,  11,            /* [      ****] */
-      0,   0,   0,   0,   0,   0,  15,  15,  15,  11,            /* [      ****] */
-      0,   0,   0,   0,   0,   0,  15,  15,  15,  11,            /* [      ****] */
-      0,   0,   0,   0,   0,   0,  15,  15,  15,  11,            /* [      ****] */
-      0,   0,   0,   0,   0,   3,  15,  15,  15,  11,            /* [      ****] */
-      2,  14,  15,  15,  15,  15,  15,  15,  15,  11,            /* [ *********] */
-      2,  14,  15,  15,  15,  15,  15,  15,  15,   6,            /* [ *********] */
+    0x0d, 0xff, 0xff, 0xfc, 0x00,                           /* [ *******  ] */
+    0x0d, 0xff, 0xff, 0xff, 0x00,                           /* [ *******  ] */
+    0x00, 0x00, 0x02, 0xff, 0x00,                           /* [      **  ] */
+    0x00, 0x00, 0x00, 0xff, 0x00,                           /* [      **  ] */
+    0x00, 0x00, 0x00, 0xff, 0x00,                           /* [      **  ] */
+    0x00, 0x00, 0x00, 0xff, 0x00,                           /* [      **  ] */
+    0x00, 0x00, 0x02, 0xff, 0x00,                           /* [      **  ] */
+    0x1e, 0xff, 0xff, 0xff, 0x40,                           /* [ *******  ] */
+    0x1d, 0xff, 0xff, 0xff, 0xf7,                           /* [ *********] */
+    0x00, 0x00, 0x02, 0xff, 0xfb,                           /* [      ****] */
+    0x00, 0x00, 0x00, 0xff, 0xfb,                           /* [      ****] */
+    0x00, 0x00, 0x00, 0xff, 0xfb,                           /* [      ****] */
+    0x00, 0x00, 0x00, 0xff, 0xfb,                           /* [      ****] */
+    0x00, 0x00, 0x03, 0xff, 0xfb,                           /* [      ****] */
+    0x2e, 0xff, 0xff, 0xff, 0xfb,                           /* [ *********] */
+    0x2e, 0xff, 0xff, 0xff, 0xf6,                           /* [ *********] */
 };
 
 const uint8_t checkbook_14_0x34[] __attribute__((__progmem__)) = {   /* '4' width: 12 */
-      0,   4,   8,   8,   5,   0,   0,   0,   0,   0,   0,       /* [  **       ] */
-      0,  15,  15,  15,  15,   0,   0,   0,   0,   0,   0,       /* [ ****      ] */
-      0,  15,  15,  15,  15,   0,   0,   0,   0,   0,   0,       /* [ ****      ] */
-      0,  15,  15,  15,  15,   0,   0,   0,   0,   0,   0,       /* [ ****      ] */
-      0,  15,  15,  15,  15,   0,   0,   0,   0,   0,   0,       /* [ ****      ] */
-      0,  15,  15,  15,  15,   0,   0,   0,   0,   0,   0,       /* [ ****      ] */
-      0,  15,  15,  15,  15,   0,   0,   0,   0,   0,   0,       /* [ ****      ] */
-      0,  15,  15,  15,  15,   0,   0,   0,   0,   0,   0,       /* [ ****      ] */
-      0,  15,  15,  15,  15,   0,   0,   0,   0,   0,   0,       /* [ ****      ] */
-      0,  15,  15,  15,  15,   0,   0,   6,  11,  11,   6,       /* [ ****  ****] */
-      0,  15,  15,  15,  15,   1,   1,  15,  15,  15,  15,       /* [ ****  ****] */
-      0,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,       /* [ **********] */
-      0,  13,  15,  15,  15,  15,  15,  15,  15,  15,  15,       /* [ **********] */
-      0,   0,   0,   0,   0,   0,   1,  15,  15,  15,  15,       /* [       ****] */
-      0,   0,   0,   0,   0,   0,   0,  15,  15,  15,  15,       /* [       ****] */
-      0,   0,   0,   0,   0,   0,   0,  12,  15,  15,  12,       /* [       ****] */
+    0x04, 0x88, 0x50, 0x00, 0x00, 0x00,                     /* [  **       ] */
+    0x0f, 0xff, 0xf0, 0x00, 0x00, 0x00,                     /* [ ****      ] */
+    0x0f, 0xff, 0xf0, 0x00, 0x00, 0x00,                     /* [ ****      ] */
+    0x0f, 0xff, 0xf0, 0x00, 0x00, 0x00,                     /* [ ****      ] */
+    0x0f, 0xff, 0xf0, 0x00, 0x00, 0x00,                     /* [ ****      ] */
+    0x0f, 0xff, 0xf0, 0x00, 0x00, 0x00,                     /* [ ****      ] */
+    0x0f, 0xff, 0xf0, 0x00, 0x00, 0x00,                     /* [ ****      ] */
+    0x0f, 0xff, 0xf0, 0x00, 0x00, 0x00,                     /* [ ****      ] */
+    0x0f, 0xff, 0xf0, 0x00, 0x00, 0x00,                     /* [ ****      ] */
+    0x0f, 0xff, 0xf0, 0x06, 0xbb, 0x60,                     /* [ ****  ****] */
+    0x0f, 0xff, 0xf1, 0x1f, 0xff, 0xf0,                     /* [ ****  ****] */
+    0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0,                     /* [ **********] */
+    0x0d, 0xff, 0xff, 0xff, 0xff, 0xf0,                     /* [ **********] */
+    0x00, 0x00, 0x00, 0x1f, 0xff, 0xf0,                     /* [       ****] */
+    0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0,                     /* [       ****] */
+    0x00, 0x00, 0x00, 0x0c, 0xff, 0xc0,                     /* [       ****] */
 };
 
 const uint8_t checkbook_14_0x35[] __attribute__((__progmem__)) = {   /* '5' width: 10 */
-      0,  10,  15,  15,  15,  15,  15,  15,  10,                 /* [ ********] */
-      0,  15,  15,  15,  15,  15,  15,  15,  10,                 /* [ ********] */
-      0,  15,  15,   3,   0,   0,   0,   0,   0,                 /* [ **      ] */
-      0,  15,  15,   0,   0,   0,   0,   0,   0,                 /* [ **      ] */
-      0,  15,  15,   0,   0,   0,   0,   0,   0,                 /* [ **      ] */
-      0,  15,  15,   0,   0,   0,   0,   0,   0,                 /* [ **      ] */
-      0,  15,  15,   1,   0,   0,   0,   0,   0,                 /* [ **      ] */
-      0,  15,  15,  15,  15,  15,  15,  15,  10,                 /* [ ********] */
-      0,  12,  15,  15,  15,  15,  15,  15,  15,                 /* [ ********] */
-      0,   0,   0,   0,   0,   1,  15,  15,  15,                 /* [      ***] */
-      0,   0,   0,   0,   0,   0,  15,  15,  15,                 /* [      ***] */
-      0,   0,   0,   0,   0,   0,  15,  15,  15,                 /* [      ***] */
-      0,   0,   0,   0,   0,   0,  15,  15,  15,                 /* [      ***] */
-      0,   0,   0,   0,   0,   2,  15,  15,  15,                 /* [      ***] */
-      0,  12,  15,  15,  15,  15,  15,  15,  15,                 /* [ ********] */
-      0,  12,  15,  15,  15,  15,  15,  15,  12,                 /* [ ********] */
+    0x0a, 0xff, 0xff, 0xff, 0xa0,                           /* [ ********] */
+    0x0f, 0xff, 0xff, 0xff, 0xa0,                           /* [ ********] */
+    0x0f, 0xf3, 0x00, 0x00, 0x00,                           /* [ **      ] */
+    0x0f, 0xf0, 0x00, 0x00, 0x00,                           /* [ **      ] */
+    0x0f, 0xf0, 0x00, 0x00, 0x00,                           /* [ **      ] */
+    0x0f, 0xf0, 0x00, 0x00, 0x00,                           /* [ **      ] */
+    0x0f, 0xf1, 0x00, 0x00, 0x00,                           /* [ **      ] */
+    0x0f, 0xff, 0xff, 0xff, 0xa0,                           /* [ ********] */
+    0x0c, 0xff, 0xff, 0xff, 0xf0,                           /* [ ********] */
+    0x00, 0x00, 0x01, 0xff, 0xf0,                           /* [      ***] */
+    0x00, 0x00, 0x00, 0xff, 0xf0,                           /* [      ***] */
+    0x00, 0x00, 0x00, 0xff, 0xf0,                           /* [      ***] */
+    0x00, 0x00, 0x00, 0xff, 0xf0,                           /* [      ***] */
+    0x00, 0x00, 0x02, 0xff, 0xf0,                           /* [      ***] */
+    0x0c, 0xff, 0xff, 0xff, 0xf0,                           /* [ ********] */
+    0x0c, 0xff, 0xff, 0xff, 0xc0,                           /* [ ********] */
 };
 
 const uint8_t checkbook_14_0x36[] __attribute__((__progmem__)) = {   /* '6' width: 12 */
-     10,  15,  15,  15,  15,  10,   0,   0,   0,   0,            /* [******    ] */
-     15,  15,  15,  15,  15,  12,   0,   0,   0,   0,            /* [******    ] */
-     15,  15,   1,   0,   9,  13,   0,   0,   0,   0,            /* [**  **    ] */
-     15,  15,   0,   0,   7,  11,   0,   0,   0,   0,            /* [**  **    ] */
-     15,  15,   0,   0,   1,   3,   0,   0,   0,   0,            /* [**        ] */
-     15,  15,   0,   0,   0,   0,   0,   0,   0,   0,            /* [**        ] */
-     15,  15,   0,   0,   0,   0,   0,   0,   0,   0,            /* [**        ] */
-     15,  15,   0,   0,   0,   0,   0,   0,   0,   0,            /* [**        ] */
-     15,  15,   2,   0,   0,   0,   0,   0,   0,   0,            /* [**        ] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,   9,            /* [**********] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,            /* [**********] */
-     15,  15,   1,   0,   0,   0,   1,  15,  15,  15,            /* [**     ***] */
-     15,  15,   0,   0,   0,   0,   0,  15,  15,  15,            /* [**     ***] */
-     15,  15,   1,   0,   0,   0,   2,  15,  15,  15,            /* [**     ***] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,            /* [**********] */
-     12,  15,  15,  15,  15,  15,  15,  15,  15,  10,            /* [**********] */
+    0xaf, 0xff, 0xfa, 0x00, 0x00,                           /* [******    ] */
+    0xff, 0xff, 0xfc, 0x00, 0x00,                           /* [******    ] */
+    0xff, 0x10, 0x9d, 0x00, 0x00,                           /* [**  **    ] */
+    0xff, 0x00, 0x7b, 0x00, 0x00,                           /* [**  **    ] */
+    0xff, 0x00, 0x13, 0x00, 0x00,                           /* [**        ] */
+    0xff, 0x00, 0x00, 0x00, 0x00,                           /* [**        ] */
+    0xff, 0x00, 0x00, 0x00, 0x00,                           /* [**        ] */
+    0xff, 0x00, 0x00, 0x00, 0x00,                           /* [**        ] */
+    0xff, 0x20, 0x00, 0x00, 0x00,                           /* [**        ] */
+    0xff, 0xff, 0xff, 0xff, 0xf9,                           /* [**********] */
+    0xff, 0xff, 0xff, 0xff, 0xff,                           /* [**********] */
+    0xff, 0x10, 0x00, 0x1f, 0xff,                           /* [**     ***] */
+    0xff, 0x00, 0x00, 0x0f, 0xff,                           /* [**     ***] */
+    0xff, 0x10, 0x00, 0x2f, 0xff,                           /* [**     ***] */
+    0xff, 0xff, 0xff, 0xff, 0xff,                           /* [**********] */
+    0xcf, 0xff, 0xff, 0xff, 0xfa,                           /* [**********] */
 };
 
 const uint8_t checkbook_14_0x37[] __attribute__((__progmem__)) = {   /* '7' width: 10 */
-     10,  15,  15,  15,  15,  15,  15,  12,                      /* [********] */
-     15,  15,  15,  15,  15,  15,  15,  15,                      /* [********] */
-     15,  15,   1,   0,   0,   1,  15,  15,                      /* [**    **] */
-     15,  15,   0,   0,   0,   0,  15,  15,                      /* [**    **] */
-     15,  15,   0,   0,   0,   0,  15,  15,                      /* [**    **] */
-      7,   7,   0,   0,   0,   0,  15,  15,                      /* [**    **] */
-      0,   0,   0,   0,   4,  13,  15,  15,                      /* [     ***] */
-      0,   0,   0,  10,  15,  15,  12,   3,                      /* [   **** ] */
-      0,   0,   0,  15,  15,   6,   0,   0,                      /* [   ***  ] */
-      0,   0,   0,  15,  15,   0,   0,   0,                      /* [   **   ] */
-      0,   0,   0,  15,  15,   0,   0,   0,                      /* [   **   ] */
-      0,   0,   0,  15,  15,   0,   0,   0,                      /* [   **   ] */
-      0,   0,   0,  15,  15,   0,   0,   0,                      /* [   **   ] */
-      0,   0,   0,  15,  15,   0,   0,   0,                      /* [   **   ] */
-      0,   0,   0,  15,  15,   0,   0,   0,                      /* [   **   ] */
-      0,   0,   0,  11,  11,   0,   0,   0,                      /* [   **   ] */
+    0xaf, 0xff, 0xff, 0xfc,                                 /* [********] */
+    0xff, 0xff, 0xff, 0xff,                                 /* [********] */
+    0xff, 0x10, 0x01, 0xff,                                 /* [**    **] */
+    0xff, 0x00, 0x00, 0xff,                                 /* [**    **] */
+    0xff, 0x00, 0x00, 0xff,                                 /* [**    **] */
+    0x77, 0x00, 0x00, 0xff,                                 /* [**    **] */
+    0x00, 0x00, 0x4d, 0xff,                                 /* [     ***] */
+    0x00, 0x0a, 0xff, 0xc3,                                 /* [   **** ] */
+    0x00, 0x0f, 0xf6, 0x00,                                 /* [   ***  ] */
+    0x00, 0x0f, 0xf0, 0x00,                                 /* [   **   ] */
+    0x00, 0x0f, 0xf0, 0x00,                                 /* [   **   ] */
+    0x00, 0x0f, 0xf0, 0x00,                                 /* [   **   ] */
+    0x00, 0x0f, 0xf0, 0x00,                                 /* [   **   ] */
+    0x00, 0x0f, 0xf0, 0x00,                                 /* [   **   ] */
+    0x00, 0x0f, 0xf0, 0x00,                                 /* [   **   ] */
+    0x00, 0x0b, 0xb0, 0x00,                                 /* [   **   ] */
 };
 
 const uint8_t checkbook_14_0x38[] __attribute__((__progmem__)) = {   /* '8' width: 13 */
-      0,   0,  14,  15,  15,  15,  15,  15,  15,  10,   0,   0,  /* [  ********  ] */
-      0,   4,  15,  15,  15,  15,  15,  15,  15,  15,   0,   0,  /* [  ********  ] */
-      0,   4,  15,  15,   1,   0,   0,   1,  15,  15,   0,   0,  /* [  **    **  ] */
-      0,   4,  15,  15,   0,   0,   0,   0,  15,  15,   0,   0,  /* [  **    **  ] */
-      0,   4,  15,  15,   0,   0,   0,   0,  15,  15,   0,   0,  /* [  **    **  ] */
-      0,   4,  15,  15,   0,   0,   0,   0,  15,  15,   0,   0,  /* [  **    **  ] */
-      0,   4,  15,  15,   1,   0,   0,   1,  15,  15,   0,   0,  /* [  **    **  ] */
-      0,   8,  15,  15,  15,  15,  15,  15,  15,  15,   3,   0,  /* [ *********  ] */
-     12,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,   7,  /* [************] */
-     15,  15,  15,  15,   1,   0,   0,   1,  15,  15,  15,  10,  /* [****    ****] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,  15,  10,  /* [****    ****] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,  15,  10,  /* [****    ****] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,  15,  10,  /* [****    ****] */
-     15,  15,  15,  15,   1,   0,   0,   1,  15,  15,  15,  10,  /* [****    ****] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  10,  /* [************] */
-     11,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,   6,  /* [************] */
+    0x00, 0xef, 0xff, 0xff, 0xfa, 0x00,                     /* [  ********  ] */
+    0x04, 0xff, 0xff, 0xff, 0xff, 0x00,                     /* [  ********  ] */
+    0x04, 0xff, 0x10, 0x01, 0xff, 0x00,                     /* [  **    **  ] */
+    0x04, 0xff, 0x00, 0x00, 0xff, 0x00,                     /* [  **    **  ] */
+    0x04, 0xff, 0x00, 0x00, 0xff, 0x00,                     /* [  **    **  ] */
+    0x04, 0xff, 0x00, 0x00, 0xff, 0x00,                     /* [  **    **  ] */
+    0x04, 0xff, 0x10, 0x01, 0xff, 0x00,                     /* [  **    **  ] */
+    0x08, 0xff, 0xff, 0xff, 0xff, 0x30,                     /* [ *********  ] */
+    0xcf, 0xff, 0xff, 0xff, 0xff, 0xf7,                     /* [************] */
+    0xff, 0xff, 0x10, 0x01, 0xff, 0xfa,                     /* [****    ****] */
+    0xff, 0xff, 0x00, 0x00, 0xff, 0xfa,                     /* [****    ****] */
+    0xff, 0xff, 0x00, 0x00, 0xff, 0xfa,                     /* [****    ****] */
+    0xff, 0xff, 0x00, 0x00, 0xff, 0xfa,                     /* [****    ****] */
+    0xff, 0xff, 0x10, 0x01, 0xff, 0xfa,                     /* [****    ****] */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,                     /* [************] */
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf6,                     /* [************] */
 };
 
 const uint8_t checkbook_14_0x39[] __attribute__((__progmem__)) = {   /* '9' width: 12 */
-     10,  15,  15,  15,  15,  15,  15,  15,  15,   8,            /* [**********] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,            /* [**********] */
-     15,  15,   2,   0,   0,   0,   0,   5,  15,  15,            /* [**      **] */
-     15,  15,   0,   0,   0,   0,   0,   3,  15,  15,            /* [**      **] */
-     15,  15,   0,   0,   0,   0,   0,   3,  15,  15,            /* [**      **] */
-     15,  15,   0,   0,   0,   0,   0,   3,  15,  15,            /* [**      **] */
-     15,  15,   2,   0,   0,   0,   0,   7,  15,  15,            /* [**     ***] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,            /* [**********] */
-     11,  15,  15,  15,  15,  15,  15,  15,  15,  15,            /* [**********] */
-      0,   0,   0,   0,   0,   1,  15,  15,  15,  15,            /* [      ****] */
-      0,   0,   0,   0,   0,   0,  15,  15,  15,  15,            /* [      ****] */
-      0,   0,   0,   0,   0,   0,  15,  15,  15,  15,            /* [      ****] */
-      0,   0,   0,   0,   0,   0,  15,  15,  15,  15,            /* [      ****] */
-      0,   0,   0,   0,   0,   0,  15,  15,  15,  15,            /* [      ****] */
-      0,   0,   0,   0,   0,   0,  15,  15,  15,  15,            /* [      ****] */
-      0,   0,   0,   0,   0,   0,  13,  15,  15,  13,            /* [      ****] */
+    0xaf, 0xff, 0xff, 0xff, 0xf8,                           /* [**********] */
+    0xff, 0xff, 0xff, 0xff, 0xff,                           /* [**********] */
+    0xff, 0x20, 0x00, 0x05, 0xff,                           /* [**      **] */
+    0xff, 0x00, 0x00, 0x03, 0xff,                           /* [**      **] */
+    0xff, 0x00, 0x00, 0x03, 0xff,                           /* [**      **] */
+    0xff, 0x00, 0x00, 0x03, 0xff,                           /* [**      **] */
+    0xff, 0x20, 0x00, 0x07, 0xff,                           /* [**     ***] */
+    0xff, 0xff, 0xff, 0xff, 0xff,                           /* [**********] */
+    0xbf, 0xff, 0xff, 0xff, 0xff,                           /* [**********] */
+    0x00, 0x00, 0x01, 0xff, 0xff,                           /* [      ****] */
+    0x00, 0x00, 0x00, 0xff, 0xff,                           /* [      ****] */
+    0x00, 0x00, 0x00, 0xff, 0xff,                           /* [      ****] */
+    0x00, 0x00, 0x00, 0xff, 0xff,                           /* [      ****] */
+    0x00, 0x00, 0x00, 0xff, 0xff,                           /* [      ****] */
+    0x00, 0x00, 0x00, 0xff, 0xff,                           /* [      ****] */
+    0x00, 0x00, 0x00, 0xdf, 0xfd,                           /* [      ****] */
 };
 
 const uint8_t checkbook_14_0x3a[] __attribute__((__progmem__)) = {   /* ':' width: 5 */
-     12,  15,  15,  13,                                          /* [****] */
-     15,  15,  15,  15,                                          /* [****] */
-     15,  15,  15,  15,                                          /* [****] */
-     13,  15,  15,  14,                                          /* [****] */
-      0,   0,   0,   0,                                          /* [    ] */
-      0,   0,   0,   0,                                          /* [    ] */
-     12,  15,  15,  13,                                          /* [****] */
-     15,  15,  15,  15,                                          /* [****] */
-     15,  15,  15,  15,                                          /* [****] */
-     13,  15,  15,  14,                                          /* [****] */
+    0xcf, 0xfd,                                             /* [****] */
+    0xff, 0xff,                                             /* [****] */
+    0xff, 0xff,                                             /* [****] */
+    0xdf, 0xfe,                                             /* [****] */
+    0x00, 0x00,                                             /* [    ] */
+    0x00, 0x00,                                             /* [    ] */
+    0xcf, 0xfd,                                             /* [****] */
+    0xff, 0xff,                                             /* [****] */
+    0xff, 0xff,                                             /* [****] */
+    0xdf, 0xfe,                                             /* [****] */
 };
 
 const uint8_t checkbook_14_0x3b[] __attribute__((__progmem__)) = {   /* ';' width: 5 */
-     12,  15,  15,  13,                                          /* [****] */
-     15,  15,  15,  15,                                          /* [****] */
-     15,  15,  15,  15,                                          /* [****] */
-     13,  15,  15,  14,                                          /* [****] */
-      0,   0,   0,   0,                                          /* [    ] */
-      0,   0,   0,   0,                                          /* [    ] */
-      5,   7,   7,   5,                                          /* [ ** ] */
-     15,  15,  15,  15,                                          /* [****] */
-     15,  15,  15,  15,                                          /* [****] */
-     14,  15,  15,  15,                                          /* [****] */
-      0,   9,  15,  11,                                          /* [ ***] */
-      1,  13,  15,   5,                                          /* [ ** ] */
-     10,  11,   4,   0,                                          /* [**  ] */
+    0xcf, 0xfd,                                             /* [****] */
+    0xff, 0xff,                                             /* [****] */
+    0xff, 0xff,                                             /* [****] */
+    0xdf, 0xfe,                                             /* [****] */
+    0x00, 0x00,                                             /* [    ] */
+    0x00, 0x00,                                             /* [    ] */
+    0x57, 0x75,                                             /* [ ** ] */
+    0xff, 0xff,                                             /* [****] */
+    0xff, 0xff,                                             /* [****] */
+    0xef, 0xff,                                             /* [****] */
+    0x09, 0xfb,                                             /* [ ***] */
+    0x1d, 0xf5,                                             /* [ ** ] */
+    0xab, 0x40,                                             /* [**  ] */
 };
 
 const uint8_t checkbook_14_0x3f[] __attribute__((__progmem__)) = {   /* '?' width: 9 */
-     10,  15,  15,  15,  15,  15,  13,                           /* [*******] */
-     15,  15,  15,  15,  15,  15,  15,                           /* [*******] */
-     15,  15,   0,   0,   0,  13,  15,                           /* [**   **] */
-     15,  15,   0,   0,   0,  15,  15,                           /* [**   **] */
-     14,  14,   0,   0,   0,  15,  15,                           /* [**   **] */
-      3,   2,   0,   0,   0,  15,  15,                           /* [     **] */
-      0,   0,   0,   1,  11,  15,  14,                           /* [    ***] */
-      0,   0,   0,  13,  15,  10,   1,                           /* [   *** ] */
-      0,   0,   1,  15,   7,   0,   0,                           /* [   **  ] */
-      0,   0,   1,  15,   4,   0,   0,                           /* [   *   ] */
-      0,   0,   0,  15,   3,   0,   0,                           /* [   *   ] */
-      0,   0,   0,   1,   0,   0,   0,                           /* [       ] */
-      0,   0,  12,  15,  15,  12,   0,                           /* [  **** ] */
-      0,   0,  15,  15,  15,  15,   0,                           /* [  **** ] */
-      0,   0,  15,  15,  15,  15,   0,                           /* [  **** ] */
-      0,   0,  12,  15,  15,  12,   0,                           /* [  **** ] */
+    0xaf, 0xff, 0xff, 0xd0,                                 /* [*******] */
+    0xff, 0xff, 0xff, 0xf0,                                 /* [*******] */
+    0xff, 0x00, 0x0d, 0xf0,                                 /* [**   **] */
+    0xff, 0x00, 0x0f, 0xf0,                                 /* [**   **] */
+    0xee, 0x00, 0x0f, 0xf0,                                 /* [**   **] */
+    0x32, 0x00, 0x0f, 0xf0,                                 /* [     **] */
+    0x00, 0x01, 0xbf, 0xe0,                                 /* [    ***] */
+    0x00, 0x0d, 0xfa, 0x10,                                 /* [   *** ] */
+    0x00, 0x1f, 0x70, 0x00,                                 /* [   **  ] */
+    0x00, 0x1f, 0x40, 0x00,                                 /* [   *   ] */
+    0x00, 0x0f, 0x30, 0x00,                                 /* [   *   ] */
+    0x00, 0x01, 0x00, 0x00,                                 /* [       ] */
+    0x00, 0xcf, 0xfc, 0x00,                                 /* [  **** ] */
+    0x00, 0xff, 0xff, 0x00,                                 /* [  **** ] */
+    0x00, 0xff, 0xff, 0x00,                                 /* [  **** ] */
+    0x00, 0xcf, 0xfc, 0x00,                                 /* [  **** ] */
 };
 
 const uint8_t checkbook_14_0x41[] __attribute__((__progmem__)) = {   /* 'A' width: 11 */
-      0,   0,   9,  15,  15,  15,  15,  15,  15,  12,            /* [  ********] */
-      0,   0,  13,  15,   1,   0,   0,   0,  15,  15,            /* [  **    **] */
-      0,   0,  13,  13,   0,   0,   0,   0,  14,  15,            /* [  **    **] */
-      0,   0,  13,  13,   0,   0,   0,   0,  14,  15,            /* [  **    **] */
-      0,   0,  13,  13,   0,   0,   0,   0,  14,  15,            /* [  **    **] */
-      0,   0,  13,  14,   1,   0,   0,   1,  15,  15,            /* [  **    **] */
-      0,   0,  13,  15,  15,  15,  15,  15,  15,  15,            /* [  ********] */
-      1,   9,  15,  15,  15,  15,  15,  15,  15,  15,            /* [ *********] */
-     14,  15,  15,  15,   3,   0,   0,   3,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     11,  15,  15,  10,   0,   0,   0,   0,  11,  12,            /* [****    **] */
+    0x00, 0x9f, 0xff, 0xff, 0xfc,                           /* [  ********] */
+    0x00, 0xdf, 0x10, 0x00, 0xff,                           /* [  **    **] */
+    0x00, 0xdd, 0x00, 0x00, 0xef,                           /* [  **    **] */
+    0x00, 0xdd, 0x00, 0x00, 0xef,                           /* [  **    **] */
+    0x00, 0xdd, 0x00, 0x00, 0xef,                           /* [  **    **] */
+    0x00, 0xde, 0x10, 0x01, 0xff,                           /* [  **    **] */
+    0x00, 0xdf, 0xff, 0xff, 0xff,                           /* [  ********] */
+    0x19, 0xff, 0xff, 0xff, 0xff,                           /* [ *********] */
+    0xef, 0xff, 0x30, 0x03, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xbf, 0xfa, 0x00, 0x00, 0xbc,                           /* [****    **] */
 };
 
 const uint8_t checkbook_14_0x42[] __attribute__((__progmem__)) = {   /* 'B' width: 11 */
-     10,  15,  15,  15,  15,  15,  15,  15,  15,  11,            /* [**********] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,            /* [**********] */
-     15,  15,  15,  15,   4,   0,   0,   4,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   4,   0,   0,   5,  15,  12,            /* [****    **] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,   9,            /* [**********] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,            /* [**********] */
-     15,  15,  15,  15,   4,   0,   0,   0,   9,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   4,   0,   0,   0,   9,  15,            /* [****    **] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,            /* [**********] */
-      9,  15,  15,  15,  15,  15,  15,  15,  15,  11,            /* [**********] */
+    0xaf, 0xff, 0xff, 0xff, 0xfb,                           /* [**********] */
+    0xff, 0xff, 0xff, 0xff, 0xff,                           /* [**********] */
+    0xff, 0xff, 0x40, 0x04, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x40, 0x05, 0xfc,                           /* [****    **] */
+    0xff, 0xff, 0xff, 0xff, 0xf9,                           /* [**********] */
+    0xff, 0xff, 0xff, 0xff, 0xff,                           /* [**********] */
+    0xff, 0xff, 0x40, 0x00, 0x9f,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x40, 0x00, 0x9f,                           /* [****    **] */
+    0xff, 0xff, 0xff, 0xff, 0xff,                           /* [**********] */
+    0x9f, 0xff, 0xff, 0xff, 0xfb,                           /* [**********] */
 };
 
 const uint8_t checkbook_14_0x43[] __attribute__((__progmem__)) = {   /* 'C' width: 10 */
-      8,  15,  15,  15,  15,  15,  15,  15,  13,                 /* [*********] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,                 /* [*********] */
-     15,  15,   4,   0,   2,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  14,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,   2,   4,   4,   2,                 /* [**       ] */
-     15,  15,   0,   0,   0,   0,   0,   0,   0,                 /* [**       ] */
-     15,  15,   0,   0,   0,   0,   0,   0,   0,                 /* [**       ] */
-     15,  15,   0,   0,   0,   0,   0,   0,   0,                 /* [**       ] */
-     15,  15,   0,   0,   0,   0,   0,   0,   0,                 /* [**       ] */
-     15,  15,   0,   0,   0,   0,   0,   3,   3,                 /* [**       ] */
-     15,  15,   0,   0,   0,   0,   0,  13,  14,                 /* [**     **] */
-     15,  15,   0,   0,   0,   0,   0,  13,  15,                 /* [**     **] */
-     15,  15,   4,   0,   0,   0,   4,  15,  15,                 /* [**     **] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,                 /* [*********] */
-     10,  15,  15,  15,  15,  15,  15,  15,   9,                 /* [*********] */
+    0x8f, 0xff, 0xff, 0xff, 0xd0,                           /* [*********] */
+    0xff, 0xff, 0xff, 0xff, 0xf0,                           /* [*********] */
+    0xff, 0x40, 0x2f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0e, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x02, 0x44, 0x20,                           /* [**       ] */
+    0xff, 0x00, 0x00, 0x00, 0x00,                           /* [**       ] */
+    0xff, 0x00, 0x00, 0x00, 0x00,                           /* [**       ] */
+    0xff, 0x00, 0x00, 0x00, 0x00,                           /* [**       ] */
+    0xff, 0x00, 0x00, 0x00, 0x00,                           /* [**       ] */
+    0xff, 0x00, 0x00, 0x03, 0x30,                           /* [**       ] */
+    0xff, 0x00, 0x00, 0x0d, 0xe0,                           /* [**     **] */
+    0xff, 0x00, 0x00, 0x0d, 0xf0,                           /* [**     **] */
+    0xff, 0x40, 0x00, 0x4f, 0xf0,                           /* [**     **] */
+    0xff, 0xff, 0xff, 0xff, 0xf0,                           /* [*********] */
+    0xaf, 0xff, 0xff, 0xff, 0x90,                           /* [*********] */
 };
 
 const uint8_t checkbook_14_0x44[] __attribute__((__progmem__)) = {   /* 'D' width: 11 */
-     10,  15,  15,  15,  15,  15,  14,  10,   2,   0,            /* [********  ] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,   3,            /* [********* ] */
-     15,  15,  15,  15,   4,   0,   0,   8,  15,  11,            /* [****   ***] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  14,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   0,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   0,   0,   0,   2,  15,  15,            /* [****    **] */
-     15,  15,  15,  15,   4,   0,   0,   8,  15,  11,            /* [****   ***] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,   3,            /* [********* ] */
-     12,  15,  15,  15,  15,  15,  14,   9,   1,   0,            /* [********  ] */
+    0xaf, 0xff, 0xff, 0xea, 0x20,                           /* [********  ] */
+    0xff, 0xff, 0xff, 0xff, 0xf3,                           /* [********* ] */
+    0xff, 0xff, 0x40, 0x08, 0xfb,                           /* [****   ***] */
+    0xff, 0xff, 0x00, 0x00, 0xfe,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x00, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x00, 0x02, 0xff,                           /* [****    **] */
+    0xff, 0xff, 0x40, 0x08, 0xfb,                           /* [****   ***] */
+    0xff, 0xff, 0xff, 0xff, 0xf3,                           /* [********* ] */
+    0xcf, 0xff, 0xff, 0xe9, 0x10,                           /* [********  ] */
 };
 
 const uint8_t checkbook_14_0x45[] __attribute__((__progmem__)) = {   /* 'E' width: 9 */
-     12,  15,  15,  15,  15,  15,  15,  15,   4,                 /* [******** ] */
-     15,  15,  15,  15,  15,  15,  15,  15,   4,                 /* [******** ] */
-     15,  15,   4,   0,   0,   0,   0,   0,   0,                 /* [**       ] */
-     15,  14,   0,   0,   0,   0,   0,   0,   0,                 /* [**       ] */
-     15,  14,   0,   0,   0,   0,   0,   0,   0,                 /* [**       ] */
-     15,  14,   0,   0,   0,   0,   0,   0,   0,                 /* [**       ] */
-     15,  15,   3,   0,   0,   0,   0,   0,   0,                 /* [**       ] */
-     15,  15,  15,  15,  15,  15,  15,  15,   4,                 /* [******** ] */
-     15,  15,  15,  15,  15,  15,  15,  15,   4,                 /* [******** ] */
-     15,  15,  15,  15,   3,   0,   0,   0,   0,                 /* [****     ] */
-     15,  15,  15,  15,   0,   0,   0,   0,   0,                 /* [****     ] */
-     15,  15,  15,  15,   0,   0,   0,   0,   0,                 /* [****     ] */
-     15,  15,  15,  15,   0,   0,   0,   0,   0,                 /* [****     ] */
-     15,  15,  15,  15,   3,   0,   0,   0,   0,                 /* [****     ] */
-     15,  15,  15,  15,  15,  15,  15,  15,   4,                 /* [******** ] */
-     11,  15,  15,  15,  15,  15,  15,  15,   4,                 /* [******** ] */
+    0xcf, 0xff, 0xff, 0xff, 0x40,                           /* [******** ] */
+    0xff, 0xff, 0xff, 0xff, 0x40,                           /* [******** ] */
+    0xff, 0x40, 0x00, 0x00, 0x00,                           /* [**       ] */
+    0xfe, 0x00, 0x00, 0x00, 0x00,                           /* [**       ] */
+    0xfe, 0x00, 0x00, 0x00, 0x00,                           /* [**       ] */
+    0xfe, 0x00, 0x00, 0x00, 0x00,                           /* [**       ] */
+    0xff, 0x30, 0x00, 0x00, 0x00,                           /* [**       ] */
+    0xff, 0xff, 0xff, 0xff, 0x40,                           /* [******** ] */
+    0xff, 0xff, 0xff, 0xff, 0x40,                           /* [******** ] */
+    0xff, 0xff, 0x30, 0x00, 0x00,                           /* [****     ] */
+    0xff, 0xff, 0x00, 0x00, 0x00,                           /* [****     ] */
+    0xff, 0xff, 0x00, 0x00, 0x00,                           /* [****     ] */
+    0xff, 0xff, 0x00, 0x00, 0x00,                           /* [****     ] */
+    0xff, 0xff, 0x30, 0x00, 0x00,                           /* [****     ] */
+    0xff, 0xff, 0xff, 0xff, 0x40,                           /* [******** ] */
+    0xbf, 0xff, 0xff, 0xff, 0x40,                           /* [******** ] */
 };
 
 const uint8_t checkbook_14_0x46[] __attribute__((__progmem__)) = {   /* 'F' width: 9 */
-      7,  15,  15,  15,  15,  15,  15,  15,   5,                 /* [******** ] */
-     11,  15,  15,  15,  15,  15,  15,  15,   5,                 /* [******** ] */
-     11,  15,  15,  15,   5,   0,   0,   0,   0,                 /* [****     ] */
-     11,  15,  15,  15,   0,   0,   0,   0,   0,                 /* [****     ] */
-     11,  15,  15,  15,   0,   0,   0,   0,   0,                 /* [****     ] */
-     11,  15,  15,  15,   0,   0,   0,   0,   0,                 /* [****     ] */
-     10,  15,  15,  15,   5,   0,   0,   0,   0,                 /* [****     ] */
-      0,  10,  15,  15,  15,  15,  15,  15,   3,                 /* [ ******* ] */
-      0,   0,  15,  15,  15,  15,  15,  15,   3,                 /* [  ****** ] */
-      0,   0,  15,  15,   4,   0,   0,   0,   0,                 /* [  **     ] */
-      0,   0,  15,  15,   0,   0,   0,   0,   0,                 /* [  **     ] */
-      0,   0,  15,  15,   0,   0,   0,   0,   0,                 /* [  **     ] */
-      0,   0,  15,  15,   0,   0,   0,   0,   0,                 /* [  **     ] */
-      0,   0,  15,  15,   0,   0,   0,   0,   0,                 /* [  **     ] */
-      0,   0,  15,  15,   0,   0,   0,   0,   0,                 /* [  **     ] */
-      0,   0,  12,  12,   0,   0,   0,   0,   0,                 /* [  **     ] */
+    0x7f, 0xff, 0xff, 0xff, 0x50,                           /* [******** ] */
+    0xbf, 0xff, 0xff, 0xff, 0x50,                           /* [******** ] */
+    0xbf, 0xff, 0x50, 0x00, 0x00,                           /* [****     ] */
+    0xbf, 0xff, 0x00, 0x00, 0x00,                           /* [****     ] */
+    0xbf, 0xff, 0x00, 0x00, 0x00,                           /* [****     ] */
+    0xbf, 0xff, 0x00, 0x00, 0x00,                           /* [****     ] */
+    0xaf, 0xff, 0x50, 0x00, 0x00,                           /* [****     ] */
+    0x0a, 0xff, 0xff, 0xff, 0x30,                           /* [ ******* ] */
+    0x00, 0xff, 0xff, 0xff, 0x30,                           /* [  ****** ] */
+    0x00, 0xff, 0x40, 0x00, 0x00,                           /* [  **     ] */
+    0x00, 0xff, 0x00, 0x00, 0x00,                           /* [  **     ] */
+    0x00, 0xff, 0x00, 0x00, 0x00,                           /* [  **     ] */
+    0x00, 0xff, 0x00, 0x00, 0x00,                           /* [  **     ] */
+    0x00, 0xff, 0x00, 0x00, 0x00,                           /* [  **     ] */
+    0x00, 0xff, 0x00, 0x00, 0x00,                           /* [  **     ] */
+    0x00, 0xcc, 0x00, 0x00, 0x00,                           /* [  **     ] */
 };
 
 const uint8_t checkbook_14_0x47[] __attribute__((__progmem__)) = {   /* 'G' width: 12 */
-     11,  15,  15,  15,  15,  15,  15,  15,  15,  15,   5,       /* [********** ] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  10,       /* [***********] */
-     15,  15,  15,  15,   3,   0,   0,  10,  15,  15,  11,       /* [****   ****] */
-     15,  15,  15,  15,   0,   0,   0,   8,  15,  15,  10,       /* [****   ****] */
-     15,  15,  15,  15,   0,   0,   0,   3,   9,   9,   4,       /* [****    ** ] */
-     15,  15,  15,  15,   0,   0,   0,   0,   0,   0,   0,       /* [****       ] */
-     15,  15,  15,  15,   0,   0,   0,   0,   0,   0,   0,       /* [****       ] */
-     15,  15,  15,  15,   0,   0,   6,  15,  15,  15,  11,       /* [****  *****] */
-     15,  15,  15,  15,   0,   0,   7,  15,  15,  15,  15,       /* [****  *****] */
-     15,  15,  15,  15,   0,   0,   0,   0,   4,  15,  15,       /* [****     **] */
-     15,  15,  15,  15,   0,   0,   0,   0,   0,  15,  15,       /* [****     **] */
-     15,  15,  15,  15,   0,   0,   0,   0,   0,  15,  15,       /* [****     **] */
-     15,  15,  15,  15,   0,   0,   0,   0,   0,  15,  15,       /* [****     **] */
-     15,  15,  15,  15,   2,   0,   0,   0,   4,  15,  15,       /* [****     **] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,       /* [***********] */
-     11,  15,  15,  15,  15,  15,  15,  15,  15,  15,  10,       /* [***********] */
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0x50,                     /* [********** ] */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,                     /* [***********] */
+    0xff, 0xff, 0x30, 0x0a, 0xff, 0xb0,                     /* [****   ****] */
+    0xff, 0xff, 0x00, 0x08, 0xff, 0xa0,                     /* [****   ****] */
+    0xff, 0xff, 0x00, 0x03, 0x99, 0x40,                     /* [****    ** ] */
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00,                     /* [****       ] */
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00,                     /* [****       ] */
+    0xff, 0xff, 0x00, 0x6f, 0xff, 0xb0,                     /* [****  *****] */
+    0xff, 0xff, 0x00, 0x7f, 0xff, 0xf0,                     /* [****  *****] */
+    0xff, 0xff, 0x00, 0x00, 0x4f, 0xf0,                     /* [****     **] */
+    0xff, 0xff, 0x00, 0x00, 0x0f, 0xf0,                     /* [****     **] */
+    0xff, 0xff, 0x00, 0x00, 0x0f, 0xf0,                     /* [****     **] */
+    0xff, 0xff, 0x00, 0x00, 0x0f, 0xf0,                     /* [****     **] */
+    0xff, 0xff, 0x20, 0x00, 0x4f, 0xf0,                     /* [****     **] */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,                     /* [***********] */
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xa0,                     /* [***********] */
 };
 
 const uint8_t checkbook_14_0x48[] __attribute__((__progmem__)) = {   /* 'H' width: 12 */
-      3,   4,   0,   0,   0,   0,   0,   2,   3,   0,   0,       /* [           ] */
-     15,  15,   0,   0,   0,   0,   0,  12,  15,   0,   0,       /* [**     **  ] */
-     15,  15,   0,   0,   0,   0,   0,  13,  15,   0,   0,       /* [**     **  ] */
-     15,  15,   0,   0,   0,   0,   0,  13,  15,   0,   0,       /* [**     **  ] */
-     15,  15,   0,   0,   0,   0,   0,  13,  15,   0,   0,       /* [**     **  ] */
-     15,  15,   0,   0,   0,   0,   0,  13,  15,   0,   0,       /* [**     **  ] */
-     15,  15,   3,   0,   0,   0,   2,  15,  15,   1,   0,       /* [**     **  ] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  11,   3,       /* [********** ] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,       /* [***********] */
-     15,  15,  15,   9,   0,   0,   3,  15,  15,  15,  15,       /* [****   ****] */
-     15,  15,  15,   6,   0,   0,   0,  15,  15,  15,  15,       /* [****   ****] */
-     15,  15,  15,   6,   0,   0,   0,  15,  15,  15,  15,       /* [****   ****] */
-     15,  15,  15,   6,   0,   0,   0,  15,  15,  15,  15,       /* [****   ****] */
-     15,  15,  15,   6,   0,   0,   0,  15,  15,  15,  15,       /* [****   ****] */
-     15,  15,  15,   6,   0,   0,   0,  15,  15,  15,  15,       /* [****   ****] */
-     14,  15,  15,   5,   0,   0,   0,  13,  15,  15,  14,       /* [***    ****] */
+    0x34, 0x00, 0x00, 0x02, 0x30, 0x00,                     /* [           ] */
+    0xff, 0x00, 0x00, 0x0c, 0xf0, 0x00,                     /* [**     **  ] */
+    0xff, 0x00, 0x00, 0x0d, 0xf0, 0x00,                     /* [**     **  ] */
+    0xff, 0x00, 0x00, 0x0d, 0xf0, 0x00,                     /* [**     **  ] */
+    0xff, 0x00, 0x00, 0x0d, 0xf0, 0x00,                     /* [**     **  ] */
+    0xff, 0x00, 0x00, 0x0d, 0xf0, 0x00,                     /* [**     **  ] */
+    0xff, 0x30, 0x00, 0x2f, 0xf1, 0x00,                     /* [**     **  ] */
+    0xff, 0xff, 0xff, 0xff, 0xfb, 0x30,                     /* [********** ] */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,                     /* [***********] */
+    0xff, 0xf9, 0x00, 0x3f, 0xff, 0xf0,                     /* [****   ****] */
+    0xff, 0xf6, 0x00, 0x0f, 0xff, 0xf0,                     /* [****   ****] */
+    0xff, 0xf6, 0x00, 0x0f, 0xff, 0xf0,                     /* [****   ****] */
+    0xff, 0xf6, 0x00, 0x0f, 0xff, 0xf0,                     /* [****   ****] */
+    0xff, 0xf6, 0x00, 0x0f, 0xff, 0xf0,                     /* [****   ****] */
+    0xff, 0xf6, 0x00, 0x0f, 0xff, 0xf0,                     /* [****   ****] */
+    0xef, 0xf5, 0x00, 0x0d, 0xff, 0xe0,                     /* [***    ****] */
 };
 
 const uint8_t checkbook_14_0x49[] __attribute__((__progmem__)) = {   /* 'I' width: 4 */
-      0,   0,   2,   2,                                          /* [    ] */
-      0,   0,  15,  15,                                          /* [  **] */
-      0,   0,  15,  15,                                          /* [  **] */
-      0,   0,  15,  15,                                          /* [  **] */
-      0,   0,  15,  15,                                          /* [  **] */
-      0,   0,  15,  15,                                          /* [  **] */
-      0,   0,  15,  15,                                          /* [  **] */
-      0,   0,  15,  15,                                          /* [  **] */
-      1,   8,  15,  15,                                          /* [ ***] */
-     12,  15,  15,  15,                                          /* [****] */
-     13,  15,  15,  15,                                          /* [****] */
-     13,  15,  15,  15,                                          /* [****] */
-     13,  15,  15,  15,                                          /* [****] */
-     13,  15,  15,  15,                                          /* [****] */
-     13,  15,  15,  15,                                          /* [****] */
-     11,  15,  15,  14,                                          /* [****] */
+    0x00, 0x22,                                             /* [    ] */
+    0x00, 0xff,                                             /* [  **] */
+    0x00, 0xff,                                             /* [  **] */
+    0x00, 0xff,                                             /* [  **] */
+    0x00, 0xff,                                             /* [  **] */
+    0x00, 0xff,                                             /* [  **] */
+    0x00, 0xff,                                             /* [  **] */
+    0x00, 0xff,                                             /* [  **] */
+    0x18, 0xff,                                             /* [ ***] */
+    0xcf, 0xff,                                             /* [****] */
+    0xdf, 0xff,                                             /* [****] */
+    0xdf, 0xff,                                             /* [****] */
+    0xdf, 0xff,                                             /* [****] */
+    0xdf, 0xff,                                             /* [****] */
+    0xdf, 0xff,                                             /* [****] */
+    0xbf, 0xfe,                                             /* [****] */
 };
 
 const uint8_t checkbook_14_0x4a[] __attribute__((__progmem__)) = {   /* 'J' width: 12 */
-      0,   0,   0,   0,   0,   0,   0,   4,   3,   0,   0,       /* [           ] */
-      0,   0,   0,   0,   0,   0,   0,  15,  13,   0,   0,       /* [       **  ] */
-      0,   0,   0,   0,   0,   0,   0,  15,  14,   0,   0,       /* [       **  ] */
-      0,   0,   0,   0,   0,   0,   0,  15,  14,   0,   0,       /* [       **  ] */
-      0,   0,   0,   0,   0,   0,   0,  15,  14,   0,   0,       /* [       **  ] */
-      0,   0,   0,   0,   0,   0,   0,  15,  14,   0,   0,       /* [       **  ] */
-      0,   0,   0,   0,   0,   0,   0,  15,  15,   0,   0,       /* [       **  ] */
-      0,   0,   0,   0,   0,   0,   0,  15,  15,  14,   6,       /* [       ****] */
-      0,   0,   0,   0,   0,   0,   0,  15,  15,  15,  15,       /* [       ****] */
-      0,   0,   0,   0,   0,   0,   0,  15,  15,  15,  15,       /* [       ****] */
-      0,   0,   0,   0,   0,   0,   0,  15,  15,  15,  15,       /* [       ****] */
-     14,  15,  15,  13,   0,   0,   0,  15,  15,  15,  15,       /* [****   ****] */
-     15,  15,  15,  15,   0,   0,   0,  15,  15,  15,  15,       /* [****   ****] */
-     15,  15,  15,  15,   1,   0,   2,  15,  15,  15,  15,       /* [****   ****] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,       /* [***********] */
-     13,  15,  15,  15,  15,  15,  15,  15,  15,  15,  13,       /* [***********] */
+    0x00, 0x00, 0x00, 0x04, 0x30, 0x00,                     /* [           ] */
+    0x00, 0x00, 0x00, 0x0f, 0xd0, 0x00,                     /* [       **  ] */
+    0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00,                     /* [       **  ] */
+    0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00,                     /* [       **  ] */
+    0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00,                     /* [       **  ] */
+    0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00,                     /* [       **  ] */
+    0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00,                     /* [       **  ] */
+    0x00, 0x00, 0x00, 0x0f, 0xfe, 0x60,                     /* [       ****] */
+    0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0,                     /* [       ****] */
+    0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0,                     /* [       ****] */
+    0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0,                     /* [       ****] */
+    0xef, 0xfd, 0x00, 0x0f, 0xff, 0xf0,                     /* [****   ****] */
+    0xff, 0xff, 0x00, 0x0f, 0xff, 0xf0,                     /* [****   ****] */
+    0xff, 0xff, 0x10, 0x2f, 0xff, 0xf0,                     /* [****   ****] */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,                     /* [***********] */
+    0xdf, 0xff, 0xff, 0xff, 0xff, 0xd0,                     /* [***********] */
 };
 
 const uint8_t checkbook_14_0x4b[] __attribute__((__progmem__)) = {   /* 'K' width: 12 */
-      4,   5,   0,   0,   0,   0,   0,   0,   0,   6,   5,   0,  /* [         *  ] */
-     15,  15,   1,   0,   0,   0,   0,   0,  12,  15,   9,   0,  /* [**      *** ] */
-     15,  15,   1,   0,   0,   0,   1,  12,  15,   7,   0,   0,  /* [**     ***  ] */
-     15,  15,   1,   0,   0,   1,  13,  15,   6,   0,   0,   0,  /* [**    ***   ] */
-     15,  15,   1,   0,   2,  13,  15,   4,   0,   0,   0,   0,  /* [**   **     ] */
-     15,  15,   1,   2,  14,  14,   3,   0,   0,   0,   0,   0,  /* [**  **      ] */
-     15,  15,   8,  14,  15,   3,   0,   0,   0,   0,   0,   0,  /* [*****       ] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  11,   0,  /* [*********** ] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,   0,  /* [*********** ] */
-     15,  15,  15,  15,   3,   0,   1,  15,  15,  15,  15,   0,  /* [****   **** ] */
-     15,  15,  15,  15,   0,   0,   0,  15,  15,  15,  15,   0,  /* [****   **** ] */
-     15,  15,  15,  15,   0,   0,   0,  15,  15,  15,  15,   0,  /* [****   **** ] */
-     15,  15,  15,  15,   0,   0,   0,  15,  15,  15,  15,   0,  /* [****   **** ] */
-     15,  15,  15,  15,   0,   0,   0,  15,  15,  15,  15,   0,  /* [****   **** ] */
-     15,  15,  15,  15,   0,   0,   0,  15,  15,  15,  15,   0,  /* [****   **** ] */
-     12,  15,  15,  11,   0,   0,   0,  13,  15,  15,  11,   0,  /* [****   **** ] */
+    0x45, 0x00, 0x00, 0x00, 0x06, 0x50,                     /* [         *  ] */
+    0xff, 0x10, 0x00, 0x00, 0xcf, 0x90,                     /* [**      *** ] */
+    0xff, 0x10, 0x00, 0x1c, 0xf7, 0x00,                     /* [**     ***  ] */
+    0xff, 0x10, 0x01, 0xdf, 0x60, 0x00,                     /* [**    ***   ] */
+    0xff, 0x10, 0x2d, 0xf4, 0x00, 0x00,                     /* [**   **     ] */
+    0xff, 0x12, 0xee, 0x30, 0x00, 0x00,                     /* [**  **      ] */
+    0xff, 0x8e, 0xf3, 0x00, 0x00, 0x00,                     /* [*****       ] */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,                     /* [*********** ] */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,                     /* [*********** ] */
+    0xff, 0xff, 0x30, 0x1f, 0xff, 0xf0,                     /* [****   **** ] */
+    0xff, 0xff, 0x00, 0x0f, 0xff, 0xf0,                     /* [****   **** ] */
+    0xff, 0xff, 0x00, 0x0f, 0xff, 0xf0,                     /* [****   **** ] */
+    0xff, 0xff, 0x00, 0x0f, 0xff, 0xf0,                     /* [****   **** ] */
+    0xff, 0xff, 0x00, 0x0f, 0xff, 0xf0,                     /* [****   **** ] */
+    0xff, 0xff, 0x00, 0x0f, 0xff, 0xf0,                     /* [****   **** ] */
+    0xcf, 0xfb, 0x00, 0x0d, 0xff, 0xb0,                     /* [****   **** ] */
 };
 
 const uint8_t checkbook_14_0x4c[] __attribute__((__progmem__)) = {   /* 'L' width: 9 */
-      0,   0,   4,   4,   0,   0,   0,   0,   0,                 /* [         ] */
-      0,   0,  15,  15,   0,   0,   0,   0,   0,                 /* [  **     ] */
-      0,   0,  15,  15,   0,   0,   0,   0,   0,                 /* [  **     ] */
-      0,   0,  15,  15,   0,   0,   0,   0,   0,                 /* [  **     ] */
-      0,   0,  15,  15,   0,   0,   0,   0,   0,                 /* [  **     ] */
-      0,   0,  15,  15,   0,   0,   0,   0,   0,                 /* [  **     ] */
-      0,   0,  15,  15,   0,   0,   0,   0,   0,                 /* [  **     ] */
-      0,   0,  15,  15,   0,   0,   0,   0,   0,                 /* [  **     ] */
-      1,  10,  15,  15,   0,   0,   0,   0,   0,                 /* [ ***     ] */
-     12,  15,  15,  15,   0,   0,   0,   0,   0,                 /* [****     ] */
-     13,  15,  15,  15,   0,   0,   0,   0,   0,                 /* [****     ] */
-     13,  15,  15,  15,   0,   0,   0,   0,   0,                 /* [****     ] */
-     13,  15,  15,  15,   0,   0,   0,   0,   0,                 /* [****     ] */
-     13,  15,  15,  15,   2,   0,   0,   0,   0,                 /* [****     ] */
-     13,  15,  15,  15,  15,  15,  15,  15,   5,                 /* [******** ] */
-      9,  15,  15,  15,  15,  15,  15,  15,   5,                 /* [******** ] */
+    0x00, 0x44, 0x00, 0x00, 0x00,                           /* [         ] */
+    0x00, 0xff, 0x00, 0x00, 0x00,                           /* [  **     ] */
+    0x00, 0xff, 0x00, 0x00, 0x00,                           /* [  **     ] */
+    0x00, 0xff, 0x00, 0x00, 0x00,                           /* [  **     ] */
+    0x00, 0xff, 0x00, 0x00, 0x00,                           /* [  **     ] */
+    0x00, 0xff, 0x00, 0x00, 0x00,                           /* [  **     ] */
+    0x00, 0xff, 0x00, 0x00, 0x00,                           /* [  **     ] */
+    0x00, 0xff, 0x00, 0x00, 0x00,                           /* [  **     ] */
+    0x1a, 0xff, 0x00, 0x00, 0x00,                           /* [ ***     ] */
+    0xcf, 0xff, 0x00, 0x00, 0x00,                           /* [****     ] */
+    0xdf, 0xff, 0x00, 0x00, 0x00,                           /* [****     ] */
+    0xdf, 0xff, 0x00, 0x00, 0x00,                           /* [****     ] */
+    0xdf, 0xff, 0x00, 0x00, 0x00,                           /* [****     ] */
+    0xdf, 0xff, 0x20, 0x00, 0x00,                           /* [****     ] */
+    0xdf, 0xff, 0xff, 0xff, 0x50,                           /* [******** ] */
+    0x9f, 0xff, 0xff, 0xff, 0x50,                           /* [******** ] */
 };
 
 const uint8_t checkbook_14_0x4d[] __attribute__((__progmem__)) = {   /* 'M' width: 13 */
-      4,   7,   7,   2,   0,   0,   0,   0,   6,   7,   7,   4,  /* [ **     *** ] */
-     15,  15,  15,  13,   0,   0,   0,   4,  15,  15,  15,  15,  /* [****    ****] */
-     15,  15,   6,  15,   6,   0,   0,  11,  15,  15,  15,  15,  /* [*****  *****] */
-     15,  15,   0,  12,  14,   0,   3,  10,  15,  15,  15,  15,  /* [** **  *****] */
-     15,  15,   0,   4,  15,  10,  11,   2,  15,  15,  15,  15,  /* [**  *** ****] */
-     15,  15,   0,   0,  12,  15,  11,   0,  15,  15,  15,  15,  /* [**  *** ****] */
-     15,  15,   0,   0,   5,  15,   3,   0,  15,  15,  15,  15,  /* [**   *  ****] */
-     15,  15,   0,   0,   0,   5,   0,   0,  15,  15,  15,  15,  /* [**      ****] */
-     15,  15,   0,   0,   0,   0,   0,   0,  15,  15,  15,  15,  /* [**      ****] */
-     15,  15,   0,   0,   0,   0,   0,   0,  15,  15,  15,  15,  /* [**      ****] */
-     15,  15,   0,   0,   0,   0,   0,   0,  15,  15,  15,  15,  /* [**      ****] */
-     15,  15,   0,   0,   6,   9,   9,   6,  15,  15,  15,  15,  /* [**  ********] */
-     15,  15,   0,   0,  15,  15,  15,  15,  15,  15,  15,  15,  /* [**  ********] */
-     15,  15,   0,   0,  15,  15,  15,  15,  15,  15,  15,  15,  /* [**  ********] */
-     15,  15,   0,   0,  15,  15,  15,  15,  15,  15,  15,  15,  /* [**  ********] */
-     11,  11,   0,   0,  13,  15,  15,  13,  13,  15,  15,  12,  /* [**  ********] */
+    0x47, 0x72, 0x00, 0x00, 0x67, 0x74,                     /* [ **     *** ] */
+    0xff, 0xfd, 0x00, 0x04, 0xff, 0xff,                     /* [****    ****] */
+    0xff, 0x6f, 0x60, 0x0b, 0xff, 0xff,                     /* [*****  *****] */
+    0xff, 0x0c, 0xe0, 0x3a, 0xff, 0xff,                     /* [** **  *****] */
+    0xff, 0x04, 0xfa, 0xb2, 0xff, 0xff,                     /* [**  *** ****] */
+    0xff, 0x00, 0xcf, 0xb0, 0xff, 0xff,                     /* [**  *** ****] */
+    0xff, 0x00, 0x5f, 0x30, 0xff, 0xff,                     /* [**   *  ****] */
+    0xff, 0x00, 0x05, 0x00, 0xff, 0xff,                     /* [**      ****] */
+    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,                     /* [**      ****] */
+    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,                     /* [**      ****] */
+    0xff, 0x00, 0x00, 0x00, 0xff, 0xff,                     /* [**      ****] */
+    0xff, 0x00, 0x69, 0x96, 0xff, 0xff,                     /* [**  ********] */
+    0xff, 0x00, 0xff, 0xff, 0xff, 0xff,                     /* [**  ********] */
+    0xff, 0x00, 0xff, 0xff, 0xff, 0xff,                     /* [**  ********] */
+    0xff, 0x00, 0xff, 0xff, 0xff, 0xff,                     /* [**  ********] */
+    0xbb, 0x00, 0xdf, 0xfd, 0xdf, 0xfc,                     /* [**  ********] */
 };
 
 const uint8_t checkbook_14_0x4e[] __attribute__((__progmem__)) = {   /* 'N' width: 12 */
-      5,   8,   8,   4,   0,   0,   0,   0,   0,   3,   3,       /* [ **        ] */
-     15,  15,  15,  15,   3,   0,   0,   0,   0,  14,  15,       /* [****     **] */
-     15,  15,   1,  12,  14,   1,   0,   0,   0,  15,  15,       /* [** **    **] */
-     15,  15,   0,   1,  14,  12,   0,   0,   0,  15,  15,       /* [**  **   **] */
-     15,  15,   0,   0,   4,  15,   9,   0,   0,  15,  15,       /* [**   **  **] */
-     15,  15,   0,   0,   0,   7,  15,   5,   0,  15,  15,       /* [**   **  **] */
-     15,  15,   0,   0,   0,   0,  11,  15,   3,  15,  15,       /* [**    ** **] */
-     15,  15,   0,   0,   0,   0,   1,  14,  14,  15,  15,       /* [**     ****] */
-     15,  15,   0,   0,   0,   0,   0,   3,  15,  15,  15,       /* [**      ***] */
-     15,  15,   0,   0,   0,   0,   0,   0,   6,  15,  15,       /* [**      ***] */
-     15,  15,   0,   0,   0,   0,   0,   0,   1,  15,  15,       /* [**       **] */
-     15,  15,   0,   0,   7,  11,  11,   8,   0,  15,  15,       /* [**  **** **] */
-     15,  15,   0,   0,  15,  15,  15,  15,   0,  15,  15,       /* [**  **** **] */
-     15,  15,   0,   0,  15,  15,  15,  15,   0,  15,  15,       /* [**  **** **] */
-     15,  15,   0,   0,  15,  15,  15,  15,   0,  15,  15,       /* [**  **** **] */
-     12,  12,   0,   0,  13,  15,  15,  12,   0,  12,  12,       /* [**  **** **] */
+    0x58, 0x84, 0x00, 0x00, 0x03, 0x30,                     /* [ **        ] */
+    0xff, 0xff, 0x30, 0x00, 0x0e, 0xf0,                     /* [****     **] */
+    0xff, 0x1c, 0xe1, 0x00, 0x0f, 0xf0,                     /* [** **    **] */
+    0xff, 0x01, 0xec, 0x00, 0x0f, 0xf0,                     /* [**  **   **] */
+    0xff, 0x00, 0x4f, 0x90, 0x0f, 0xf0,                     /* [**   **  **] */
+    0xff, 0x00, 0x07, 0xf5, 0x0f, 0xf0,                     /* [**   **  **] */
+    0xff, 0x00, 0x00, 0xbf, 0x3f, 0xf0,                     /* [**    ** **] */
+    0xff, 0x00, 0x00, 0x1e, 0xef, 0xf0,                     /* [**     ****] */
+    0xff, 0x00, 0x00, 0x03, 0xff, 0xf0,                     /* [**      ***] */
+    0xff, 0x00, 0x00, 0x00, 0x6f, 0xf0,                     /* [**      ***] */
+    0xff, 0x00, 0x00, 0x00, 0x1f, 0xf0,                     /* [**       **] */
+    0xff, 0x00, 0x7b, 0xb8, 0x0f, 0xf0,                     /* [**  **** **] */
+    0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0,                     /* [**  **** **] */
+    0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0,                     /* [**  **** **] */
+    0xff, 0x00, 0xff, 0xff, 0x0f, 0xf0,                     /* [**  **** **] */
+    0xcc, 0x00, 0xdf, 0xfc, 0x0c, 0xc0,                     /* [**  **** **] */
 };
 
 const uint8_t checkbook_14_0x4f[] __attribute__((__progmem__)) = {   /* 'O' width: 11 */
-     10,  15,  15,  15,  15,  15,  15,  15,  15,  11,            /* [**********] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,            /* [**********] */
-     15,  15,   4,   0,   0,   0,   0,   2,  14,  15,            /* [**      **] */
-     15,  15,   0,   0,   0,   0,   0,   0,  11,  15,            /* [**      **] */
-     15,  15,   0,   0,   0,   0,   0,   0,  11,  15,            /* [**      **] */
-     15,  15,   0,   0,   0,   0,   0,   0,  11,  15,            /* [**      **] */
-     15,  15,   0,   0,   0,   0,   0,   0,  11,  15,            /* [**      **] */
-     15,  15,   0,   0,   0,   0,   7,  13,  15,  15,            /* [**    ****] */
-     15,  15,   0,   0,   0,   0,  15,  15,  15,  15,            /* [**    ****] */
-     15,  15,   0,   0,   0,   0,  15,  15,  15,  15,            /* [**    ****] */
-     15,  15,   0,   0,   0,   0,  15,  15,  15,  15,            /* [**    ****] */
-     15,  15,   0,   0,   0,   0,  15,  15,  15,  15,            /* [**    ****] */
-     15,  15,   0,   0,   0,   0,  15,  15,  15,  15,            /* [**    ****] */
-     15,  15,   0,   0,   0,   0,  15,  15,  15,  15,            /* [**    ****] */
-     15,  15,   4,   0,   0,   3,  15,  15,  15,  15,            /* [**    ****] */
-     12,  15,  15,  15,  15,  15,  15,  15,  15,  11,            /* [**********] */
+    0xaf, 0xff, 0xff, 0xff, 0xfb,                           /* [**********] */
+    0xff, 0xff, 0xff, 0xff, 0xff,                           /* [**********] */
+    0xff, 0x40, 0x00, 0x02, 0xef,                           /* [**      **] */
+    0xff, 0x00, 0x00, 0x00, 0xbf,                           /* [**      **] */
+    0xff, 0x00, 0x00, 0x00, 0xbf,                           /* [**      **] */
+    0xff, 0x00, 0x00, 0x00, 0xbf,                           /* [**      **] */
+    0xff, 0x00, 0x00, 0x00, 0xbf,                           /* [**      **] */
+    0xff, 0x00, 0x00, 0x7d, 0xff,                           /* [**    ****] */
+    0xff, 0x00, 0x00, 0xff, 0xff,                           /* [**    ****] */
+    0xff, 0x00, 0x00, 0xff, 0xff,                           /* [**    ****] */
+    0xff, 0x00, 0x00, 0xff, 0xff,                           /* [**    ****] */
+    0xff, 0x00, 0x00, 0xff, 0xff,                           /* [**    ****] */
+    0xff, 0x00, 0x00, 0xff, 0xff,                           /* [**    ****] */
+    0xff, 0x00, 0x00, 0xff, 0xff,                           /* [**    ****] */
+    0xff, 0x40, 0x03, 0xff, 0xff,                           /* [**    ****] */
+    0xcf, 0xff, 0xff, 0xff, 0xfb,                           /* [**********] */
 };
 
 const uint8_t checkbook_14_0x50[] __attribute__((__progmem__)) = {   /* 'P' width: 11 */
-     10,  15,  15,  15,  15,  15,  15,  15,  15,  10,            /* [**********] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,            /* [**********] */
-     15,  15,   5,   0,   0,   0,   0,   3,  15,  15,            /* [**      **] */
-     15,  14,   0,   0,   0,   0,   0,   0,  15,  15,            /* [**      **] */
-     15,  13,   0,   0,   0,   0,   0,   0,  15,  15,            /* [**      **] */
-     15,  13,   0,   0,   0,   0,   0,   0,  15,  15,            /* [**      **] */
-     15,  13,   0,   0,   0,   0,   0,   0,  15,  15,            /* [**      **] */
-     15,  15,   2,   0,   0,   0,   0,   6,  15,  15,            /* [**     ***] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  10,            /* [**********] */
-     15,  15,  15,  15,   3,   0,   0,   0,   0,   0,            /* [****      ] */
-     15,  15,  15,  15,   0,   0,   0,   0,   0,   0,            /* [****      ] */
-     15,  15,  15,  15,   0,   0,   0,   0,   0,   0,            /* [****      ] */
-     15,  15,  15,  15,   0,   0,   0,   0,   0,   0,            /* [****      ] */
-     15,  15,  15,  15,   0,   0,   0,   0,   0,   0,            /* [****      ] */
-     15,  15,  15,  15,   0,   0,   0,   0,   0,   0,            /* [****      ] */
-     13,  15,  15,  13,   0,   0,   0,   0,   0,   0,            /* [****      ] */
+    0xaf, 0xff, 0xff, 0xff, 0xfa,                           /* [**********] */
+    0xff, 0xff, 0xff, 0xff, 0xff,                           /* [**********] */
+    0xff, 0x50, 0x00, 0x03, 0xff,                           /* [**      **] */
+    0xfe, 0x00, 0x00, 0x00, 0xff,                           /* [**      **] */
+    0xfd, 0x00, 0x00, 0x00, 0xff,                           /* [**      **] */
+    0xfd, 0x00, 0x00, 0x00, 0xff,                           /* [**      **] */
+    0xfd, 0x00, 0x00, 0x00, 0xff,                           /* [**      **] */
+    0xff, 0x20, 0x00, 0x06, 0xff,                           /* [**     ***] */
+    0xff, 0xff, 0xff, 0xff, 0xfa,                           /* [**********] */
+    0xff, 0xff, 0x30, 0x00, 0x00,                           /* [****      ] */
+    0xff, 0xff, 0x00, 0x00, 0x00,                           /* [****      ] */
+    0xff, 0xff, 0x00, 0x00, 0x00,                           /* [****      ] */
+    0xff, 0xff, 0x00, 0x00, 0x00,                           /* [****      ] */
+    0xff, 0xff, 0x00, 0x00, 0x00,                           /* [****      ] */
+    0xff, 0xff, 0x00, 0x00, 0x00,                           /* [****      ] */
+    0xdf, 0xfd, 0x00, 0x00, 0x00,                           /* [****      ] */
 };
 
 const uint8_t checkbook_14_0x51[] __attribute__((__progmem__)) = {   /* 'Q' width: 11 */
-     11,  15,  15,  15,  15,  15,  15,  15,   8,                 /* [*********] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,                 /* [*********] */
-     15,  13,   1,   0,   0,   0,   4,  15,  15,                 /* [**     **] */
-     15,  10,   0,   0,   0,   0,   0,  15,  15,                 /* [**     **] */
-     15,  10,   0,   0,   0,   0,   0,  15,  15,                 /* [**     **] */
-     15,  15,  10,   0,   0,   0,   0,  15,  15,                 /* [***    **] */
-     15,  15,  15,   0,   0,   0,   0,  15,  15,                 /* [***    **] */
-     15,  15,  15,   0,   0,   0,   0,  15,  15,                 /* [***    **] */
-     15,  15,  15,   0,   0,   0,   0,  15,  15,                 /* [***    **] */
-     15,  15,  15,   0,   0,   0,   0,  15,  15,                 /* [***    **] */
-     15,  15,  15,   0,   0,   0,   0,  15,  15,                 /* [***    **] */
-     15,  15,  15,   0,   3,   6,   0,  15,  15,                 /* [***  * **] */
-     15,  15,  15,   0,   6,  14,   0,  15,  15,                 /* [*** ** **] */
-     15,  15,  15,   0,   1,  15,   7,  15,  15,                 /* [***  ****] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,                 /* [*********] */
-      9,  15,  15,  15,  15,  15,  15,  14,   8,                 /* [*********] */
-      0,   0,   0,   0,   0,   5,  15,   1,   0,                 /* [      *  ] */
-      0,   0,   0,   0,   0,   0,  14,   4,   0,                 /* [      *  ] */
-      0,   0,   0,   0,   0,   0,   2,   0,   0,                 /* [         ] */
+    0xbf, 0xff, 0xff, 0xff, 0x80,                           /* [*********] */
+    0xff, 0xff, 0xff, 0xff, 0xf0,                           /* [*********] */
+    0xfd, 0x10, 0x00, 0x4f, 0xf0,                           /* [**     **] */
+    0xfa, 0x00, 0x00, 0x0f, 0xf0,                           /* [**     **] */
+    0xfa, 0x00, 0x00, 0x0f, 0xf0,                           /* [**     **] */
+    0xff, 0xa0, 0x00, 0x0f, 0xf0,                           /* [***    **] */
+    0xff, 0xf0, 0x00, 0x0f, 0xf0,                           /* [***    **] */
+    0xff, 0xf0, 0x00, 0x0f, 0xf0,                           /* [***    **] */
+    0xff, 0xf0, 0x00, 0x0f, 0xf0,                           /* [***    **] */
+    0xff, 0xf0, 0x00, 0x0f, 0xf0,                           /* [***    **] */
+    0xff, 0xf0, 0x00, 0x0f, 0xf0,                           /* [***    **] */
+    0xff, 0xf0, 0x36, 0x0f, 0xf0,                           /* [***  * **] */
+    0xff, 0xf0, 0x6e, 0x0f, 0xf0,                           /* [*** ** **] */
+    0xff, 0xf0, 0x1f, 0x7f, 0xf0,                           /* [***  ****] */
+    0xff, 0xff, 0xff, 0xff, 0xf0,                           /* [*********] */
+    0x9f, 0xff, 0xff, 0xfe, 0x80,                           /* [*********] */
+    0x00, 0x00, 0x05, 0xf1, 0x00,                           /* [      *  ] */
+    0x00, 0x00, 0x00, 0xe4, 0x00,                           /* [      *  ] */
+    0x00, 0x00, 0x00, 0x20, 0x00,                           /* [         ] */
 };
 
 const uint8_t checkbook_14_0x52[] __attribute__((__progmem__)) = {   /* 'R' width: 12 */
-     11,  15,  15,  15,  15,  15,  15,  15,  10,   0,   0,       /* [*********  ] */
-     15,  15,  15,  15,  15,  15,  15,  15,  14,   0,   0,       /* [*********  ] */
-     15,  15,   2,   0,   0,   0,   2,  15,  14,   0,   0,       /* [**     **  ] */
-     15,  12,   0,   0,   0,   0,   0,  15,  14,   0,   0,       /* [**     **  ] */
-     15,  12,   0,   0,   0,   0,   0,  15,  14,   0,   0,       /* [**     **  ] */
-     15,  12,   0,   0,   0,   0,   0,  15,  14,   0,   0,       /* [**     **  ] */
-     15,  15,   3,   0,   0,   0,   4,  15,  15,   4,   0,       /* [**     **  ] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  13,       /* [***********] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,       /* [***********] */
-     15,  15,  15,  15,   2,   0,   3,  15,  15,  15,  15,       /* [****   ****] */
-     15,  15,  15,  15,   0,   0,   0,  15,  15,  15,  15,       /* [****   ****] */
-     15,  15,  15,  15,   0,   0,   0,  15,  15,  15,  15,       /* [****   ****] */
-     15,  15,  15,  15,   0,   0,   0,  15,  15,  15,  15,       /* [****   ****] */
-     15,  15,  15,  15,   0,   0,   0,  15,  15,  15,  15,       /* [****   ****] */
-     15,  15,  15,  15,   0,   0,   0,  15,  15,  15,  15,       /* [****   ****] */
-     12,  15,  15,  12,   0,   0,   0,  12,  15,  15,  13,       /* [****   ****] */
+    0xbf, 0xff, 0xff, 0xff, 0xa0, 0x00,                     /* [*********  ] */
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,                     /* [*********  ] */
+    0xff, 0x20, 0x00, 0x2f, 0xe0, 0x00,                     /* [**     **  ] */
+    0xfc, 0x00, 0x00, 0x0f, 0xe0, 0x00,                     /* [**     **  ] */
+    0xfc, 0x00, 0x00, 0x0f, 0xe0, 0x00,                     /* [**     **  ] */
+    0xfc, 0x00, 0x00, 0x0f, 0xe0, 0x00,                     /* [**     **  ] */
+    0xff, 0x30, 0x00, 0x4f, 0xf4, 0x00,                     /* [**     **  ] */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,                     /* [***********] */
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,                     /* [***********] */
+    0xff, 0xff, 0x20, 0x3f, 0xff, 0xf0,                     /* [****   ****] */
+    0xff, 0xff, 0x00, 0x0f, 0xff, 0xf0,                     /* [****   ****] */
+    0xff, 0xff, 0x00, 0x0f, 0xff, 0xf0,                     /* [****   ****] */
+    0xff, 0xff, 0x00, 0x0f, 0xff, 0xf0,                     /* [****   ****] */
+    0xff, 0xff, 0x00, 0x0f, 0xff, 0xf0,                     /* [****   ****] */
+    0xff, 0xff, 0x00, 0x0f, 0xff, 0xf0,                     /* [****   ****] */
+    0xcf, 0xfc, 0x00, 0x0c, 0xff, 0xd0,                     /* [****   ****] */
 };
 
 const uint8_t checkbook_14_0x53[] __attribute__((__progmem__)) = {   /* 'S' width: 10 */
-     11,  15,  15,  15,  15,  15,  15,  15,  11,                 /* [*********] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,                 /* [*********] */
-     15,  15,   4,   0,   0,   0,   1,  15,  15,                 /* [**     **] */
-     15,  15,   0,   0,   0,   0,   0,  15,  15,                 /* [**     **] */
-     15,  15,   0,   0,   0,   0,   0,  11,  12,                 /* [**     **] */
-     15,  15,   0,   0,   0,   0,   0,   0,   0,                 /* [**       ] */
-     15,  15,   4,   0,   0,   0,   0,   0,   0,                 /* [**       ] */
-     15,  15,  15,  15,  15,  15,  15,  15,  11,                 /* [*********] */
-     11,  15,  15,  15,  15,  15,  15,  15,  15,                 /* [*********] */
-      0,   0,   0,   0,   0,   0,   2,  15,  15,                 /* [       **] */
-      0,   0,   0,   0,   0,   0,   0,  14,  15,                 /* [       **] */
-      6,  10,   9,   0,   0,   0,   0,  14,  15,                 /* [***    **] */
-     13,  15,  15,   2,   0,   0,   0,  14,  15,                 /* [***    **] */
-     14,  15,  15,   3,   0,   0,   0,  14,  15,                 /* [***    **] */
-     14,  15,  15,   8,   0,   0,   3,  15,  15,                 /* [****   **] */
-     11,  15,  15,  15,  15,  15,  15,  15,  13,                 /* [*********] */
+    0xbf, 0xff, 0xff, 0xff, 0xb0,                           /* [*********] */
+    0xff, 0xff, 0xff, 0xff, 0xf0,                           /* [*********] */
+    0xff, 0x40, 0x00, 0x1f, 0xf0,                           /* [**     **] */
+    0xff, 0x00, 0x00, 0x0f, 0xf0,                           /* [**     **] */
+    0xff, 0x00, 0x00, 0x0b, 0xc0,                           /* [**     **] */
+    0xff, 0x00, 0x00, 0x00, 0x00,                           /* [**       ] */
+    0xff, 0x40, 0x00, 0x00, 0x00,                           /* [**       ] */
+    0xff, 0xff, 0xff, 0xff, 0xb0,                           /* [*********] */
+    0xbf, 0xff, 0xff, 0xff, 0xf0,                           /* [*********] */
+    0x00, 0x00, 0x00, 0x2f, 0xf0,                           /* [       **] */
+    0x00, 0x00, 0x00, 0x0e, 0xf0,                           /* [       **] */
+    0x6a, 0x90, 0x00, 0x0e, 0xf0,                           /* [***    **] */
+    0xdf, 0xf2, 0x00, 0x0e, 0xf0,                           /* [***    **] */
+    0xef, 0xf3, 0x00, 0x0e, 0xf0,                           /* [***    **] */
+    0xef, 0xf8, 0x00, 0x3f, 0xf0,                           /* [****   **] */
+    0xbf, 0xff, 0xff, 0xff, 0xd0,                           /* [*********] */
 };
 
 const uint8_t checkbook_14_0x54[] __attribute__((__progmem__)) = {   /* 'T' width: 11 */
-      4,  15,  15,  15,  15,  15,  15,  15,  15,  15,   5,       /* [ ********* ] */
-      4,  14,  14,  15,  15,  15,  15,  15,  15,  15,   5,       /* [ ********* ] */
-      0,   0,   0,   2,  15,  15,  15,  15,   2,   0,   0,       /* [    ****   ] */
-      0,   0,   0,   0,  15,  15,  15,  15,   0,   0,   0,       /* [    ****   ] */
-      0,   0,   0,   0,  15,  15,  15,  15,   0,   0,   0,       /* [    ****   ] */
-      0,   0,   0,   0,  15,  15,  15,  15,   0,   0,   0,       /* [    ****   ] */
-      0,   0,   0,   0,  15,  15,  15,  15,   0,   0,   0,       /* [    ****   ] */
-      0,   0,   0,   0,  15,  15,  15,  15,   0,   0,   0,       /* [    ****   ] */
-      0,   0,   0,   0,  15,  15,  15,  15,   0,   0,   0,       /* [    ****   ] */
-      0,   0,   0,   0,  15,  15,  15,  15,   0,   0,   0,       /* [    ****   ] */
-      0,   0,   0,   0,  15,  15,  15,  15,   0,   0,   0,       /* [    ****   ] */
-      0,   0,   0,   0,  15,  15,  15,  15,   0,   0,   0,       /* [    ****   ] */
-      0,   0,   0,   0,  15,  15,  15,  15,   0,   0,   0,       /* [    ****   ] */
-      0,   0,   0,   0,  15,  15,  15,  15,   0,   0,   0,       /* [    ****   ] */
-      0,   0,   0,   0,  15,  15,  15,  15,   0,   0,   0,       /* [    ****   ] */
-      0,   0,   0,   0,  13,  15,  15,  13,   0,   0,   0,       /* [    ****   ] */
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0x50,                     /* [ ********* ] */
+    0x4e, 0xef, 0xff, 0xff, 0xff, 0x50,                     /* [ ********* ] */
+    0x00, 0x02, 0xff, 0xff, 0x20, 0x00,                     /* [    ****   ] */
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00,                     /* [    ****   ] */
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00,                     /* [    ****   ] */
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00,                     /* [    ****   ] */
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00,                     /* [    ****   ] */
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00,                     /* [    ****   ] */
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00,                     /* [    ****   ] */
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00,                     /* [    ****   ] */
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00,                     /* [    ****   ] */
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00,                     /* [    ****   ] */
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00,                     /* [    ****   ] */
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00,                     /* [    ****   ] */
+    0x00, 0x00, 0xff, 0xff, 0x00, 0x00,                     /* [    ****   ] */
+    0x00, 0x00, 0xdf, 0xfd, 0x00, 0x00,                     /* [    ****   ] */
 };
 
 const uint8_t checkbook_14_0x55[] __attribute__((__progmem__)) = {   /* 'U' width: 10 */
-      4,   4,   0,   0,   0,   4,   8,   8,   4,                 /* [      ** ] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   2,   0,   2,  15,  15,  15,  15,                 /* [**   ****] */
-     12,  15,  15,  15,  15,  15,  15,  15,  13,                 /* [*********] */
+    0x44, 0x00, 0x04, 0x88, 0x40,                           /* [      ** ] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x20, 0x2f, 0xff, 0xf0,                           /* [**   ****] */
+    0xcf, 0xff, 0xff, 0xff, 0xd0,                           /* [*********] */
 };
 
 const uint8_t checkbook_14_0x56[] __attribute__((__progmem__)) = {   /* 'V' width: 10 */
-      4,   5,   0,   0,   0,   6,   8,   8,   6,                 /* [     ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   0,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-     15,  15,   1,   0,   0,  15,  15,  15,  15,                 /* [**   ****] */
-      6,  15,   8,   0,   0,  15,  15,  15,  15,                 /* [***  ****] */
-      0,  12,  15,   1,   0,  15,  15,  15,   8,                 /* [ **  ****] */
-      0,   2,  15,   7,   2,  15,  15,   6,   0,                 /* [  ** *** ] */
-      0,   0,   6,  14,  12,  15,   4,   0,   0,                 /* [  ****   ] */
-      0,   0,   0,  11,  13,   2,   0,   0,   0,                 /* [   **    ] */
+    0x45, 0x00, 0x06, 0x88, 0x60,                           /* [     ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x00, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0xff, 0x10, 0x0f, 0xff, 0xf0,                           /* [**   ****] */
+    0x6f, 0x80, 0x0f, 0xff, 0xf0,                           /* [***  ****] */
+    0x0c, 0xf1, 0x0f, 0xff, 0x80,                           /* [ **  ****] */
+    0x02, 0xf7, 0x2f, 0xf6, 0x00,                           /* [  ** *** ] */
+    0x00, 0x6e, 0xcf, 0x40, 0x00,                           /* [  ****   ] */
+    0x00, 0x0b, 0xd2, 0x00, 0x00,                           /* [   **    ] */
 };
 
 const uint8_t checkbook_14_0x57[] __attribute__((__progmem__)) = {   /* 'W' width: 13 */
-      2,   6,   6,   3,   0,   0,   2,   6,   6,   3,   3,   3,  /* [ **    **   ] */
-     15,  15,  15,  15,   0,   0,  15,  15,  15,  15,  15,  15,  /* [****  ******] */
-     15,  15,  15,  15,   0,   0,  15,  15,  15,  15,  15,  15,  /* [****  ******] */
-     15,  15,  15,  15,   0,   0,  15,  15,  15,  15,  15,  15,  /* [****  ******] */
-     15,  15,  15,  15,   0,   0,  15,  15,  15,  15,  15,  15,  /* [****  ******] */
-     15,  15,  15,  15,   0,   0,   3,   5,   5,   3,  15,  15,  /* [****      **] */
-     15,  15,  15,  15,   0,   0,   6,   1,   0,   0,  15,  15,  /* [****  *   **] */
-     15,  15,  15,  15,   0,   8,  15,  11,   0,   0,  15,  15,  /* [**** ***  **] */
-     15,  15,  15,  15,   0,  13,  15,  15,   0,   0,  15,  15,  /* [**** ***  **] */
-     15,  15,  15,  15,   3,  15,   6,  15,   5,   0,  15,  15,  /* [**** ***  **] */
-     15,  15,  15,  15,   8,  11,   0,  10,  10,   0,  15,  15,  /* [****** ** **] */
-     15,  15,  15,  15,  15,   6,   0,   2,  15,   0,  15,  15,  /* [******  * **] */
-     15,  15,  15,  15,  15,   1,   0,   0,   9,   5,  15,  15,  /* [*****   * **] */
-     15,  15,  15,  15,  11,   0,   0,   0,   1,   9,  15,  15,  /* [*****    ***] */
-     15,  15,  15,  15,   6,   0,   0,   0,   0,   7,  15,  15,  /* [*****    ***] */
-     12,  15,  15,  11,   0,   0,   0,   0,   0,   0,  15,  12,  /* [****      **] */
+    0x26, 0x63, 0x00, 0x26, 0x63, 0x33,                     /* [ **    **   ] */
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,                     /* [****  ******] */
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,                     /* [****  ******] */
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,                     /* [****  ******] */
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff,                     /* [****  ******] */
+    0xff, 0xff, 0x00, 0x35, 0x53, 0xff,                     /* [****      **] */
+    0xff, 0xff, 0x00, 0x61, 0x00, 0xff,                     /* [****  *   **] */
+    0xff, 0xff, 0x08, 0xfb, 0x00, 0xff,                     /* [**** ***  **] */
+    0xff, 0xff, 0x0d, 0xff, 0x00, 0xff,                     /* [**** ***  **] */
+    0xff, 0xff, 0x3f, 0x6f, 0x50, 0xff,                     /* [**** ***  **] */
+    0xff, 0xff, 0x8b, 0x0a, 0xa0, 0xff,                     /* [****** ** **] */
+    0xff, 0xff, 0xf6, 0x02, 0xf0, 0xff,                     /* [******  * **] */
+    0xff, 0xff, 0xf1, 0x00, 0x95, 0xff,                     /* [*****   * **] */
+    0xff, 0xff, 0xb0, 0x00, 0x19, 0xff,                     /* [*****    ***] */
+    0xff, 0xff, 0x60, 0x00, 0x07, 0xff,                     /* [*****    ***] */
+    0xcf, 0xfb, 0x00, 0x00, 0x00, 0xfc,                     /* [****      **] */
 };
 
 const uint8_t checkbook_14_0x58[] __attribute__((__progmem__)) = {   /* 'X' width: 10 */
-      4,   5,   0,   0,   0,   0,   0,   3,   4,                 /* [         ] */
-     14,  15,   0,   0,   0,   0,   0,  12,  15,                 /* [**     **] */
-     14,  15,   0,   0,   0,   0,   0,  13,  15,                 /* [**     **] */
-     14,  15,   0,   0,   0,   0,   0,  13,  15,                 /* [**     **] */
-     14,  15,   3,   0,   0,   0,   2,  15,  14,                 /* [**     **] */
-      4,  14,  14,   3,   0,   2,  14,  15,   5,                 /* [ **   ** ] */
-      0,   1,  11,  15,  11,  15,  12,   2,   0,                 /* [  *****  ] */
-      0,   0,   1,  15,  15,  15,   0,   0,   0,                 /* [   ***   ] */
-      0,   0,   6,  15,  15,  15,   4,   0,   0,                 /* [  ****   ] */
-      0,  10,  15,  11,   5,  11,  15,   8,   0,                 /* [ *** *** ] */
-     12,  15,   9,   0,   0,   0,   9,  15,  11,                 /* [***   ***] */
-     15,  15,   0,   0,   0,   0,   0,  15,  14,                 /* [**     **] */
-     15,  15,   0,   0,   0,   0,   0,  15,  14,                 /* [**     **] */
-     15,  15,   0,   0,   0,   0,   0,  15,  14,                 /* [**     **] */
-     15,  15,   0,   0,   0,   0,   0,  15,  14,                 /* [**     **] */
-     11,  11,   0,   0,   0,   0,   0,  12,  11,                 /* [**     **] */
+    0x45, 0x00, 0x00, 0x03, 0x40,                           /* [         ] */
+    0xef, 0x00, 0x00, 0x0c, 0xf0,                           /* [**     **] */
+    0xef, 0x00, 0x00, 0x0d, 0xf0,                           /* [**     **] */
+    0xef, 0x00, 0x00, 0x0d, 0xf0,                           /* [**     **] */
+    0xef, 0x30, 0x00, 0x2f, 0xe0,                           /* [**     **] */
+    0x4e, 0xe3, 0x02, 0xef, 0x50,                           /* [ **   ** ] */
+    0x01, 0xbf, 0xbf, 0xc2, 0x00,                           /* [  *****  ] */
+    0x00, 0x1f, 0xff, 0x00, 0x00,                           /* [   ***   ] */
+    0x00, 0x6f, 0xff, 0x40, 0x00,                           /* [  ****   ] */
+    0x0a, 0xfb, 0x5b, 0xf8, 0x00,                           /* [ *** *** ] */
+    0xcf, 0x90, 0x00, 0x9f, 0xb0,                           /* [***   ***] */
+    0xff, 0x00, 0x00, 0x0f, 0xe0,                           /* [**     **] */
+    0xff, 0x00, 0x00, 0x0f, 0xe0,                           /* [**     **] */
+    0xff, 0x00, 0x00, 0x0f, 0xe0,                           /* [**     **] */
+    0xff, 0x00, 0x00, 0x0f, 0xe0,                           /* [**     **] */
+    0xbb, 0x00, 0x00, 0x0c, 0xb0,                           /* [**     **] */
 };
 
 const uint8_t checkbook_14_0x59[] __attribute__((__progmem__)) = {   /* 'Y' width: 10 */
-      2,   2,   0,   0,   0,   0,   0,   3,   4,                 /* [         ] */
-     14,  15,   0,   0,   0,   0,   0,  15,  15,                 /* [**     **] */
-     15,  15,   0,   0,   0,   0,   0,  15,  15,                 /* [**     **] */
-     15,  15,   0,   0,   0,   0,   0,  15,  15,                 /* [**     **] */
-     15,  15,   0,   0,   0,   0,   0,  15,  15,                 /* [**     **] */
-     15,  15,   0,   0,   0,   0,   0,  15,  15,                 /* [**     **] */
-     15,  15,   3,   0,   0,   0,   1,  15,  14,                 /* [**     **] */
-      4,  14,  15,   5,   0,   0,   8,  15,   4,                 /* [ **   ** ] */
-      0,   0,  10,  15,  11,  11,  15,   5,   0,                 /* [  *****  ] */
-      0,   0,   1,  15,  15,  15,  15,   0,   0,                 /* [   ****  ] */
-      0,   0,   0,  15,  15,  15,  15,   0,   0,                 /* [   ****  ] */
-      0,   0,   0,  15,  15,  15,  15,   0,   0,                 /* [   ****  ] */
-      0,   0,   0,  15,  15,  15,  15,   0,   0,                 /* [   ****  ] */
-      0,   0,   0,  15,  15,  15,  15,   0,   0,                 /* [   ****  ] */
-      0,   0,   0,  15,  15,  15,  15,   0,   0,                 /* [   ****  ] */
-      0,   0,   0,  13,  15,  15,  11,   0,   0,                 /* [   ****  ] */
+    0x22, 0x00, 0x00, 0x03, 0x40,                           /* [         ] */
+    0xef, 0x00, 0x00, 0x0f, 0xf0,                           /* [**     **] */
+    0xff, 0x00, 0x00, 0x0f, 0xf0,                           /* [**     **] */
+    0xff, 0x00, 0x00, 0x0f, 0xf0,                           /* [**     **] */
+    0xff, 0x00, 0x00, 0x0f, 0xf0,                           /* [**     **] */
+    0xff, 0x00, 0x00, 0x0f, 0xf0,                           /* [**     **] */
+    0xff, 0x30, 0x00, 0x1f, 0xe0,                           /* [**     **] */
+    0x4e, 0xf5, 0x00, 0x8f, 0x40,                           /* [ **   ** ] */
+    0x00, 0xaf, 0xbb, 0xf5, 0x00,                           /* [  *****  ] */
+    0x00, 0x1f, 0xff, 0xf0, 0x00,                           /* [   ****  ] */
+    0x00, 0x0f, 0xff, 0xf0, 0x00,                           /* [   ****  ] */
+    0x00, 0x0f, 0xff, 0xf0, 0x00,                           /* [   ****  ] */
+    0x00, 0x0f, 0xff, 0xf0, 0x00,                           /* [   ****  ] */
+    0x00, 0x0f, 0xff, 0xf0, 0x00,                           /* [   ****  ] */
+    0x00, 0x0f, 0xff, 0xf0, 0x00,                           /* [   ****  ] */
+    0x00, 0x0d, 0xff, 0xb0, 0x00,                           /* [   ****  ] */
 };
 
 const uint8_t checkbook_14_0x5a[] __attribute__((__progmem__)) = {   /* 'Z' width: 11 */
-     13,  15,  15,  15,  15,  15,  15,  15,  15,   8,            /* [**********] */
-     15,  15,  15,  15,  15,  15,  15,  15,  15,   5,            /* [********* ] */
-     15,  15,   4,   0,   0,   0,   8,  15,  13,   0,            /* [**    *** ] */
-     15,  15,   0,   0,   0,   0,  14,  15,   6,   0,            /* [**    *** ] */
-     15,  15,   0,   0,   0,   7,  15,  13,   0,   0,            /* [**   ***  ] */
-      5,   6,   0,   0,   0,  14,  15,   6,   0,   0,            /* [ *   ***  ] */
-      0,   0,   0,   0,   7,  15,  14,   0,   0,   0,            /* [    ***   ] */
-      0,   0,   0,   0,  14,  15,   6,   0,   0,   0,            /* [    ***   ] */
-      0,   0,   0,   7,  15,  14,   0,   0,   0,   0,            /* [   ***    ] */
-      0,   0,   0,  14,  15,   6,   0,   0,   0,   0,            /* [   ***    ] */
-      0,   0,   7,  15,  14,   0,   0,   0,   0,   0,            /* [  ***     ] */
-      0,   0,  14,  15,   7,   0,  11,  14,  14,  12,            /* [  *** ****] */
-      0,   6,  15,  14,   0,   0,  15,  15,  15,  15,            /* [ ***  ****] */
-      0,  14,  15,   7,   0,   0,  15,  15,  15,  15,            /* [ ***  ****] */
-      6,  15,  15,   0,   0,   0,  15,  15,  15,  15,            /* [***   ****] */
-     12,  15,  15,  15,  15,  15,  15,  15,  15,  13,            /* [**********] */
-      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,            /* [          ] */
+    0xdf, 0xff, 0xff, 0xff, 0xf8,                           /* [**********] */
+    0xff, 0xff, 0xff, 0xff, 0xf5,                           /* [********* ] */
+    0xff, 0x40, 0x00, 0x8f, 0xd0,                           /* [**    *** ] */
+    0xff, 0x00, 0x00, 0xef, 0x60,                           /* [**    *** ] */
+    0xff, 0x00, 0x07, 0xfd, 0x00,                           /* [**   ***  ] */
+    0x56, 0x00, 0x0e, 0xf6, 0x00,                           /* [ *   ***  ] */
+    0x00, 0x00, 0x7f, 0xe0, 0x00,                           /* [    ***   ] */
+    0x00, 0x00, 0xef, 0x60, 0x00,                           /* [    ***   ] */
+    0x00, 0x07, 0xfe, 0x00, 0x00,                           /* [   ***    ] */
+    0x00, 0x0e, 0xf6, 0x00, 0x00,                           /* [   ***    ] */
+    0x00, 0x7f, 0xe0, 0x00, 0x00,                           /* [  ***     ] */
+    0x00, 0xef, 0x70, 0xbe, 0xec,                           /* [  *** ****] */
+    0x06, 0xfe, 0x00, 0xff, 0xff,                           /* [ ***  ****] */
+    0x0e, 0xf7, 0x00, 0xff, 0xff,                           /* [ ***  ****] */
+    0x6f, 0xf0, 0x00, 0xff, 0xff,                           /* [***   ****] */
+    0xcf, 0xff, 0xff, 0xff, 0xfd,                           /* [**********] */
+    0x00, 0x00, 0x00, 0x00, 0x00,                           /* [          ] */
 };
 
 const uint8_t checkbook_14_0x61[] __attribute__((__progmem__)) = {   /* 'a' width: 7 */
-      0,   3,  15,  15,  15,  14,                                /* [  ****] */
-      0,   5,  15,   0,   0,  15,                                /* [  *  *] */
-      0,   5,  14,   0,   0,  15,                                /* [  *  *] */
-      0,   5,  14,   0,   0,  15,                                /* [  *  *] */
-      2,  11,  15,  15,  15,  15,                                /* [ *****] */
-     15,  15,  15,   0,   1,  15,                                /* [***  *] */
-     15,  15,  15,   0,   0,  15,                                /* [***  *] */
-     15,  15,  15,   0,   0,  15,                                /* [***  *] */
-     14,  15,  13,   0,   0,  13,                                /* [***  *] */
+    0x03, 0xff, 0xfe,                                       /* [  ****] */
+    0x05, 0xf0, 0x0f,                                       /* [  *  *] */
+    0x05, 0xe0, 0x0f,                                       /* [  *  *] */
+    0x05, 0xe0, 0x0f,                                       /* [  *  *] */
+    0x2b, 0xff, 0xff,                                       /* [ *****] */
+    0xff, 0xf0, 0x1f,                                       /* [***  *] */
+    0xff, 0xf0, 0x0f,                                       /* [***  *] */
+    0xff, 0xf0, 0x0f,                                       /* [***  *] */
+    0xef, 0xd0, 0x0d,                                       /* [***  *] */
 };
 
 const uint8_t checkbook_14_0x62[] __attribute__((__progmem__)) = {   /* 'b' width: 7 */
-     14,  15,  15,  15,  15,  14,                                /* [******] */
-     15,  15,  15,   1,   1,  15,                                /* [***  *] */
-     15,  15,  15,   0,   0,  15,                                /* [***  *] */
-     15,  15,  15,   1,   1,  14,                                /* [***  *] */
-     15,  15,  15,  15,  15,  14,                                /* [******] */
-     15,  15,  15,   1,   0,  14,                                /* [***  *] */
-     15,  15,  15,   0,   0,  15,                                /* [***  *] */
-     15,  15,  15,   1,   0,  13,                                /* [***  *] */
-     13,  15,  15,  15,  15,  14,                                /* [******] */
+    0xef, 0xff, 0xfe,                                       /* [******] */
+    0xff, 0xf1, 0x1f,                                       /* [***  *] */
+    0xff, 0xf0, 0x0f,                                       /* [***  *] */
+    0xff, 0xf1, 0x1e,                                       /* [***  *] */
+    0xff, 0xff, 0xfe,                                       /* [******] */
+    0xff, 0xf1, 0x0e,                                       /* [***  *] */
+    0xff, 0xf0, 0x0f,                                       /* [***  *] */
+    0xff, 0xf1, 0x0d,                                       /* [***  *] */
+    0xdf, 0xff, 0xfe,                                       /* [******] */
 };
 
 const uint8_t checkbook_14_0x63[] __attribute__((__progmem__)) = {   /* 'c' width: 6 */
-     13,  15,  15,  15,  14,                                     /* [*****] */
-     15,   1,  15,  15,  15,                                     /* [* ***] */
-     15,   0,  13,  15,  13,                                     /* [* ***] */
-     15,   0,   0,   0,   0,                                     /* [*    ] */
-     15,   0,   0,   0,   0,                                     /* [*    ] */
-     15,   0,   0,   0,   0,                                     /* [*    ] */
-     15,   0,   0,   5,  14,                                     /* [*   *] */
-     15,   1,   0,   9,  15,                                     /* [*  **] */
-     14,  15,  15,  15,  14,                                     /* [*****] */
+    0xdf, 0xff, 0xe0,                                       /* [*****] */
+    0xf1, 0xff, 0xf0,                                       /* [* ***] */
+    0xf0, 0xdf, 0xd0,                                       /* [* ***] */
+    0xf0, 0x00, 0x00,                                       /* [*    ] */
+    0xf0, 0x00, 0x00,                                       /* [*    ] */
+    0xf0, 0x00, 0x00,                                       /* [*    ] */
+    0xf0, 0x05, 0xe0,                                       /* [*   *] */
+    0xf1, 0x09, 0xf0,                                       /* [*  **] */
+    0xef, 0xff, 0xe0,                                       /* [*****] */
 };
 
 const uint8_t checkbook_14_0x64[] __attribute__((__progmem__)) = {   /* 'd' width: 7 */
-     13,  15,  15,  15,  14,   4,                                /* [***** ] */
-     15,  15,  15,   1,   2,  14,                                /* [***  *] */
-     15,  15,  15,   0,   0,  15,                                /* [***  *] */
-     15,  15,  15,   0,   0,  15,                                /* [***  *] */
-     15,  15,  15,   0,   0,  15,                                /* [***  *] */
-     15,  15,  15,   0,   0,  15,                                /* [***  *] */
-     15,  15,  15,   0,   0,  15,                                /* [***  *] */
-     15,  15,  15,   1,   3,  14,                                /* [***  *] */
-     14,  15,  15,  15,  13,   4,                                /* [***** ] */
+    0xdf, 0xff, 0xe4,                                       /* [***** ] */
+    0xff, 0xf1, 0x2e,                                       /* [***  *] */
+    0xff, 0xf0, 0x0f,                                       /* [***  *] */
+    0xff, 0xf0, 0x0f,                                       /* [***  *] */
+    0xff, 0xf0, 0x0f,                                       /* [***  *] */
+    0xff, 0xf0, 0x0f,                                       /* [***  *] */
+    0xff, 0xf0, 0x0f,                                       /* [***  *] */
+    0xff, 0xf1, 0x3e,                                       /* [***  *] */
+    0xef, 0xff, 0xd4,                                       /* [***** ] */
 };
 
 const uint8_t checkbook_14_0x65[] __attribute__((__progmem__)) = {   /* 'e' width: 6 */
-     14,  15,  15,  15,  15,   8,                                /* [******] */
-     15,   9,   0,   0,   0,   0,                                /* [**    ] */
-     15,   7,   0,   0,   0,   0,                                /* [**    ] */
-     15,   9,   0,   0,   0,   0,                                /* [**    ] */
-     15,  15,  15,  15,  15,   8,                                /* [******] */
-     15,  15,  15,   1,   0,   0,                                /* [***   ] */
-     15,  15,  15,   0,   0,   0,                                /* [***   ] */
-     15,  15,  15,   1,   0,   0,                                /* [***   ] */
-     13,  15,  15,  15,  15,   8,                                /* [******] */
+    0xef, 0xff, 0xf8,                                       /* [******] */
+    0xf9, 0x00, 0x00,                                       /* [**    ] */
+    0xf7, 0x00, 0x00,                                       /* [**    ] */
+    0xf9, 0x00, 0x00,                                       /* [**    ] */
+    0xff, 0xff, 0xf8,                                       /* [******] */
+    0xff, 0xf1, 0x00,                                       /* [***   ] */
+    0xff, 0xf0, 0x00,                                       /* [***   ] */
+    0xff, 0xf1, 0x00,                                       /* [***   ] */
+    0xdf, 0xff, 0xf8,                                       /* [******] */
 };
 
 const uint8_t checkbook_14_0x66[] __attribute__((__progmem__)) = {   /* 'f' width: 6 */
-      0,  15,  15,  15,  15,  15,   8,                           /* [ ******] */
-      1,  15,  15,   2,   0,   0,   0,                           /* [ **    ] */
-      1,  15,  15,   0,   0,   0,   0,                           /* [ **    ] */
-      1,  15,  15,   2,   0,   0,   0,                           /* [ **    ] */
-      0,   3,  15,  15,  15,  15,   6,                           /* [  *****] */
-      0,   0,  15,   2,   0,   0,   0,                           /* [  *    ] */
-      0,   0,  15,   0,   0,   0,   0,                           /* [  *    ] */
-      0,   0,  15,   0,   0,   0,   0,                           /* [  *    ] */
-      0,   0,  14,   0,   0,   0,   0,                           /* [  *    ] */
+    0x0f, 0xff, 0xff, 0x80,                                 /* [ ******] */
+    0x1f, 0xf2, 0x00, 0x00,                                 /* [ **    ] */
+    0x1f, 0xf0, 0x00, 0x00,                                 /* [ **    ] */
+    0x1f, 0xf2, 0x00, 0x00,                                 /* [ **    ] */
+    0x03, 0xff, 0xff, 0x60,                                 /* [  *****] */
+    0x00, 0xf2, 0x00, 0x00,                                 /* [  *    ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *    ] */
+    0x00, 0xf0, 0x00, 0x00,                                 /* [  *    ] */
+    0x00, 0xe0, 0x00, 0x00,                                 /* [  *    ] */
 };
 
 const uint8_t checkbook_14_0x67[] __attribute__((__progmem__)) = {   /* 'g' width: 8 */
-     14,  15,  15,  15,  15,  15,  12,                           /* [*******] */
-     15,  15,  15,   1,   0,  14,  13,                           /* [***  **] */
-     15,  15,  15,   0,   0,   7,   6,                           /* [***  **] */
-     15,  15,  15,   0,   0,   0,   0,                           /* [***    ] */
-     15,  15,  15,   0,   4,  15,  14,                           /* [***  **] */
-     15,  15,  15,   0,   0,   1,  15,                           /* [***   *] */
-     15,  15,  15,   0,   0,   0,  15,                           /* [***   *] */
-     15,  15,  15,   1,   0,   1,  15,                           /* [***   *] */
-     14,  15,  15,  15,  15,  15,  14,                           /* [*******] */
+    0xef, 0xff, 0xff, 0xc0,                                 /* [*******] */
+    0xff, 0xf1, 0x0e, 0xd0,                                 /* [***  **] */
+    0xff, 0xf0, 0x07, 0x60,                                 /* [***  **] */
+    0xff, 0xf0, 0x00, 0x00,                                 /* [***    ] */
+    0xff, 0xf0, 0x4f, 0xe0,                                 /* [***  **] */
+    0xff, 0xf0, 0x01, 0xf0,                                 /* [***   *] */
+    0xff, 0xf0, 0x00, 0xf0,                                 /* [***   *] */
+    0xff, 0xf1, 0x01, 0xf0,                                 /* [***   *] */
+    0xef, 0xff, 0xff, 0xe0,                                 /* [*******] */
 };
 
 const uint8_t checkbook_14_0x68[] __attribute__((__progmem__)) = {   /* 'h' width: 8 */
-      2,   0,   0,   0,   1,   0,   0,                           /* [       ] */
-     15,   0,   0,   0,  12,   7,   0,                           /* [*   ** ] */
-     15,   0,   0,   0,  12,   8,   0,                           /* [*   ** ] */
-     15,   0,   0,   0,  12,   8,   0,                           /* [*   ** ] */
-     15,   1,   0,   0,  14,   9,   0,                           /* [*   ** ] */
-     15,  15,  15,  15,  15,  15,  13,                           /* [*******] */
-     15,  14,   0,   1,  15,  15,  15,                           /* [**  ***] */
-     15,  13,   0,   0,  15,  15,  15,                           /* [**  ***] */
-     15,  13,   0,   0,  15,  15,  15,                           /* [**  ***] */
-     15,  12,   0,   0,  15,  15,  15,                           /* [**  ***] */
+    0x20, 0x00, 0x10, 0x00,                                 /* [       ] */
+    0xf0, 0x00, 0xc7, 0x00,                                 /* [*   ** ] */
+    0xf0, 0x00, 0xc8, 0x00,                                 /* [*   ** ] */
+    0xf0, 0x00, 0xc8, 0x00,                                 /* [*   ** ] */
+    0xf1, 0x00, 0xe9, 0x00,                                 /* [*   ** ] */
+    0xff, 0xff, 0xff, 0xd0,                                 /* [*******] */
+    0xfe, 0x01, 0xff, 0xf0,                                 /* [**  ***] */
+    0xfd, 0x00, 0xff, 0xf0,                                 /* [**  ***] */
+    0xfd, 0x00, 0xff, 0xf0,                                 /* [**  ***] */
+    0xfc, 0x00, 0xff, 0xf0,                                 /* [**  ***] */
 };
 
 const uint8_t checkbook_14_0x69[] __attribute__((__progmem__)) = {   /* 'i' width: 3 */
-      0,   0,   1,                                               /* [   ] */
-      0,   0,  15,                                               /* [  *] */
-      0,   0,  15,                                               /* [  *] */
-      0,   0,  15,                                               /* [  *] */
-      0,   0,  15,                                               /* [  *] */
-      0,   7,  15,                                               /* [ **] */
-      2,  15,  15,                                               /* [ **] */
-      3,  15,  15,                                               /* [ **] */
-      3,  15,  15,                                               /* [ **] */
-      2,  15,  15,                                               /* [ **] */
+    0x00, 0x10,                                             /* [   ] */
+    0x00, 0xf0,                                             /* [  *] */
+    0x00, 0xf0,                                             /* [  *] */
+    0x00, 0xf0,                                             /* [  *] */
+    0x00, 0xf0,                                             /* [  *] */
+    0x07, 0xf0,                                             /* [ **] */
+    0x2f, 0xf0,                                             /* [ **] */
+    0x3f, 0xf0,                                             /* [ **] */
+    0x3f, 0xf0,                                             /* [ **] */
+    0x2f, 0xf0,                                             /* [ **] */
 };
 
 const uint8_t checkbook_14_0x6a[] __attribute__((__progmem__)) = {   /* 'j' width: 8 */
-      0,   0,   0,   0,   3,   0,   0,                           /* [       ] */
-      0,   0,   0,   0,  15,   6,   0,                           /* [    ** ] */
-      0,   0,   0,   0,  15,   6,   0,                           /* [    ** ] */
-      0,   0,   0,   0,  15,   6,   0,                           /* [    ** ] */
-      0,   0,   0,   0,  15,  10,   2,                           /* [    ** ] */
-      0,   0,   0,   0,  15,  15,  15,                           /* [    ***] */
-      0,   0,   0,   0,  15,  15,  15,                           /* [    ***] */
-     15,  15,  14,   0,  15,  15,  15,                           /* [*** ***] */
-     15,  15,  15,   0,  15,  15,  15,                           /* [*** ***] */
-     14,  15,  15,  15,  15,  15,  14,                           /* [*******] */
+    0x00, 0x00, 0x30, 0x00,                                 /* [       ] */
+    0x00, 0x00, 0xf6, 0x00,                                 /* [    ** ] */
+    0x00, 0x00, 0xf6, 0x00,                                 /* [    ** ] */
+    0x00, 0x00, 0xf6, 0x00,                                 /* [    ** ] */
+    0x00, 0x00, 0xfa, 0x20,                                 /* [    ** ] */
+    0x00, 0x00, 0xff, 0xf0,                                 /* [    ***] */
+    0x00, 0x00, 0xff, 0xf0,                                 /* [    ***] */
+    0xff, 0xe0, 0xff, 0xf0,                                 /* [*** ***] */
+    0xff, 0xf0, 0xff, 0xf0,                                 /* [*** ***] */
+    0xef, 0xff, 0xff, 0xe0,                                 /* [*******] */
 };
 
 const uint8_t checkbook_14_0x6b[] __attribute__((__progmem__)) = {   /* 'k' width: 8 */
-      3,   1,   0,   0,   0,   2,   3,   0,                      /* [        ] */
-     15,   8,   0,   0,   3,  15,   8,   0,                      /* [**   ** ] */
-     15,   9,   0,   1,  14,   8,   0,   0,                      /* [**  **  ] */
-     15,   9,   0,  12,   8,   0,   0,   0,                      /* [** **   ] */
-     15,  11,  10,   9,   0,   0,   0,   0,                      /* [****    ] */
-     15,  15,  15,  15,  15,  15,  14,   0,                      /* [******* ] */
-     15,  15,  15,   0,  15,  15,  15,   0,                      /* [*** *** ] */
-     15,  15,  15,   0,  15,  15,  15,   0,                      /* [*** *** ] */
-     15,  15,  15,   0,  15,  15,  15,   0,                      /* [*** *** ] */
-     14,  15,  13,   0,  14,  15,  14,   0,                      /* [*** *** ] */
+    0x31, 0x00, 0x02, 0x30,                                 /* [        ] */
+    0xf8, 0x00, 0x3f, 0x80,                                 /* [**   ** ] */
+    0xf9, 0x01, 0xe8, 0x00,                                 /* [**  **  ] */
+    0xf9, 0x0c, 0x80, 0x00,                                 /* [** **   ] */
+    0xfb, 0xa9, 0x00, 0x00,                                 /* [****    ] */
+    0xff, 0xff, 0xff, 0xe0,                                 /* [******* ] */
+    0xff, 0xf0, 0xff, 0xf0,                                 /* [*** *** ] */
+    0xff, 0xf0, 0xff, 0xf0,                                 /* [*** *** ] */
+    0xff, 0xf0, 0xff, 0xf0,                                 /* [*** *** ] */
+    0xef, 0xd0, 0xef, 0xe0,                                 /* [*** *** ] */
 };
 
 const uint8_t checkbook_14_0x6c[] __attribute__((__progmem__)) = {   /* 'l' width: 6 */
-      0,   0,   2,   0,   0,   0,                                /* [      ] */
-      0,   0,  15,   0,   0,   0,                                /* [  *   ] */
-      0,   0,  15,   0,   0,   0,                                /* [  *   ] */
-      0,   0,  15,   0,   0,   0,                                /* [  *   ] */
-      0,   0,  15,   0,   0,   0,                                /* [  *   ] */
-      0,   8,  15,   0,   0,   0,                                /* [ **   ] */
-      2,  15,  15,   0,   0,   0,                                /* [ **   ] */
-      3,  15,  15,   0,   0,   0,                                /* [ **   ] */
-      3,  15,  15,   0,   0,   0,                                /* [ **   ] */
-      2,  15,  15,  15,  15,   8,                                /* [ *****] */
+    0x00, 0x20, 0x00,                                       /* [      ] */
+    0x00, 0xf0, 0x00,                                       /* [  *   ] */
+    0x00, 0xf0, 0x00,                                       /* [  *   ] */
+    0x00, 0xf0, 0x00,                                       /* [  *   ] */
+    0x00, 0xf0, 0x00,                                       /* [  *   ] */
+    0x08, 0xf0, 0x00,                                       /* [ **   ] */
+    0x2f, 0xf0, 0x00,                                       /* [ **   ] */
+    0x3f, 0xf0, 0x00,                                       /* [ **   ] */
+    0x3f, 0xf0, 0x00,                                       /* [ **   ] */
+    0x2f, 0xff, 0xf8,                                       /* [ *****] */
 };
 
 const uint8_t checkbook_14_0x6d[] __attribute__((__progmem__)) = {   /* 'm' width: 9 */
-      3,   2,   0,   0,   0,   3,   4,   3,                      /* [        ] */
-     15,  14,   2,   0,   6,  15,  15,  15,                      /* [**  ****] */
-     15,   5,  11,   0,  10,  15,  15,  15,                      /* [* * ****] */
-     15,   0,  13,  14,   2,  15,  15,  15,                      /* [* ** ***] */
-     15,   0,   4,   8,   0,  15,  15,  15,                      /* [*  * ***] */
-     15,   0,   0,   0,   0,  15,  15,  15,                      /* [*    ***] */
-     15,   0,   0,   0,   0,  15,  15,  15,                      /* [*    ***] */
-     15,   0,  14,  15,  14,  15,  15,  15,                      /* [* ******] */
-     15,   0,  15,  15,  15,  15,  15,  15,                      /* [* ******] */
-     13,   0,  14,  15,  14,  15,  15,  14,                      /* [* ******] */
-      0,   0,   0,   0,   0,   0,   0,   0,                      /* [        ] */
+    0x32, 0x00, 0x03, 0x43,                                 /* [        ] */
+    0xfe, 0x20, 0x6f, 0xff,                                 /* [**  ****] */
+    0xf5, 0xb0, 0xaf, 0xff,                                 /* [* * ****] */
+    0xf0, 0xde, 0x2f, 0xff,                                 /* [* ** ***] */
+    0xf0, 0x48, 0x0f, 0xff,                                 /* [*  * ***] */
+    0xf0, 0x00, 0x0f, 0xff,                                 /* [*    ***] */
+    0xf0, 0x00, 0x0f, 0xff,                                 /* [*    ***] */
+    0xf0, 0xef, 0xef, 0xff,                                 /* [* ******] */
+    0xf0, 0xff, 0xff, 0xff,                                 /* [* ******] */
+    0xd0, 0xef, 0xef, 0xfe,                                 /* [* ******] */
+    0x00, 0x00, 0x00, 0x00,                                 /* [        ] */
 };
 
 const uint8_t checkbook_14_0x6e[] __attribute__((__progmem__)) = {   /* 'n' width: 8 */
-      4,   4,   0,   0,   0,   0,   2,                           /* [       ] */
-     15,  12,   7,   0,   0,   0,  15,                           /* [***   *] */
-     15,   0,  10,   7,   0,   0,  15,                           /* [* **  *] */
-     15,   0,   0,  11,   7,   0,  15,                           /* [*  ** *] */
-     15,   0,   0,   0,  12,   8,  15,                           /* [*   ***] */
-     15,   0,   0,   0,   1,  13,  15,                           /* [*    **] */
-     15,   0,   0,   0,   0,   2,  15,                           /* [*     *] */
-     15,   0,  14,  15,  14,   0,  15,                           /* [* *** *] */
-     15,   0,  15,  15,  15,   0,  15,                           /* [* *** *] */
-     13,   0,  14,  15,  14,   0,  13,                           /* [* *** *] */
+    0x44, 0x00, 0x00, 0x20,                                 /* [       ] */
+    0xfc, 0x70, 0x00, 0xf0,                                 /* [***   *] */
+    0xf0, 0xa7, 0x00, 0xf0,                                 /* [* **  *] */
+    0xf0, 0x0b, 0x70, 0xf0,                                 /* [*  ** *] */
+    0xf0, 0x00, 0xc8, 0xf0,                                 /* [*   ***] */
+    0xf0, 0x00, 0x1d, 0xf0,                                 /* [*    **] */
+    0xf0, 0x00, 0x02, 0xf0,                                 /* [*     *] */
+    0xf0, 0xef, 0xe0, 0xf0,                                 /* [* *** *] */
+    0xf0, 0xff, 0xf0, 0xf0,                                 /* [* *** *] */
+    0xd0, 0xef, 0xe0, 0xd0,                                 /* [* *** *] */
 };
 
 const uint8_t checkbook_14_0x6f[] __attribute__((__progmem__)) = {   /* 'o' width: 7 */
-     14,  15,  15,  15,  15,  14,                                /* [******] */
-     15,   1,   0,   0,   6,  15,                                /* [*   **] */
-     15,   0,   0,   0,   4,  15,                                /* [*    *] */
-     15,   0,   0,   1,   8,  15,                                /* [*   **] */
-     15,   0,   0,  15,  15,  15,                                /* [*  ***] */
-     15,   0,   0,  15,  15,  15,                                /* [*  ***] */
-     15,   0,   0,  15,  15,  15,                                /* [*  ***] */
-     15,   1,   0,  15,  15,  15,                                /* [*  ***] */
-     14,  15,  15,  15,  15,  13,                                /* [******] */
+    0xef, 0xff, 0xfe,                                       /* [******] */
+    0xf1, 0x00, 0x6f,                                       /* [*   **] */
+    0xf0, 0x00, 0x4f,                                       /* [*    *] */
+    0xf0, 0x01, 0x8f,                                       /* [*   **] */
+    0xf0, 0x0f, 0xff,                                       /* [*  ***] */
+    0xf0, 0x0f, 0xff,                                       /* [*  ***] */
+    0xf0, 0x0f, 0xff,                                       /* [*  ***] */
+    0xf1, 0x0f, 0xff,                                       /* [*  ***] */
+    0xef, 0xff, 0xfd,                                       /* [******] */
 };
 
 const uint8_t checkbook_14_0x70[] __attribute__((__progmem__)) = {   /* 'p' width: 7 */
-     13,  15,  15,  15,  15,  14,                                /* [******] */
-     15,   9,   0,   0,   1,  15,                                /* [**   *] */
-     15,   6,   0,   0,   0,  15,                                /* [**   *] */
-     15,   8,   0,   0,   1,  15,                                /* [**   *] */
-     15,  15,  15,  15,  15,  14,                                /* [******] */
-     15,  15,  15,   0,   0,   0,                                /* [***   ] */
-     15,  15,  15,   0,   0,   0,                                /* [***   ] */
-     15,  15,  15,   0,   0,   0,                                /* [***   ] */
-     14,  15,  14,   0,   0,   0,                                /* [***   ] */
+    0xdf, 0xff, 0xfe,                                       /* [******] */
+    0xf9, 0x00, 0x1f,                                       /* [**   *] */
+    0xf6, 0x00, 0x0f,                                       /* [**   *] */
+    0xf8, 0x00, 0x1f,                                       /* [**   *] */
+    0xff, 0xff, 0xfe,                                       /* [******] */
+    0xff, 0xf0, 0x00,                                       /* [***   ] */
+    0xff, 0xf0, 0x00,                                       /* [***   ] */
+    0xff, 0xf0, 0x00,                                       /* [***   ] */
+    0xef, 0xe0, 0x00,                                       /* [***   ] */
 };
 
 const uint8_t checkbook_14_0x71[] __attribute__((__progmem__)) = {   /* 'q' width: 7 */
-     13,  15,  15,  15,  15,  13,                                /* [******] */
-     15,   3,   0,   0,   1,  15,                                /* [*    *] */
-     15,   3,   0,   0,   0,  15,                                /* [*    *] */
-     15,  15,   0,   0,   0,  15,                                /* [**   *] */
-     15,  15,   0,   0,   0,  15,                                /* [**   *] */
-     15,  15,   0,   0,   0,  15,                                /* [**   *] */
-     15,  15,   0,   5,   1,  15,                                /* [**   *] */
-     15,  15,   0,   9,   7,  15,                                /* [** ***] */
-     13,  15,  15,  15,  15,  13,                                /* [******] */
-      0,   0,   0,   0,  14,   1,                                /* [    * ] */
-      0,   0,   0,   0,   3,   0,                                /* [      ] */
+    0xdf, 0xff, 0xfd,                                       /* [******] */
+    0xf3, 0x00, 0x1f,                                       /* [*    *] */
+    0xf3, 0x00, 0x0f,                                       /* [*    *] */
+    0xff, 0x00, 0x0f,                                       /* [**   *] */
+    0xff, 0x00, 0x0f,                                       /* [**   *] */
+    0xff, 0x00, 0x0f,                                       /* [**   *] */
+    0xff, 0x05, 0x1f,                                       /* [**   *] */
+    0xff, 0x09, 0x7f,                                       /* [** ***] */
+    0xdf, 0xff, 0xfd,                                       /* [******] */
+    0x00, 0x00, 0xe1,                                       /* [    * ] */
+    0x00, 0x00, 0x30,                                       /* [      ] */
 };
 
 const uint8_t checkbook_14_0x72[] __attribute__((__progmem__)) = {   /* 'r' width: 8 */
-     14,  15,  15,  15,  15,   5,   0,                           /* [*****  ] */
-     15,   7,   0,   0,  15,   6,   0,                           /* [**  ** ] */
-     15,   5,   0,   0,  15,   6,   0,                           /* [*   ** ] */
-     15,   8,   0,   0,  15,   8,   0,                           /* [**  ** ] */
-     15,  15,  15,  15,  15,  15,  14,                           /* [*******] */
-     15,  15,  15,   1,  15,  15,  15,                           /* [*** ***] */
-     15,  15,  15,   0,  15,  15,  15,                           /* [*** ***] */
-     15,  15,  15,   0,  15,  15,  15,                           /* [*** ***] */
-     14,  15,  14,   0,  14,  15,  14,                           /* [*** ***] */
+    0xef, 0xff, 0xf5, 0x00,                                 /* [*****  ] */
+    0xf7, 0x00, 0xf6, 0x00,                                 /* [**  ** ] */
+    0xf5, 0x00, 0xf6, 0x00,                                 /* [*   ** ] */
+    0xf8, 0x00, 0xf8, 0x00,                                 /* [**  ** ] */
+    0xff, 0xff, 0xff, 0xe0,                                 /* [*******] */
+    0xff, 0xf1, 0xff, 0xf0,                                 /* [*** ***] */
+    0xff, 0xf0, 0xff, 0xf0,                                 /* [*** ***] */
+    0xff, 0xf0, 0xff, 0xf0,                                 /* [*** ***] */
+    0xef, 0xe0, 0xef, 0xe0,                                 /* [*** ***] */
 };
 
 const uint8_t checkbook_14_0x73[] __attribute__((__progmem__)) = {   /* 's' width: 6 */
-     14,  15,  15,  15,  14,                                     /* [*****] */
-     15,   1,   0,   0,  15,                                     /* [*   *] */
-     15,   0,   0,   0,   9,                                     /* [*   *] */
-     15,   1,   0,   0,   0,                                     /* [*    ] */
-     14,  15,  15,  15,  14,                                     /* [*****] */
-      0,   0,   0,   0,  15,                                     /* [    *] */
-      9,   7,   0,   0,  15,                                     /* [**  *] */
-     15,  13,   0,   1,  15,                                     /* [**  *] */
-     14,  15,  15,  15,  15,                                     /* [*****] */
+    0xef, 0xff, 0xe0,                                       /* [*****] */
+    0xf1, 0x00, 0xf0,                                       /* [*   *] */
+    0xf0, 0x00, 0x90,                                       /* [*   *] */
+    0xf1, 0x00, 0x00,                                       /* [*    ] */
+    0xef, 0xff, 0xe0,                                       /* [*****] */
+    0x00, 0x00, 0xf0,                                       /* [    *] */
+    0x97, 0x00, 0xf0,                                       /* [**  *] */
+    0xfd, 0x01, 0xf0,                                       /* [**  *] */
+    0xef, 0xff, 0xf0,                                       /* [*****] */
 };
 
 const uint8_t checkbook_14_0x74[] __attribute__((__progmem__)) = {   /* 't' width: 7 */
-      8,  15,  15,  15,  15,  15,   9,                           /* [*******] */
-      0,   0,  15,  15,  15,   0,   0,                           /* [  ***  ] */
-      0,   0,  15,  15,  15,   0,   0,                           /* [  ***  ] */
-      0,   0,  15,  15,  15,   0,   0,                           /* [  ***  ] */
-      0,   0,  15,  15,  15,   0,   0,                           /* [  ***  ] */
-      0,   0,  15,  15,  15,   0,   0,                           /* [  ***  ] */
-      0,   0,  15,  15,  15,   0,   0,                           /* [  ***  ] */
-      0,   0,  15,  15,  15,   0,   0,                           /* [  ***  ] */
-      0,   0,  14,  15,  14,   0,   0,                           /* [  ***  ] */
+    0x8f, 0xff, 0xff, 0x90,                                 /* [*******] */
+    0x00, 0xff, 0xf0, 0x00,                                 /* [  ***  ] */
+    0x00, 0xff, 0xf0, 0x00,                                 /* [  ***  ] */
+    0x00, 0xff, 0xf0, 0x00,                                 /* [  ***  ] */
+    0x00, 0xff, 0xf0, 0x00,                                 /* [  ***  ] */
+    0x00, 0xff, 0xf0, 0x00,                                 /* [  ***  ] */
+    0x00, 0xff, 0xf0, 0x00,                                 /* [  ***  ] */
+    0x00, 0xff, 0xf0, 0x00,                                 /* [  ***  ] */
+    0x00, 0xef, 0xe0, 0x00,                                 /* [  ***  ] */
 };
 
 const uint8_t checkbook_14_0x75[] __attribute__((__progmem__)) = {   /* 'u' width: 6 */
-      2,   0,   3,   5,   3,                                     /* [     ] */
-     15,   0,  15,  15,  15,                                     /* [* ***] */
-     15,   0,  15,  15,  15,                                     /* [* ***] */
-     15,   0,  15,  15,  15,                                     /* [* ***] */
-     15,   0,  15,  15,  15,                                     /* [* ***] */
-     15,   0,  15,  15,  15,                                     /* [* ***] */
-     15,   0,  15,  15,  15,                                     /* [* ***] */
-     15,   0,  15,  15,  15,                                     /* [* ***] */
-     15,   1,  15,  15,  15,                                     /* [* ***] */
-     14,  15,  15,  15,  14,                                     /* [*****] */
+    0x20, 0x35, 0x30,                                       /* [     ] */
+    0xf0, 0xff, 0xf0,                                       /* [* ***] */
+    0xf0, 0xff, 0xf0,                                       /* [* ***] */
+    0xf0, 0xff, 0xf0,                                       /* [* ***] */
+    0xf0, 0xff, 0xf0,                                       /* [* ***] */
+    0xf0, 0xff, 0xf0,                                       /* [* ***] */
+    0xf0, 0xff, 0xf0,                                       /* [* ***] */
+    0xf0, 0xff, 0xf0,                                       /* [* ***] */
+    0xf1, 0xff, 0xf0,                                       /* [* ***] */
+    0xef, 0xff, 0xe0,                                       /* [*****] */
 };
 
 const uint8_t checkbook_14_0x76[] __attribute__((__progmem__)) = {   /* 'v' width: 6 */
-      3,   0,   4,   5,   4,                                     /* [     ] */
-     15,   0,  15,  15,  15,                                     /* [* ***] */
-     15,   0,  15,  15,  15,                                     /* [* ***] */
-     15,   0,  15,  15,  15,                                     /* [* ***] */
-     15,   0,  15,  15,  15,                                     /* [* ***] */
-     15,   0,  15,  15,  15,                                     /* [* ***] */
-     15,   0,  15,  15,  15,                                     /* [* ***] */
-     10,   3,  15,  15,  14,                                     /* [* ***] */
-      2,   8,  15,  13,   2,                                     /* [ *** ] */
-      0,  10,  12,   1,   0,                                     /* [ **  ] */
+    0x30, 0x45, 0x40,                                       /* [     ] */
+    0xf0, 0xff, 0xf0,                                       /* [* ***] */
+    0xf0, 0xff, 0xf0,                                       /* [* ***] */
+    0xf0, 0xff, 0xf0,                                       /* [* ***] */
+    0xf0, 0xff, 0xf0,                                       /* [* ***] */
+    0xf0, 0xff, 0xf0,                                       /* [* ***] */
+    0xf0, 0xff, 0xf0,                                       /* [* ***] */
+    0xa3, 0xff, 0xe0,                                       /* [* ***] */
+    0x28, 0xfd, 0x20,                                       /* [ *** ] */
+    0x0a, 0xc1, 0x00,                                       /* [ **  ] */
 };
 
 const uint8_t checkbook_14_0x77[] __attribute__((__progmem__)) = {   /* 'w' width: 9 */
-      0,   0,   0,   0,   0,   0,   0,   0,                      /* [        ] */
-     14,  15,  14,  14,  15,  13,   0,  13,                      /* [****** *] */
-     15,  15,  15,  15,  15,  15,   0,  15,                      /* [****** *] */
-     15,  15,  15,  14,  15,  14,   0,  15,                      /* [****** *] */
-     15,  15,  15,   2,   0,   0,   0,  15,                      /* [***    *] */
-     15,  15,  15,  10,   7,   0,   0,  15,                      /* [*****  *] */
-     15,  15,  15,   1,  14,   1,   0,  15,                      /* [*** *  *] */
-     15,  15,  14,   0,   6,  10,   0,  15,                      /* [*** ** *] */
-     15,  15,  13,   0,   0,  11,   4,  15,                      /* [***  * *] */
-     14,  15,  12,   0,   0,   1,  13,  14,                      /* [***   **] */
+    0x00, 0x00, 0x00, 0x00,                                 /* [        ] */
+    0xef, 0xee, 0xfd, 0x0d,                                 /* [****** *] */
+    0xff, 0xff, 0xff, 0x0f,                                 /* [****** *] */
+    0xff, 0xfe, 0xfe, 0x0f,                                 /* [****** *] */
+    0xff, 0xf2, 0x00, 0x0f,                                 /* [***    *] */
+    0xff, 0xfa, 0x70, 0x0f,                                 /* [*****  *] */
+    0xff, 0xf1, 0xe1, 0x0f,                                 /* [*** *  *] */
+    0xff, 0xe0, 0x6a, 0x0f,                                 /* [*** ** *] */
+    0xff, 0xd0, 0x0b, 0x4f,                                 /* [***  * *] */
+    0xef, 0xc0, 0x01, 0xde,                                 /* [***   **] */
 };
 
 const uint8_t checkbook_14_0x78[] __attribute__((__progmem__)) = {   /* 'x' width: 7 */
-      2,   0,   0,   0,   0,   2,                                /* [      ] */
-     15,   0,   0,   0,   0,  15,                                /* [*    *] */
-     15,   0,   0,   0,   0,  15,                                /* [*    *] */
-     11,   9,   0,   0,   8,  12,                                /* [**  **] */
-      0,  10,  14,  14,  10,   0,                                /* [ **** ] */
-      0,  10,  15,  15,   8,   0,                                /* [ **** ] */
-     10,  11,   1,   1,  11,  10,                                /* [**  **] */
-     15,   0,   0,   0,   0,  15,                                /* [*    *] */
-     15,   0,   0,   0,   0,  15,                                /* [*    *] */
-     13,   0,   0,   0,   0,  13,                                /* [*    *] */
+    0x20, 0x00, 0x02,                                       /* [      ] */
+    0xf0, 0x00, 0x0f,                                       /* [*    *] */
+    0xf0, 0x00, 0x0f,                                       /* [*    *] */
+    0xb9, 0x00, 0x8c,                                       /* [**  **] */
+    0x0a, 0xee, 0xa0,                                       /* [ **** ] */
+    0x0a, 0xff, 0x80,                                       /* [ **** ] */
+    0xab, 0x11, 0xba,                                       /* [**  **] */
+    0xf0, 0x00, 0x0f,                                       /* [*    *] */
+    0xf0, 0x00, 0x0f,                                       /* [*    *] */
+    0xd0, 0x00, 0x0d,                                       /* [*    *] */
 };
 
 const uint8_t checkbook_14_0x79[] __attribute__((__progmem__)) = {   /* 'y' width: 6 */
-      1,   0,   0,   0,   2,                                     /* [     ] */
-     15,   0,   0,   0,  15,                                     /* [*   *] */
-     15,   0,   0,   0,  15,                                     /* [*   *] */
-     15,   0,   0,   0,  15,                                     /* [*   *] */
-     13,   7,   0,   0,  13,                                     /* [**  *] */
-      0,  10,  13,   9,   8,                                     /* [ ****] */
-      0,   0,  15,  15,  15,                                     /* [  ***] */
-      0,   0,  15,  15,  15,                                     /* [  ***] */
-      0,   0,  15,  15,  15,                                     /* [  ***] */
-      0,   0,  14,  15,  14,                                     /* [  ***] */
+    0x10, 0x00, 0x20,                                       /* [     ] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xf0, 0x00, 0xf0,                                       /* [*   *] */
+    0xd7, 0x00, 0xd0,                                       /* [**  *] */
+    0x0a, 0xd9, 0x80,                                       /* [ ****] */
+    0x00, 0xff, 0xf0,                                       /* [  ***] */
+    0x00, 0xff, 0xf0,                                       /* [  ***] */
+    0x00, 0xff, 0xf0,                                       /* [  ***] */
+    0x00, 0xef, 0xe0,                                       /* [  ***] */
 };
 
 const uint8_t checkbook_14_0x7a[] __attribute__((__progmem__)) = {   /* 'z' width: 7 */
-     14,  15,  15,  15,  15,   9,                                /* [******] */
-     15,   1,   0,  11,  15,   1,                                /* [*  ** ] */
-     12,   0,   2,  15,   7,   0,                                /* [*  ** ] */
-      0,   0,  10,  13,   0,   0,                                /* [  **  ] */
-      0,   2,  15,   4,   0,   0,                                /* [  *   ] */
-      0,   9,  11,   0,   1,   1,                                /* [ **   ] */
-      1,  15,   2,  15,  15,  15,                                /* [ * ***] */
-      8,   8,   0,  15,  15,  15,                                /* [** ***] */
-     14,  15,  15,  15,  15,  14,                                /* [******] */
-      0,   0,   0,   0,   0,   0,                                /* [      ] */
+    0xef, 0xff, 0xf9,                                       /* [******] */
+    0xf1, 0x0b, 0xf1,                                       /* [*  ** ] */
+    0xc0, 0x2f, 0x70,                                       /* [*  ** ] */
+    0x00, 0xad, 0x00,                                       /* [  **  ] */
+    0x02, 0xf4, 0x00,                                       /* [  *   ] */
+    0x09, 0xb0, 0x11,                                       /* [ **   ] */
+    0x1f, 0x2f, 0xff,                                       /* [ * ***] */
+    0x88, 0x0f, 0xff,                                       /* [** ***] */
+    0xef, 0xff, 0xfe,                                       /* [******] */
+    0x00, 0x00, 0x00,                                       /* [      ] */
 };
 
 
@@ -45,6 +45,12 @@ const uint8_t ascii_map_mt1[256] __attribute__((__progmem__)) = {
     ':', ':', ':', ':', ':', ':', ':', ':', ':', ':', ':', ':', ':', ':', ':', ':',
 };
 
+#if defined(EN_SEVEN_DOT) || defined(EN_TEN_DOT)
+const codepoint_t deg_cmap[] __attribute__((__progmem__)) = {
+    { 0x00B0, '~'+1 },		/* degree sign */
+};
+#endif
+
 const struct FONT_DEF  fonts[FONT_COUNT] __attribute__((__progmem__)) = {
 #ifdef EN_FIVE_DOT
                    {1,  7, five_dot_glyph_table, 0, five_dot_width_table,' ','~','.'},
@@ -55,7 +61,7 @@ const struct FONT_DEF  fonts[FONT_COUNT] __attribute__((__progmem__)) = {
 #endif
 
 #ifdef EN_SEVEN_DOT
-                   {2,  8, seven_dot_glyph_table, 0, seven_dot_width_table,' ',DEG_CHAR,'@'},
+                   {2,  8, seven_dot_glyph_table, 0, seven_dot_width_table,' ',DEG_CHAR,'@', NULL, deg_cmap, 1},
 #endif
 
 #ifdef EN_NINE_DOT
@@ -63,7 +69,7 @@ const struct FONT_DEF  fonts[FONT_COUNT] __attribute__((__progmem__)) = {
 #endif
 
 #ifdef EN_TEN_DOT
-                   {2, 12, ten_dot_glyph_table, 9, NULL,' ','~'+1,'.'},
+                   {2, 12, ten_dot_glyph_table, 9, NULL,' ','~'+1,'.', NULL, deg_cmap, 1},
 #endif
 
 #ifdef EN_FIFTEEN_DOT
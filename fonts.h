@@ -49,6 +49,12 @@ typedef enum
 	FONT_COUNT
 } FONT_BASE;
 
+/* glyph for a character beyond the font's ascii range, tables are sorted by code */
+typedef struct {
+   uint16_t code;                  /* unicode code point */
+   uint8_t glyph;                  /* font character drawn for it */
+} codepoint_t;
+
 struct FONT_DEF 
 {
    uint8_t store_width;            /* glyph storage width in bytes */
@@ -61,6 +67,8 @@ struct FONT_DEF
    uint8_t glyph_end;				 /* end ascii offset in table */
    uint8_t glyph_def;				 /*  for undefined glyph  */
    const uint8_t *map;		/* ascii map */
+   const codepoint_t *cmap;		/* code points outside glyph_beg..glyph_end, or NULL */
+   uint8_t cmap_size;			/* entries in cmap */
 };
 
 /* font definition tables for the fonts */
@@ -41,9 +41,6 @@
 #undef PSTR 
 #define PSTR(s) (__extension__({static prog_char __c[] PROGMEM = (s); &__c[0];})) 
 
-#define pinLow(port, pin)	*port &= ~pin
-#define pinHigh(port, pin)	*port |= pin
-
 #define MIN_SEG 28
 #define MAX_SEG 91
 
@@ -64,18 +61,73 @@ oled256::oled256(const uint8_t cs, const uint8_t dc, const uint8_t reset)
     wrap = true;
     _offset = 0;
     _bufHeight = LCDHEIGHT;
+    _clip.x0 = 0;
+    _clip.y0 = 0;
+    _clip.x1 = LCDWIDTH-1;
+    _clip.y1 = LCDHEIGHT-1;
+    _clipDepth = 0;
     _fontHQ = NULL;
+#ifdef OLED_FONT_SOURCE
+    _extFont = NULL;
+#endif
     debug = false;
+    _win.colValid = false;
+    _win.rowValid = false;
+    _win.writing = false;
+    _mem = NULL;
+    _utf8.len = 0;
+    _doubleBuffer = false;
+    _drawRow = 0;
+    _showRow = 0;
+    _expandFg = 0xFF;
+    expandColours(foreground, background);
+#ifdef OLED_GLYPH_CACHE
+    clearGlyphCache();
+#endif
+#ifdef OLED_HOT_GLYPHS
+    _hot.count = 0;
+#endif
 }
 
 void oled256::setColour(uint8_t colour)
 {
     foreground = colour & 0x0F;
+    expandColours(foreground, background);
 }
 
 void oled256::setBackground(uint8_t colour)
 {
     background = colour & 0x0F;
+    expandColours(foreground, background);
+}
+
+/**
+ * Build the tables that expand 4 bits of a 1bpp image into 4 pixels
+ * and blend HQ glyph intensities between the colours.
+ * Does nothing if the tables are already for these colours.
+ * @param colour - colour of set bits and full intensity
+ * @param bg - colour of clear bits and zero intensity
+ */
+void oled256::expandColours(uint8_t colour, uint8_t bg)
+{
+    if ((colour == _expandFg) && (bg == _expandBg)) {
+	return;
+    }
+    _expandFg = colour;
+    _expandBg = bg;
+
+    for (uint8_t bits=0; bits<16; bits++) {
+	uint16_t pixels = 0;
+	for (uint8_t mask=0x08; mask; mask>>=1) {
+	    pixels = (pixels << 4) | ((bits & mask) ? colour : bg);
+	}
+	_expand[bits] = pixels;
+    }
+
+    for (uint8_t alpha=0; alpha<16; alpha++) {
+	_blend[alpha] = (bg * (15 - alpha) + colour * alpha + 7) / 15;
+    }
+    _blendCopy = (colour == 15) && (bg == 0);
 }
 
 void oled256::setContrast(uint8_t contrast)
@@ -84,8 +136,29 @@ void oled256::setContrast(uint8_t contrast)
     writeData(contrast);
 }
 
-size_t oled256::write(uint8_t ch)
+/**
+ * Write a byte of UTF-8 text to the display at the cursor.
+ * The bytes of a multibyte sequence are collected until the whole
+ * character has arrived. A sequence cut short by the start of another
+ * character is dropped.
+ * @param data - byte to write
+ * @returns 1
+ */
+size_t oled256::write(uint8_t data)
 {
+    uint16_t ch;
+
+    if ((_utf8.len > 0) && ((data & 0xC0) != 0x80)) {
+	// not a continuation byte, drop the incomplete sequence
+	_utf8.len = 0;
+    }
+    _utf8.buf[_utf8.len++] = data;
+    if (utf8Decode((const char *)_utf8.buf, _utf8.len, &ch) == 0) {
+	// wait for the rest of the sequence
+	return 1;
+    }
+    _utf8.len = 0;
+
 #ifdef DEBUG
     Serial.println();
     Serial.print(F("write: cur_x, cur_y = "));
@@ -120,23 +193,40 @@ size_t oled256::write(uint8_t ch)
 
 size_t oled256::write(const char *buf)
 {
-
-    size_t size=0;
-
-    while (*buf) {
-	size += write(*buf++);
-    }
-
-    return size;
+    return write((const uint8_t *)buf, strlen(buf));
 }
 
+/**
+ * Write UTF-8 text to the display at the cursor.
+ * Runs of printable ascii characters that fit on the line are drawn
+ * together by textRun(), everything else goes through write(uint8_t).
+ * @param buf - text to write
+ * @param size - number of bytes
+ * @returns number of bytes written
+ */
 size_t oled256::write(const uint8_t *buf, size_t size)
 {
-    while (size--) {
-	write(*buf++);
+    size_t count = size;
+
+    while (size > 0) {
+	int16_t x = cur_x;
+	uint8_t len = 0;
+	if (_utf8.len == 0) {
+	    len = textRun(&x, cur_y, (const char *)buf, (size > 255) ? 255 : size, OLED_WIDTH,
+			  foreground, background);
+	}
+	if (len == 0) {
+	    // control character, custom character, UTF-8 sequence or wrapping
+	    write(*buf);
+	    len = 1;
+	} else {
+	    cur_x = x;
+	}
+	buf += len;
+	size -= len;
     }
 
-    return size;
+    return count;
 }
 
 void oled256::setXY(uint8_t col, uint8_t row)
@@ -154,23 +244,27 @@ void oled256::printXY(uint8_t col, uint8_t row, const char *string)
 void oled256::begin(uint8_t font)
 {
     _font = font;
-    port_cs = portOutputRegister(digitalPinToPort(_cs));
-    pin_cs = digitalPinToBitMask(_cs);
-    port_dc = portOutputRegister(digitalPinToPort(_dc));
-    pin_dc = digitalPinToBitMask(_dc);
-
-    pinMode(_cs, OUTPUT);
-    pinMode(_dc, OUTPUT);
+    loadMetrics();
+    _bus.begin(_cs, _dc);
     pinMode(_reset, OUTPUT);
-    digitalWrite(_cs,HIGH);
 
     reset();
     init();
 
+    _edgeFill = 0;
+    edgeReset();
+
+#ifdef OLED_FRAMEBUFFER
+    // draw into the frame buffer, the first flush() sends all of it
+    memset(_frame, 0, sizeof(_frame));
     for (uint8_t ind=0; ind<LCDHEIGHT; ind++) {
-	gddram[ind].xaddr = 0;
-	gddram[ind].pixels = 0;
+	_dirty[ind].start = 0;
+	_dirty[ind].end = LCDWIDTH/4 - 1;
     }
+    _mem = &_frame[0][0];
+    _memY = 0;
+    _memRows = LCDHEIGHT;
+#endif
 }
 
 /**
@@ -195,6 +289,8 @@ void oled256::init()
 
     writeCommand(CMD_SET_DISPLAY_START_LINE); /*set start line position*/
     writeData(0x00);
+    _showRow = 0;
+    _drawRow = _doubleBuffer ? LCDHEIGHT : 0;
 
     writeCommand(CMD_SET_REMAP);
     writeData(0x14);	//Horizontal address increment,Disable Column Address Re-map,Enable Nibble Re-map,Scan from COM[N-1] to COM0,Disable COM Split Odd Even
@@ -246,10 +342,13 @@ void oled256::init()
  */
 void oled256::writeCommand(uint8_t reg)
 {
-    pinLow(port_cs, pin_cs);
-    pinLow(port_dc, pin_dc);
-    SPI.transfer(reg);
-    pinHigh(port_cs, pin_cs);
+    _bus.command(reg);
+    _win.writing = false;
+    if (reg == CMD_SET_COLUMN_ADDR) {
+	_win.colValid = false;
+    } else if (reg == CMD_SET_ROW_ADDR) {
+	_win.rowValid = false;
+    }
 }
 
 /**
@@ -258,10 +357,7 @@ void oled256::writeCommand(uint8_t reg)
  */
 void oled256::writeData(uint8_t data)
 {
-    pinLow(port_cs, pin_cs);
-    pinHigh(port_dc, pin_dc);
-    SPI.transfer(data);
-    pinHigh(port_cs, pin_cs);
+    _bus.data(data);
     if (debug) {
 	Serial.print(F("writeData(0x"));
 	Serial.print(data,HEX);
@@ -269,6 +365,247 @@ void oled256::writeData(uint8_t data)
     }
 }
 
+/**
+ * Start a burst write of pixel data to display RAM.
+ * Issues CMD_WRITE_RAM and keeps the bus selected for data, so the
+ * following stream calls send raw data bytes without any per-byte
+ * pin toggling. Must be paired with endStream().
+ * When drawing into a memory buffer the data goes to the buffer instead.
+ */
+void oled256::beginStream(void)
+{
+    if (_mem == NULL) {
+	panelBegin();
+    }
+}
+
+/**
+ * Send one byte of pixel data within a stream.
+ * @param data - two pixels, left pixel in the high nibble
+ */
+void oled256::streamData(uint8_t data)
+{
+    if (_mem != NULL) {
+	memWrite(data);
+    } else {
+	_bus.write(data);
+	_streamCount++;
+    }
+}
+
+/**
+ * Send a buffer of pixel data within a stream.
+ * @param buf - packed pixel data, two pixels per byte
+ * @param len - number of bytes to send
+ */
+void oled256::streamData(const uint8_t *buf, uint16_t len)
+{
+    if (_mem != NULL) {
+	while (len--) {
+	    memWrite(*buf++);
+	}
+    } else {
+	panelData(buf, len);
+    }
+}
+
+/**
+ * Send one column address worth of pixels (4 pixels) within a stream.
+ * @param pixels - 4 pixels, leftmost pixel in the top nibble
+ */
+void oled256::streamPixels(uint16_t pixels)
+{
+    if (_mem != NULL) {
+	memWrite((uint8_t)(pixels >> 8));
+	memWrite((uint8_t)pixels);
+    } else {
+	_bus.write((uint8_t)(pixels >> 8));
+	_bus.write((uint8_t)pixels);
+	_streamCount += 2;
+    }
+}
+
+/**
+ * Send the same byte of pixel data repeatedly within a stream.
+ * @param data - two pixels, left pixel in the high nibble
+ * @param count - number of times to send it
+ */
+void oled256::streamFill(uint8_t data, uint16_t count)
+{
+    if (_mem != NULL) {
+	while (count--) {
+	    memWrite(data);
+	}
+    } else {
+	_streamCount += count;
+	while (count--) {
+	    _bus.write(data);
+	}
+    }
+}
+
+/**
+ * Finish a burst write started with beginStream().
+ * With OLED_ASYNC the remaining data is sent in the background and CS
+ * is released once it has gone out.
+ */
+void oled256::endStream(void)
+{
+    if (_mem == NULL) {
+	panelEnd();
+    }
+}
+
+#ifdef OLED_FRAMEBUFFER
+/**
+ * Work out the windows flush() will use to send the changed parts of
+ * the frame buffer. Drawing into the frame buffer only marks bytes that
+ * actually change, so this is the difference between the frame on the
+ * display and the new one.
+ * Each window costs OLED_WINDOW_COST bytes of commands plus its pixel
+ * data, including any unchanged pixels inside it. Runs of changed rows
+ * are split into the windows with the lowest total cost, from one
+ * window per row up to one window around the whole run.
+ * @returns the update plan, valid until the next flush()
+ */
+const plan_t &oled256::planFlush(void)
+{
+    struct {
+	uint8_t start;
+	uint8_t end;
+    } span[LCDHEIGHT];
+    uint16_t best[LCDHEIGHT+1];		// lowest cost to send rows 0 to y-1
+    uint8_t from[LCDHEIGHT+1];		// first row of the window ending at y-1
+    uint8_t wrapY = wrapRow();
+    uint8_t y;
+
+    for (y=0; y<LCDHEIGHT; y++) {
+	span[y].start = _dirty[y].start;
+	span[y].end = _dirty[y].end;
+	if (_doubleBuffer) {
+	    // the hidden page is a frame behind, so also resend last frame's changes
+	    if (_prevDirty[y].start < span[y].start) span[y].start = _prevDirty[y].start;
+	    if (_prevDirty[y].end > span[y].end) span[y].end = _prevDirty[y].end;
+	}
+    }
+
+    best[0] = 0;
+    for (y=1; y<=LCDHEIGHT; y++) {
+	best[y] = best[y-1];
+	from[y] = y;
+	if (span[y-1].start > span[y-1].end) {
+	    // nothing to send on this row
+	    continue;
+	}
+
+	// try each window ending on this row, widening it as it grows up
+	uint8_t start = 0xFF;
+	uint8_t end = 0;
+	best[y] = 0xFFFF;
+	for (uint8_t top=y; top-- > 0; ) {
+	    if ((top < wrapY) && (y > wrapY)) {
+		// a window can't cross the wrap from the end of RAM to the start
+		break;
+	    }
+	    if (span[top].start > span[top].end) {
+		// a window starting on a clean row costs more than one starting below it
+		continue;
+	    }
+	    if (span[top].start < start) start = span[top].start;
+	    if (span[top].end > end) end = span[top].end;
+	    uint16_t cost = best[top] + OLED_WINDOW_COST + (uint16_t)(y - top) * (end - start + 1) * 2;
+	    if (cost < best[y]) {
+		best[y] = cost;
+		from[y] = top;
+	    }
+	}
+    }
+
+    // follow the chosen windows back from the bottom row
+    _plan.count = 0;
+    _plan.cost = best[LCDHEIGHT];
+    for (y=LCDHEIGHT; y > 0; ) {
+	if (from[y] == y) {
+	    y--;
+	    continue;
+	}
+	update_t *win = &_plan.window[_plan.count++];
+	win->y0 = from[y];
+	win->y1 = y - 1;
+	win->x0 = 0xFF;
+	win->x1 = 0;
+	for (uint8_t row=win->y0; row<=win->y1; row++) {
+	    if (span[row].start > span[row].end) {
+		continue;
+	    }
+	    if (span[row].start < win->x0) win->x0 = span[row].start;
+	    if (span[row].end > win->x1) win->x1 = span[row].end;
+	}
+	y = from[y];
+    }
+
+    // top to bottom
+    for (uint8_t ind=0; ind < _plan.count/2; ind++) {
+	update_t win = _plan.window[ind];
+	_plan.window[ind] = _plan.window[_plan.count-1-ind];
+	_plan.window[_plan.count-1-ind] = win;
+    }
+
+    return _plan;
+}
+#endif
+
+/**
+ * Bring the display up to date.
+ * With OLED_FRAMEBUFFER the changed parts of the frame buffer are sent
+ * to the display using the windows chosen by planFlush(). Then wait for
+ * all queued display data to be sent.
+ */
+void oled256::flush(void)
+{
+#ifdef OLED_FRAMEBUFFER
+    const plan_t &plan = planFlush();
+
+    for (uint8_t ind=0; ind<plan.count; ind++) {
+	const update_t *win = &plan.window[ind];
+	panelWindow(win->x0*4, win->y0, win->x1*4+3, win->y1);
+	panelBegin();
+	for (uint8_t y=win->y0; y <= win->y1; y++) {
+	    panelData(&_frame[y][win->x0*2], (win->x1 - win->x0 + 1) * 2);
+	}
+	panelEnd();
+    }
+
+    for (uint8_t y=0; y<LCDHEIGHT; y++) {
+	_prevDirty[y].start = _dirty[y].start;
+	_prevDirty[y].end = _dirty[y].end;
+	_dirty[y].start = 0xFF;
+	_dirty[y].end = 0;
+    }
+    flip();
+#endif
+    _bus.flush();
+}
+
+/**
+ * Check for display data still being sent in the background.
+ * @returns true if the transmit queue is not empty
+ */
+bool oled256::isBusy(void)
+{
+    return _bus.isBusy();
+}
+
+/**
+ * Set a function to be called (from interrupt context) each time the
+ * transmit queue drains. Only used with OLED_ASYNC.
+ * @param callback - function to call, or NULL for none
+ */
+void oled256::setTxCallback(void (*callback)(void))
+{
+    _bus.setCallback(callback);
+}
+
 /**
  * Set the current pixel data column start and end address
  * @param start - start column
@@ -279,6 +616,10 @@ void oled256::setColumnAddr(uint8_t start, uint8_t end)
     writeCommand(CMD_SET_COLUMN_ADDR);
     writeData(start);
     writeData(end);
+    _win.colStart = start;
+    _win.colEnd = end;
+    _win.col = start;
+    _win.colValid = true;
 }
 
 /**
@@ -291,11 +632,16 @@ void oled256::setRowAddr(uint8_t start, uint8_t end)
     writeCommand(CMD_SET_ROW_ADDR);
     writeData(start);
     writeData(end);
+    _win.rowStart = start;
+    _win.rowEnd = end;
+    _win.row = start;
+    _win.rowValid = true;
 }
 
 /**
  * Set the current pixel data window.
- * Data writes will update only this section of the display.
+ * Data writes will update only this section of the display (or of
+ * the memory buffer being drawn into).
  * @param x - start row
  * @param y - start column
  * @param xend - end row
@@ -303,8 +649,16 @@ void oled256::setRowAddr(uint8_t start, uint8_t end)
  */
 void oled256::setWindow(uint8_t x, uint8_t y, uint8_t xend, uint8_t yend)
 {
-    setColumnAddr(MIN_SEG + x / 4, MIN_SEG + xend / 4);
-    setRowAddr(y, yend);
+    if (_mem != NULL) {
+	_memWin.x0 = (x / 4) * 2;
+	_memWin.x1 = (xend / 4) * 2 + 1;
+	_memWin.y0 = y;
+	_memWin.y1 = yend;
+	_memWin.x = _memWin.x0;
+	_memWin.y = y;
+    } else {
+	panelWindow(x, y, xend, yend);
+    }
     //cur_x = x;
     end_x = xend;
     //cur_y = y;
@@ -327,220 +681,1214 @@ void oled256::setWindow(uint8_t x, uint8_t y, uint8_t xend, uint8_t yend)
 }
 
 /**
- * Set the display pixel row offset.  Can be used to scroll the display.
- * Effectively moves y=0 to the offset y row.  The display wraps around to y=63.
- * @param offset - set y origin to this offset
+ * Set the display RAM window.
+ * Address commands are only sent when the controller's window or write
+ * pointer differ from what is needed, e.g. a glyph on the same text line
+ * as the previous one only needs a new column address.
  */
-void oled256::setOffset(uint8_t offset)
+void oled256::panelWindow(uint8_t x, uint8_t y, uint8_t xend, uint8_t yend)
 {
-    writeCommand(CMD_SET_DISPLAY_OFFSET);
-    writeData(offset);
-    _offset = offset;
+    uint8_t colStart = MIN_SEG + x / 4;
+    uint8_t colEnd = MIN_SEG + xend / 4;
+
+    // rows past the end of RAM wrap to the start, see scroll()
+    y = (y + _drawRow) & (2*LCDHEIGHT - 1);
+    yend = (yend + _drawRow) & (2*LCDHEIGHT - 1);
+
+    if (!_win.colValid || (_win.colStart != colStart) || (_win.colEnd != colEnd) || (_win.col != colStart)) {
+	setColumnAddr(colStart, colEnd);
+    }
+    // a larger row window is fine as long as the pointer is on row y
+    if (!_win.rowValid || (_win.row != y) || (y < _win.rowStart) || (yend > _win.rowEnd)) {
+	setRowAddr(y, yend);
+    }
 }
 
 /**
- * Get the current display offset (y origin).
- * @returns current y offset
+ * Start writing display RAM.
+ * If no other command has been sent since the last write the
+ * controller is still writing RAM, so the data simply continues from
+ * the current write pointer without resending CMD_WRITE_RAM.
  */
-uint8_t oled256::getOffset(void)
+void oled256::panelBegin(void)
 {
-    return _offset;
+    if (_win.writing) {
+	_bus.resumeWrite();
+    } else {
+	_bus.startWrite(CMD_WRITE_RAM);
+	_win.writing = true;
+    }
+    _streamCount = 0;
 }
 
-void oled256::setBufHeight(uint8_t rows)
+/**
+ * Send pixel data to display RAM.
+ */
+void oled256::panelData(const uint8_t *buf, uint16_t len)
 {
-    if (rows < LCDHEIGHT) {
-	return;
+    _streamCount += len;
+    while (len--) {
+	_bus.write(*buf++);
     }
-    writeCommand(CMD_SET_MULTIPLEX_RATIO);
-    writeData(rows & 0x7F);
-    _bufHeight = rows;
 }
 
-uint8_t oled256::getBufHeight(void)
+/**
+ * Finish writing display RAM and advance the tracked write pointer,
+ * which wraps within the window.
+ */
+void oled256::panelEnd(void)
 {
-    return _bufHeight;
-}
+    _bus.endWrite();
 
+    if (!_win.colValid || !_win.rowValid || (_streamCount & 1)) {
+	_win.colValid = false;
+	_win.rowValid = false;
+	return;
+    }
+    uint8_t width = _win.colEnd - _win.colStart + 1;
+    uint16_t size = (uint16_t)width * (_win.rowEnd - _win.rowStart + 1);
+    uint16_t pos = (uint16_t)(_win.row - _win.rowStart) * width + (_win.col - _win.colStart);
+    pos = (pos + _streamCount / 2) % size;
+    _win.row = _win.rowStart + pos / width;
+    _win.col = _win.colStart + pos % width;
+}
 
 /**
- * Set the font to use
- * @param font - new font to use
+ * Write a byte of pixel data into the memory buffer at the window
+ * write pointer. Rows outside the buffer are dropped.
  */
-void oled256::setFont(uint8_t font)
+void oled256::memWrite(uint8_t data)
 {
-    _font = font;
-    _fontHQ = NULL;
+    uint8_t row = _memWin.y - _memY;
+
+    if (row < _memRows) {
+	uint8_t *mem = &_mem[row * (LCDWIDTH/2) + _memWin.x];
+	if (*mem != data) {
+	    *mem = data;
+#ifdef OLED_FRAMEBUFFER
+	    uint8_t group = _memWin.x / 2;
+	    if (group < _dirty[_memWin.y].start) _dirty[_memWin.y].start = group;
+	    if (group > _dirty[_memWin.y].end) _dirty[_memWin.y].end = group;
+#endif
+	}
+    }
+
+    if (++_memWin.x > _memWin.x1) {
+	_memWin.x = _memWin.x0;
+	if (++_memWin.y > _memWin.y1) {
+	    _memWin.y = _memWin.y0;
+	}
+    }
 }
 
 /**
- * Set the font to use
- * @param font - new font to use
+ * Forget the cached edge pixels, e.g. when the rows being drawn into
+ * have been replaced. Groups not in the cache read as _edgeFill.
  */
-void oled256::setFontHQ(uint8_t font)
+void oled256::edgeReset(void)
 {
-    _fontHQ = &fontsHQ[font];
+#ifndef OLED_FRAMEBUFFER
+    for (uint8_t ind=0; ind<LCDHEIGHT; ind++) {
+	for (uint8_t way=0; way<OLED_EDGE_WAYS; way++) {
+	    _edge[ind][way].group = 0xFF;
+	}
+    }
+#endif
 }
 
 /**
- * Fill the display with the specified colour by setting
- * every pixel to the colour.
- * @param colour - fill the display with this colour.
+ * Read back the current pixels of a column group.
+ * @param y - display row
+ * @param group - column group (4 pixels)
+ * @returns the 4 pixels, leftmost in the top nibble
  */
-void oled256::fill(uint8_t colour)
+uint16_t oled256::edgeRead(uint8_t y, uint8_t group)
 {
-    uint8_t x,y;
-    setColumnAddr(MIN_SEG, MAX_SEG);	// SEG0 - SEG479
-    setRowAddr(0, 63);	
-
-    colour = (colour & 0x0F) | (colour << 4);;
-
-    writeCommand(CMD_WRITE_RAM);
-    for(y=0; y<64; y++)
-    {
-	for(x=0; x<64; x++) {
-	    writeData(colour);
-	    writeData(colour);
+    if (group >= LCDWIDTH/4) {
+	return _edgeFill;
+    }
+    if (_mem != NULL) {
+	uint8_t row = y - _memY;
+	if (row >= _memRows) {
+	    return _edgeFill;
 	}
+	uint8_t *mem = &_mem[row * (LCDWIDTH/2) + group * 2];
+	return (mem[0] << 8) | mem[1];
     }
-    delay(1);
+#ifndef OLED_FRAMEBUFFER
+    if (y < LCDHEIGHT) {
+	for (uint8_t way=0; way<OLED_EDGE_WAYS; way++) {
+	    if (_edge[y][way].group == group) {
+		return _edge[y][way].pixels;
+	    }
+	}
+    }
+#endif
+    return _edgeFill;
 }
 
-
 /**
- * Turn the display off
+ * Merge new pixels into a column group that is only partly drawn.
+ * @param y - display row
+ * @param group - column group (4 pixels)
+ * @param pixels - new pixels
+ * @param mask - nibbles of pixels to use, the rest are kept
+ * @returns merged pixels
  */
-void oled256::off(void)
+uint16_t oled256::edgeMerge(uint8_t y, uint8_t group, uint16_t pixels, uint16_t mask)
 {
-    writeCommand(CMD_SET_DISPLAY_OFF);
+    if (mask == 0xFFFF) {
+	return pixels;
+    }
+    return (pixels & mask) | (edgeRead(y, group) & ~mask);
 }
 
-
 /**
- * Turn the display on
+ * Remember the edge groups of a row that has just been drawn.
+ * Groups cached between first and last have been drawn over and are
+ * dropped. Nothing is cached when drawing into memory.
+ * @param y - display row
+ * @param first - leftmost column group drawn
+ * @param left - pixels sent to the first group
+ * @param last - rightmost column group drawn
+ * @param right - pixels sent to the last group
  */
-void oled256::on(void)
+void oled256::edgeSave(uint8_t y, uint8_t first, uint16_t left, uint8_t last, uint16_t right)
 {
-    writeCommand(CMD_SET_DISPLAY_ON);
-}
+#ifndef OLED_FRAMEBUFFER
+    if ((_mem != NULL) || (y >= LCDHEIGHT)) {
+	return;
+    }
 
+    edge_t *edge = _edge[y];
+    edge_t old[OLED_EDGE_WAYS];
+    uint8_t way = 0;
+
+    memcpy(old, edge, sizeof(old));
+
+    // the right edge is the one the next glyph on the line will share
+    edge[way].group = last;
+    edge[way++].pixels = right;
+    if ((first != last) && (way < OLED_EDGE_WAYS)) {
+	edge[way].group = first;
+	edge[way++].pixels = left;
+    }
+    for (uint8_t ind=0; (ind < OLED_EDGE_WAYS) && (way < OLED_EDGE_WAYS); ind++) {
+	if ((old[ind].group != 0xFF) && ((old[ind].group < first) || (old[ind].group > last))) {
+	    edge[way++] = old[ind];
+	}
+    }
+    while (way < OLED_EDGE_WAYS) {
+	edge[way++].group = 0xFF;
+    }
+#else
+    (void)y;
+    (void)first;
+    (void)left;
+    (void)last;
+    (void)right;
+#endif
+}
 
 /**
- * Clear the display by setting every pixel to the background colour.
+ * Limit drawing to a rectangle, within the current clip rectangle,
+ * until popClip(). Every drawing call sends only the rows and columns
+ * inside the clip rectangle, and a draw wholly outside it sends nothing.
+ * @param rect - rectangle to draw in, can be partly off the display
+ * @returns false if OLED_CLIP_DEPTH rectangles are already pushed, in
+ *          which case the clip rectangle is unchanged
  */
-void oled256::clear()
+bool oled256::pushClip(const rect_t &rect)
 {
-    fill(background);
-
-    for (uint8_t ind=0; ind<LCDHEIGHT; ind++) {
-	gddram[ind].xaddr = 0;
-	gddram[ind].pixels = 0;
+    if (_clipDepth >= OLED_CLIP_DEPTH) {
+	return false;
     }
+    _clipStack[_clipDepth++] = _clip;
+    clipTo(rect);
+    return true;
 }
 
 /**
- * Reset the OLED display.
+ * Go back to the clip rectangle before the last pushClip().
  */
-void oled256::reset()
+void oled256::popClip(void)
 {
-    digitalWrite(_reset,LOW);
-    delay(10);
-    digitalWrite(_reset,HIGH);
-    delay(10);
+    if (_clipDepth > 0) {
+	_clip = _clipStack[--_clipDepth];
+    }
 }
 
-
 /**
- * Return the width of the specified character in the current font.
- * @param ch - return the width of this character
- * @returns width of the glyph
+ * Get the current clip rectangle.
+ * @returns the clip rectangle, 0 wide and high if nothing can be drawn
  */
-uint8_t oled256::glyphWidth(char ch)
+rect_t oled256::getClip(void)
 {
-    if (_fontHQ == NULL) {
-	uint8_t glyph_width=0;
-	if ((ch < pgm_read_byte(&fonts[_font].glyph_beg)) || (ch > pgm_read_byte(&fonts[_font].glyph_end))) {
-	    uint8_t *map = (uint8_t *)pgm_read_word(&fonts[_font].map);
-	    if (map != 0) {
-		ch = pgm_read_byte(&map[(uint8_t)ch]);
-	    } else {
-		ch = pgm_read_byte(&fonts[_font].glyph_def);
-	    }
-	}
+    rect_t rect = {0, 0, 0, 0};
 
-	/* make zero based index into the font data arrays */
-	ch -= pgm_read_byte(&fonts[_font].glyph_beg);
-	glyph_width = pgm_read_byte(&fonts[_font].fixed_width);	/* check if it is a fixed width */
-	if (glyph_width == 0) {
-	    uint8_t *width_table = (uint8_t *)pgm_read_word(&fonts[_font].width_table);	/* get the variable width instead */
-	    glyph_width = pgm_read_byte(&width_table[(uint8_t)ch]);	/* get the variable width instead */
-	}
-	return glyph_width;
-    } else {
-	uint8_t gind;
-	if (ch >= ' ' && ch <= 0x7f) {
-	    gind = pgm_read_byte(&_fontHQ->map[ch - ' ']);
-	} else {
-	    // default to a space
-	    gind = 0;
-	}
-	return (uint8_t)pgm_read_byte(&(_fontHQ->glyphs[gind].width));
+    if ((_clip.x0 <= _clip.x1) && (_clip.y0 <= _clip.y1)) {
+	rect.x = _clip.x0;
+	rect.y = _clip.y0;
+	rect.width = _clip.x1 - _clip.x0 + 1;
+	rect.height = _clip.y1 - _clip.y0 + 1;
     }
-
+    return rect;
 }
 
 /**
- * Return the height of the current font. All characters in a font are the same height.
- * @returns height of the glyph font
+ * Shrink the clip rectangle to its overlap with a rectangle.
+ * @param rect - rectangle to overlap
  */
-uint8_t oled256::glyphHeight()
+void oled256::clipTo(const rect_t &rect)
 {
-    if (_fontHQ == NULL) {
-	return pgm_read_byte(&fonts[_font].glyph_height);
-    } else {
-	return _fontHQ->height;
+    int32_t x1 = (int32_t)rect.x + rect.width - 1;
+    int32_t y1 = (int32_t)rect.y + rect.height - 1;
+
+    if (rect.x > _clip.x0) {
+	_clip.x0 = rect.x;
+    }
+    if (rect.y > _clip.y0) {
+	_clip.y0 = rect.y;
+    }
+    if (x1 < _clip.x1) {
+	_clip.x1 = x1;
+    }
+    if (y1 < _clip.y1) {
+	_clip.y1 = y1;
     }
 }
 
 /**
- * Draw a character glyph on the screen at x,y.
- * @param x - x position to start glyph (x=0 for left, x=256-glyphWidth() for right)
- * @param y - y position to start glyph (y=0 for top, y=64-glyphHeight() for bottom)
- * @param ch - the character to draw
- * @param colour - foreground colour
- * @param bg - background colour
- * @returns width of the glyph
- * @note currently only works with fixed width glyphs due to display buffer used
- *       to determine the adjacent glyph when updating a shared cell (two pixels per byte)
+ * Work out which part of a draw is inside the clip rectangle. Draws
+ * build their rows as usual and send only the groups and rows given
+ * by the part.
+ * @param x - left pixel column of the draw, can be negative
+ * @param y - top row of the draw, can be negative
+ * @param width - width of the draw in pixels
+ * @param height - height of the draw in rows
+ * @param part - set to the visible part of the draw
+ * @returns false if none of the draw is visible
  */
-uint8_t oled256::glyphDraw(uint16_t x, uint16_t y, char ch, uint16_t colour, uint16_t bg)
+bool oled256::clipPart(int16_t x, int16_t y, uint16_t width, uint16_t height, part_t *part)
 {
-    if (_fontHQ != NULL) {
-	return glyphDrawHQ(x,y,ch,colour,bg);
-    }
+    int32_t x1 = (int32_t)x + width - 1;
+    int32_t y1 = (int32_t)y + height - 1;
+    int16_t x0 = (x > _clip.x0) ? x : _clip.x0;
+    int16_t y0 = (y > _clip.y0) ? y : _clip.y0;
 
-    uint8_t pix;
-    uint32_t bits=0xAA55AA55;
-    int ind;
-    uint8_t *glyph;
-    uint16_t glyph_width;
-    uint16_t glyph_height;
-    uint16_t glyph_byte_width;
+    if (x1 > _clip.x1) {
+	x1 = _clip.x1;
+    }
+    if (y1 > _clip.y1) {
+	y1 = _clip.y1;
+    }
+    if ((x0 > x1) || (y0 > y1)) {
+	return false;
+    }
+
+    part->x = x0;
+    part->xend = x1;
+    part->y = y0;
+    part->rows = y1 - y0 + 1;
+    part->first = x0 / 4;
+    part->groups = x1/4 - x0/4 + 1;
+    part->skip = x0/4 - (x >> 2);
+    part->skipRows = y0 - y;
+    part->lmask = 0xFFFF >> ((x0 & 0x3) * 4);
+    part->rmask = 0xFFFF << ((3 - (x1 & 0x3)) * 4);
+    if (part->groups == 1) {
+	part->lmask &= part->rmask;
+    }
+    return true;
+}
+
+/**
+ * Render a complete screen one horizontal band at a time.
+ * draw() is called once per band with drawing going into buf, which
+ * only holds the rows of the current band; everything outside the band
+ * is discarded. Each finished band is sent to the display as a single
+ * RAM write. Bands start out filled with the background colour.
+ * The cursor, colours and font are restored before each call so that
+ * draw() produces the same output every time.
+ * With OLED_FRAMEBUFFER the buffer is not needed; the frame is redrawn
+ * once and the changes are flushed.
+ * @param draw - function that draws the whole screen
+ * @param buf - strip buffer of rows * LCDWIDTH/2 bytes
+ * @param rows - number of rows in a band
+ */
+void oled256::renderBands(void (*draw)(void), uint8_t *buf, uint8_t rows)
+{
+#ifdef OLED_FRAMEBUFFER
+    (void)buf;
+    (void)rows;
+    fill(background);
+    draw();
+    flush();
+#else
+    uint8_t x = cur_x;
+    uint8_t y = cur_y;
+    uint8_t fg = foreground;
+    uint8_t bg = background;
+    uint8_t font = _font;
+    font_t *fontHQ = _fontHQ;
+#ifdef OLED_FONT_SOURCE
+    oledFont *extFont = _extFont;
+#endif
+    uint8_t fillByte = background | (background << 4);
+    clip_t clip = _clip;
+    uint8_t clipDepth = _clipDepth;
+
+    _mem = buf;
+    _memRows = rows;
+    for (_memY = 0; _memY < LCDHEIGHT; _memY += rows) {
+	uint8_t height = (LCDHEIGHT - _memY < rows) ? LCDHEIGHT - _memY : rows;
+
+	memset(buf, fillByte, (uint16_t)rows * (LCDWIDTH/2));
+	cur_x = x;
+	cur_y = y;
+	foreground = fg;
+	background = bg;
+	// draws outside the band cost nothing
+	rect_t band = {0, _memY, LCDWIDTH, height};
+	_clip = clip;
+	_clipDepth = clipDepth;
+	clipTo(band);
+	bool reload = (_font != font) || (_fontHQ != fontHQ);
+#ifdef OLED_FONT_SOURCE
+	reload |= (_extFont != extFont);
+	_extFont = extFont;
+#endif
+	if (reload) {
+	    _font = font;
+	    _fontHQ = fontHQ;
+	    loadMetrics();
+	}
+
+	draw();
+
+	// in two windows if the band wraps around the end of RAM
+	uint8_t wrapY = wrapRow();
+	for (uint8_t y=_memY; y<_memY+height; ) {
+	    uint8_t yend = ((y < wrapY) && (wrapY < _memY+height)) ? wrapY - 1 : _memY + height - 1;
+	    panelWindow(0, y, LCDWIDTH-1, yend);
+	    panelBegin();
+	    panelData(&buf[(uint16_t)(y - _memY) * (LCDWIDTH/2)], (uint16_t)(yend - y + 1) * (LCDWIDTH/2));
+	    panelEnd();
+	    y = yend + 1;
+	}
+    }
+    _mem = NULL;
+    _clip = clip;
+    _clipDepth = clipDepth;
+    _edgeFill = fillByte | (fillByte << 8);
+    edgeReset();
+    flip();
+#endif
+}
+
+/**
+ * Enable or disable double buffering.
+ * The display shows 64 of the controller's 128 RAM rows. With double
+ * buffering on, drawing goes to the other 64 rows and flip() swaps the
+ * two by moving the display start line, so a frame is never seen half
+ * drawn. After a flip the hidden rows still hold the frame before the
+ * one now shown. Requires the default 64 row buffer height.
+ * With OLED_FRAMEBUFFER, flush() sends to the hidden rows and flips.
+ * @param enable - true to draw into the hidden rows
+ */
+void oled256::setDoubleBuffer(bool enable)
+{
+    _doubleBuffer = enable;
+    _drawRow = enable ? (_showRow ^ LCDHEIGHT) : _showRow;
+    edgeReset();
+#ifdef OLED_FRAMEBUFFER
+    // the hidden rows have never been written
+    for (uint8_t ind=0; ind<LCDHEIGHT; ind++) {
+	_prevDirty[ind].start = 0;
+	_prevDirty[ind].end = LCDWIDTH/4 - 1;
+    }
+#endif
+}
+
+/**
+ * Show the rows that have been drawn into and start drawing into the
+ * rows that were being shown. Does nothing unless double buffering is on.
+ */
+void oled256::flip(void)
+{
+    if (!_doubleBuffer) {
+	return;
+    }
+    writeCommand(CMD_SET_DISPLAY_START_LINE);
+    writeData(_drawRow);
+    _showRow = _drawRow;
+    _drawRow ^= LCDHEIGHT;
+    edgeReset();
+}
+
+/**
+ * Scroll the display up by moving the display start line through the
+ * controller's 128 RAM rows. Only the command is sent. y=0 stays the
+ * top row shown, and the rows brought in at the bottom still hold what
+ * was last drawn into those RAM rows, so they need redrawing.
+ * Once scrolled, the rows shown can run past the end of RAM and wrap
+ * to the start. fill(), flush() and renderBands() split their windows
+ * there, but any other draw must lie wholly above or below wrapRow();
+ * use pushClip() to draw something that straddles it in two parts.
+ * Turns double buffering off.
+ * @param rows - rows to scroll up by, from LCDHEIGHT up every row shown
+ *               needs redrawing
+ */
+void oled256::scroll(uint8_t rows)
+{
+    // LCDHEIGHT rows or more leaves nothing on screen to move up
+    uint8_t shift = (rows < LCDHEIGHT) ? rows : LCDHEIGHT;
+
+    if (_doubleBuffer) {
+	setDoubleBuffer(false);
+    }
+    _showRow = (_showRow + rows) & (2*LCDHEIGHT - 1);
+    _drawRow = _showRow;
+    writeCommand(CMD_SET_DISPLAY_START_LINE);
+    writeData(_showRow);
+
+#ifdef OLED_FRAMEBUFFER
+    // keep the frame buffer in step with the display, and send the new rows
+    memmove(&_frame[0][0], &_frame[shift][0], (LCDHEIGHT - shift) * (LCDWIDTH/2));
+    memmove(&_dirty[0], &_dirty[shift], (LCDHEIGHT - shift) * sizeof(_dirty[0]));
+    for (uint8_t y=LCDHEIGHT-shift; y<LCDHEIGHT; y++) {
+	_dirty[y].start = 0;
+	_dirty[y].end = LCDWIDTH/4 - 1;
+    }
+#else
+    // the remembered edges move up with the pixels
+    memmove(&_edge[0][0], &_edge[shift][0], (LCDHEIGHT - shift) * sizeof(_edge[0]));
+    for (uint8_t y=LCDHEIGHT-shift; y<LCDHEIGHT; y++) {
+	for (uint8_t way=0; way<OLED_EDGE_WAYS; way++) {
+	    _edge[y][way].group = 0xFF;
+	}
+    }
+#endif
+}
+
+/**
+ * Find where the rows shown wrap from the end of RAM to the start.
+ * @returns the first display row held at the start of RAM, or
+ *          LCDHEIGHT if the rows shown don't wrap
+ */
+uint8_t oled256::wrapRow(void)
+{
+    return (_drawRow > LCDHEIGHT) ? 2*LCDHEIGHT - _drawRow : LCDHEIGHT;
+}
+
+#ifdef OLED_FRAMEBUFFER
+/**
+ * Set a single pixel in the frame buffer.
+ * @param x - pixel column
+ * @param y - pixel row
+ * @param colour - pixel colour (0-15)
+ */
+void oled256::setPixel(uint8_t x, uint8_t y, uint8_t colour)
+{
+    if ((x < _clip.x0) || (x > _clip.x1) || (y < _clip.y0) || (y > _clip.y1)) {
+	return;
+    }
+    uint8_t *mem = &_frame[y][x / 2];
+    uint8_t data = (x & 1) ? ((*mem & 0xF0) | (colour & 0x0F)) : ((*mem & 0x0F) | (colour << 4));
+    if (*mem != data) {
+	*mem = data;
+	if (x/4 < _dirty[y].start) _dirty[y].start = x/4;
+	if (x/4 > _dirty[y].end) _dirty[y].end = x/4;
+    }
+}
+
+/**
+ * Read a single pixel from the frame buffer.
+ * @param x - pixel column
+ * @param y - pixel row
+ * @returns pixel colour (0-15)
+ */
+uint8_t oled256::getPixel(uint8_t x, uint8_t y)
+{
+    if (y >= LCDHEIGHT) {
+	return 0;
+    }
+    return (x & 1) ? (_frame[y][x / 2] & 0x0F) : (_frame[y][x / 2] >> 4);
+}
+#endif
+
+/**
+ * Set the display pixel row offset.  Can be used to scroll the display.
+ * Effectively moves y=0 to the offset y row.  The display wraps around to y=63.
+ * @param offset - set y origin to this offset
+ */
+void oled256::setOffset(uint8_t offset)
+{
+    writeCommand(CMD_SET_DISPLAY_OFFSET);
+    writeData(offset);
+    _offset = offset;
+}
+
+/**
+ * Get the current display offset (y origin).
+ * @returns current y offset
+ */
+uint8_t oled256::getOffset(void)
+{
+    return _offset;
+}
+
+void oled256::setBufHeight(uint8_t rows)
+{
+    if (rows < LCDHEIGHT) {
+	return;
+    }
+    writeCommand(CMD_SET_MULTIPLEX_RATIO);
+    writeData(rows & 0x7F);
+    _bufHeight = rows;
+}
+
+uint8_t oled256::getBufHeight(void)
+{
+    return _bufHeight;
+}
+
+
+/**
+ * Set the font to use
+ * @param font - new font to use
+ */
+void oled256::setFont(uint8_t font)
+{
+    _font = font;
+    _fontHQ = NULL;
+#ifdef OLED_FONT_SOURCE
+    _extFont = NULL;
+#endif
+    loadMetrics();
+}
+
+/**
+ * Set the font to use
+ * @param font - new font to use
+ */
+void oled256::setFontHQ(uint8_t font)
+{
+    _fontHQ = &fontsHQ[font];
+#ifdef OLED_FONT_SOURCE
+    _extFont = NULL;
+#endif
+    loadMetrics();
+}
+
+/**
+ * Get the current 1bpp font.
+ * @returns the font, which is kept while an HQ font is in use
+ */
+uint8_t oled256::getFont(void)
+{
+    return _font;
+}
+
+/**
+ * Get the current HQ font.
+ * @returns the HQ font, or NULL if a 1bpp font is in use
+ */
+font_t *oled256::getFontHQ(void)
+{
+    return _fontHQ;
+}
+
+#ifdef OLED_FONT_SOURCE
+/**
+ * Set the font to a 1bpp font read from external storage.
+ * @param font - font, begin() must have succeeded
+ */
+void oled256::setFont(oledFont *font)
+{
+    _extFont = font;
+    _fontHQ = NULL;
+    loadMetrics();
+}
+#endif
+
+/**
+ * Fill the display with the specified colour by setting
+ * every pixel to the colour. Only the clip rectangle is filled
+ * while one is pushed.
+ * @param colour - fill the display with this colour.
+ */
+void oled256::fill(uint8_t colour)
+{
+    if ((_clip.x0 != 0) || (_clip.y0 != 0) || (_clip.x1 != LCDWIDTH-1) || (_clip.y1 != LCDHEIGHT-1)) {
+	// only the clip rectangle
+	if ((_clip.x0 <= _clip.x1) && (_clip.y0 <= _clip.y1)) {
+	    fillRect(_clip.x0, _clip.y0, _clip.x1 - _clip.x0 + 1, _clip.y1 - _clip.y0 + 1, colour);
+	}
+	return;
+    }
+
+    colour = (colour & 0x0F) | (colour << 4);
+
+    // in two windows if the rows shown wrap around the end of RAM
+    uint8_t wrapY = wrapRow();
+    for (uint8_t y=0; y<LCDHEIGHT; ) {
+	uint8_t yend = (y < wrapY) ? wrapY - 1 : LCDHEIGHT - 1;
+	setWindow(0, y, LCDWIDTH-1, yend);	// SEG0 - SEG479
+	beginStream();
+	streamFill(colour, (uint16_t)LCDWIDTH / 2 * (yend - y + 1));
+	endStream();
+	y = yend + 1;
+    }
+    _edgeFill = colour | (colour << 8);
+    edgeReset();
+    delay(1);
+}
+
+/**
+ * Fill a rectangle with a colour, keeping the pixels outside it that
+ * share its first and last column groups. Parts outside the clip
+ * rectangle are not drawn.
+ * @param x - left edge, can be negative
+ * @param y - top edge, can be negative
+ * @param width - width in pixels
+ * @param height - height in pixels
+ * @param colour - colour to fill with
+ */
+void oled256::fillRect(int16_t x, int16_t y, uint16_t width, uint8_t height, uint8_t colour)
+{
+    part_t part;
+    uint16_t pixels = (colour & 0x0F) * 0x1111;
+
+    if (!clipPart(x, y, width, height, &part)) {
+	return;
+    }
+
+    setWindow(part.x, part.y, part.xend, part.y+part.rows-1);
+    beginStream();
+    for (uint8_t yind=0; yind<part.rows; yind++) {
+	uint16_t left = edgeMerge(part.y+yind, part.first, pixels, part.lmask);
+	uint16_t right = left;
+
+	streamPixels(left);
+	if (part.groups > 1) {
+	    streamFill(pixels & 0xFF, (part.groups - 2) * 2);
+	    right = edgeMerge(part.y+yind, part.first+part.groups-1, pixels, part.rmask);
+	    streamPixels(right);
+	}
+	edgeSave(part.y+yind, part.first, left, part.first+part.groups-1, right);
+    }
+    endStream();
+}
+
+
+/**
+ * Turn the display off
+ */
+void oled256::off(void)
+{
+    writeCommand(CMD_SET_DISPLAY_OFF);
+}
+
+
+/**
+ * Turn the display on
+ */
+void oled256::on(void)
+{
+    writeCommand(CMD_SET_DISPLAY_ON);
+}
+
+
+/**
+ * Clear the display by setting every pixel to the background colour.
+ */
+void oled256::clear()
+{
+    fill(background);
+}
+
+/**
+ * Reset the OLED display.
+ */
+void oled256::reset()
+{
+    digitalWrite(_reset,LOW);
+    delay(10);
+    digitalWrite(_reset,HIGH);
+    delay(10);
+    _win.colValid = false;
+    _win.rowValid = false;
+    _win.writing = false;
+}
+
+
+/**
+ * Return the width of the specified character in the current font.
+ * This is how far drawing the character moves the cursor.
+ * @param ch - return the width of this character (unicode code point)
+ * @returns width of the glyph
+ */
+uint8_t oled256::glyphWidth(uint16_t ch)
+{
+    if ((ch >= ' ') && (ch <= 0x7f)) {
+	return _metrics.width[ch - ' '];
+    }
+    return glyphAdvance(ch);
+}
+
+/**
+ * Return the height of the current font. All characters in a font are the same height.
+ * @returns height of the glyph font
+ */
+uint8_t oled256::glyphHeight()
+{
+    return _metrics.height;
+}
+
+/**
+ * Get the pixels drawing a glyph sets, relative to where it is drawn.
+ * 1bpp glyphs cover their width and the font height, HQ glyphs only
+ * the rectangle around their ink, which can start left of or above
+ * where they are drawn.
+ * @param ch - the character (unicode code point)
+ * @returns box the glyph covers
+ */
+rect_t oled256::glyphBounds(uint16_t ch)
+{
+    rect_t bounds;
+
+    bounds.x = 0;
+    bounds.y = 0;
+    bounds.width = glyphWidth(ch);
+    bounds.height = _metrics.height;
+    if (_fontHQ != NULL) {
+	const glyph_t *glyph = &_fontHQ->glyphs[hqIndex(ch)];
+	if (pgm_read_word(&glyph->glyph) != 0) {
+	    bounds.x = (int8_t)pgm_read_byte(&glyph->xoffset);
+	    bounds.y = (int8_t)pgm_read_byte(&glyph->yoffset);
+	    bounds.width = pgm_read_byte(&glyph->xrect);
+	    bounds.height = pgm_read_byte(&glyph->yrect);
+	} else {
+	    bounds.width = pgm_read_byte(&glyph->width);
+	}
+    }
+    return bounds;
+}
+
+/**
+ * Find a character in the current HQ font.
+ * @param ch - character to find (unicode code point)
+ * @returns index into the font's glyphs, the font's fallback glyph if
+ *          it does not have ch, or a space if it has no fallback either
+ */
+uint8_t oled256::hqIndex(uint16_t ch)
+{
+    uint8_t gind;
+
+    if (ch >= ' ' && ch <= 0x7f) {
+	gind = pgm_read_byte(&_fontHQ->map[ch - ' ']);
+    } else {
+	gind = codepointGlyph(_fontHQ->cmap, _fontHQ->cmapSize, ch, 0xFF);
+    }
+    if ((gind == 0xFF) && (ch != (uint8_t)_fontHQ->fallback)) {
+	gind = hqIndex((uint8_t)_fontHQ->fallback);
+    }
+    if (gind == 0xFF) {
+	gind = 0;
+    }
+    return gind;
+}
+
+/**
+ * Look up a code point in a font's sorted code point table.
+ * @param cmap - table in flash, can be NULL
+ * @param size - entries in the table
+ * @param ch - code point to find
+ * @param def - returned if ch is not in the table
+ * @returns glyph for ch
+ */
+uint8_t oled256::codepointGlyph(const codepoint_t *cmap, uint8_t size, uint16_t ch, uint8_t def)
+{
+    uint8_t low = 0;
+    uint8_t high = size;
+
+    if (cmap == NULL) {
+	return def;
+    }
+    // binary search
+    while (low < high) {
+	uint8_t mid = (low + high) / 2;
+	uint16_t code = pgm_read_word(&cmap[mid].code);
+	if (code == ch) {
+	    return pgm_read_byte(&cmap[mid].glyph);
+	}
+	if (code < ch) {
+	    low = mid + 1;
+	} else {
+	    high = mid;
+	}
+    }
+    return def;
+}
+
+/**
+ * Decode one character of UTF-8 text. Bytes that are not valid UTF-8
+ * decode one at a time as U+FFFD, as do code points beyond U+FFFF.
+ * Fonts do not have U+FFFD so it is drawn as the fallback glyph.
+ * @param str - text to decode
+ * @param len - bytes available
+ * @param ch - set to the code point
+ * @returns bytes used, 0 if the sequence continues past len
+ */
+uint8_t oled256::utf8Decode(const char *str, size_t len, uint16_t *ch)
+{
+    uint8_t lead = str[0];
+    uint8_t more;
+    uint32_t code;
+
+    if (lead < 0x80) {
+	*ch = lead;
+	return 1;
+    }
+    if ((lead < 0xC0) || (lead >= 0xF8)) {
+	// stray continuation byte or not UTF-8
+	*ch = 0xFFFD;
+	return 1;
+    }
+
+    more = (lead >= 0xF0) ? 3 : ((lead >= 0xE0) ? 2 : 1);
+    code = lead & (0x3F >> more);
+    for (uint8_t ind=1; ind<=more; ind++) {
+	if (ind >= len) {
+	    return 0;
+	}
+	if ((str[ind] & 0xC0) != 0x80) {
+	    // cut short
+	    *ch = 0xFFFD;
+	    return ind;
+	}
+	code = (code << 6) | (str[ind] & 0x3F);
+    }
+    *ch = (code > 0xFFFF) ? 0xFFFD : code;
+    return more + 1;
+}
+
+/**
+ * Work out the width of a character straight from the font data.
+ * @param ch - character
+ * @returns how far drawing the character moves the cursor
+ */
+uint8_t oled256::glyphAdvance(uint16_t ch)
+{
+    if (_fontHQ == NULL) {
+	return monoGlyph(ch, NULL);
+    }
+
+    uint8_t gind = hqIndex(ch);
+    if (pgm_read_word(&_fontHQ->glyphs[gind].glyph) == 0) {
+	return (uint8_t)pgm_read_byte(&(_fontHQ->glyphs[gind].width)) + 1;
+    }
+    // matches what glyphDrawHQ() returns
+    return (uint8_t)pgm_read_byte(&(_fontHQ->glyphs[gind].xrect)) +
+	   (int8_t)pgm_read_byte(&(_fontHQ->glyphs[gind].xoffset)) + 1;
+}
+
+/**
+ * Load the height and character widths of the current font into RAM.
+ * Called whenever the font changes.
+ */
+void oled256::loadMetrics(void)
+{
+    if (_fontHQ != NULL) {
+	_metrics.height = _fontHQ->height;
+	_metrics.stride = 0;
+	_metrics.progmem = true;
+#ifdef OLED_FONT_SOURCE
+    } else if (_extFont != NULL) {
+	_metrics.height = _extFont->height();
+	_metrics.stride = _extFont->stride();
+	_metrics.progmem = false;
+#endif
+    } else {
+	_metrics.height = pgm_read_byte(&fonts[_font].glyph_height);
+	_metrics.stride = pgm_read_byte(&fonts[_font].store_width);
+	_metrics.progmem = true;
+    }
+    for (uint8_t ind=0; ind<sizeof(_metrics.width); ind++) {
+	_metrics.width[ind] = glyphAdvance(' ' + ind);
+    }
+}
+
+/**
+ * Measure a string in the current font.
+ * @param str - string to measure
+ * @returns width of the widest line in pixels
+ */
+uint16_t oled256::textWidth(const char *str)
+{
+    uint16_t width = 0;
+    uint16_t line = 0;
+
+    while (*str) {
+	uint16_t ch;
+	str += utf8Decode(str, 4, &ch);
+	if (ch == '\n') {
+	    line = 0;
+	} else if (ch != '\r') {
+	    line += glyphWidth(ch);
+	    if (line > width) {
+		width = line;
+	    }
+	}
+    }
+    return width;
+}
+
+/**
+ * Get the box a string covers when drawn at x,y.
+ * @param x - x position of the string
+ * @param y - y position of the top of the string
+ * @param str - string to measure, lines separated by '\n'
+ * @returns box around every line of the string
+ */
+rect_t oled256::textBounds(int16_t x, int16_t y, const char *str)
+{
+    rect_t bounds;
+    uint8_t lines = 1;
+
+    for (const char *ch=str; *ch; ch++) {
+	if (*ch == '\n') {
+	    lines++;
+	}
+    }
+    bounds.x = x;
+    bounds.y = y;
+    bounds.width = textWidth(str);
+    bounds.height = (uint16_t)lines * _metrics.height;
+    return bounds;
+}
+
+/**
+ * Draw a string aligned within a box, in the current colours and
+ * without moving the cursor. Each line, separated by '\n', is aligned
+ * on its own. Text that does not fit is not clipped.
+ * @param box - box to align the text in
+ * @param str - string to draw
+ * @param align - one of OLED_ALIGN_LEFT, OLED_ALIGN_CENTRE or
+ *        OLED_ALIGN_RIGHT, or'ed with one of OLED_ALIGN_TOP,
+ *        OLED_ALIGN_MIDDLE or OLED_ALIGN_BOTTOM
+ */
+void oled256::drawText(const rect_t &box, const char *str, uint8_t align)
+{
+    rect_t bounds = textBounds(box.x, box.y, str);
+    int16_t y = box.y;
+
+    if (align & OLED_ALIGN_MIDDLE) {
+	y += ((int16_t)box.height - (int16_t)bounds.height) / 2;
+    } else if (align & OLED_ALIGN_BOTTOM) {
+	y += (int16_t)box.height - (int16_t)bounds.height;
+    }
+    if (y < box.y) {
+	y = box.y;
+    }
+
+    while (*str) {
+	uint16_t len = 0;
+	uint16_t width = 0;
+	while (str[len] && (str[len] != '\n')) {
+	    uint16_t ch;
+	    len += utf8Decode(&str[len], 4, &ch);
+	    if (ch != '\r') {
+		width += glyphWidth(ch);
+	    }
+	}
+
+	int16_t x = box.x;
+	if (align & OLED_ALIGN_CENTRE) {
+	    x += ((int16_t)box.width - (int16_t)width) / 2;
+	} else if (align & OLED_ALIGN_RIGHT) {
+	    x += (int16_t)box.width - (int16_t)width;
+	}
+	if (x < box.x) {
+	    x = box.x;
+	}
+
+	drawString(x, y, str, len);
+	y += _metrics.height;
+	str += len;
+	if (*str == '\n') {
+	    str++;
+	}
+    }
+}
+
+/**
+ * Draw a string word wrapped into a box, in the current colours and
+ * without moving the cursor. Lines break after the last space that
+ * fits, at '\n', or inside a word that is wider than the box. Each
+ * line is measured once as it is laid out and drawn with drawString().
+ * Text is clipped to the box, so a line cut by the bottom of the box is
+ * drawn down to the bottom.
+ * @param box - box to draw the text in
+ * @param str - string to draw
+ * @param align - OLED_ALIGN_LEFT, OLED_ALIGN_CENTRE, OLED_ALIGN_RIGHT or
+ *        OLED_ALIGN_JUSTIFY. Justified lines are widened at the spaces,
+ *        except those that end a paragraph.
+ * @returns bytes of str on the lines that fit in the box, less than
+ *          strlen(str) if the text overflows
+ */
+size_t oled256::drawTextBox(const rect_t &box, const char *str, uint8_t align)
+{
+    const char *start = str;
+    size_t shown = 0;
+    int16_t y = box.y;
+    int16_t bottom = box.y + (int16_t)box.height;
+    clip_t clip = _clip;
+
+    clipTo(box);
+    align &= OLED_ALIGN_JUSTIFY;
+
+    while (*str && (y < bottom)) {
+	size_t len = 0;		// bytes measured
+	size_t end = 0;		// bytes on the line
+	size_t next;		// where the next line starts
+	uint16_t width = 0;
+	uint16_t lineWidth = 0;
+	uint8_t gaps = 0;	// spaces between words
+	uint8_t lineGaps = 0;
+	bool word = false;	// in a word
+	bool wrapped = false;
+
+	for (;;) {
+	    uint16_t ch = 0;
+	    uint8_t bytes = str[len] ? utf8Decode(&str[len], 4, &ch) : 0;
+
+	    if ((bytes == 0) || (ch == '\n')) {
+		if (word) {
+		    end = len;
+		    lineWidth = width;
+		    lineGaps = gaps;
+		}
+		next = len + bytes;
+		break;
+	    }
+	    if (ch == '\r') {
+		len += bytes;
+		continue;
+	    }
+	    if (ch == ' ') {
+		if (word) {
+		    // a place to break the line
+		    end = len;
+		    lineWidth = width;
+		    lineGaps = gaps++;
+		    word = false;
+		}
+		width += glyphWidth(ch);
+		len += bytes;
+		continue;
+	    }
+
+	    uint8_t advance = glyphWidth(ch);
+	    if ((len > 0) && (width + advance > box.width)) {
+		if (end == 0) {
+		    // no space to break at, break the word
+		    end = len;
+		    lineWidth = width;
+		    lineGaps = gaps;
+		}
+		next = end;
+		while (str[next] == ' ') {
+		    next++;
+		}
+		wrapped = true;
+		break;
+	    }
+	    width += advance;
+	    len += bytes;
+	    word = true;
+	}
 
-    if (colour == bg) {
-	bg = 0;
+	uint16_t extra = (box.width > lineWidth) ? box.width - lineWidth : 0;
+	int16_t x = box.x;
+
+	if ((align == OLED_ALIGN_JUSTIFY) && wrapped && (lineGaps > 0)) {
+	    // draw a word at a time, spreading the extra pixels over the gaps
+	    size_t pos = 0;
+	    for (uint8_t gap=0; pos < end; gap++) {
+		size_t seg = pos;
+		while ((seg < end) && (str[seg] == ' ')) {
+		    seg++;
+		}
+		while ((seg < end) && (str[seg] != ' ')) {
+		    seg++;
+		}
+		while ((seg < end) && (str[seg] == ' ')) {
+		    seg++;
+		}
+		x += drawString(x, y, &str[pos], seg - pos);
+		pos = seg;
+		if (pos < end) {
+		    uint16_t share = (uint32_t)extra * (gap+1) / lineGaps - (uint32_t)extra * gap / lineGaps;
+		    fillRect(x, y, share, _metrics.height, background);
+		    x += share;
+		}
+	    }
+	} else {
+	    if (align == OLED_ALIGN_CENTRE) {
+		x += extra / 2;
+	    } else if (align == OLED_ALIGN_RIGHT) {
+		x += extra;
+	    }
+	    drawString(x, y, str, end);
+	}
+
+	y += _metrics.height;
+	str += next;
+	if (y <= bottom) {
+	    shown = str - start;
+	}
+    }
+
+    _clip = clip;
+    return shown;
+}
+
+/**
+ * Find a character in the current 1bpp font, substituting the default
+ * glyph for characters the font does not have.
+ * @param code - character to find (unicode code point)
+ * @param glyph - set to the glyph data in flash, can be NULL
+ * @returns width of the glyph
+ */
+uint8_t oled256::monoGlyph(uint16_t code, const uint8_t **glyph)
+{
+    uint8_t glyph_width;
+    uint8_t ch = code;
+
+#ifdef OLED_FONT_SOURCE
+    if (_extFont != NULL) {
+	if (glyph == NULL) {
+	    return _extFont->advance(code);
+	}
+	*glyph = _extFont->glyph(code, &glyph_width);
+	return glyph_width;
     }
+#endif
 
     /* check to make sure the symbol is a legal one */
-    /* if not then just replace it with the default character */
-    if ((ch < pgm_read_byte(&fonts[_font].glyph_beg)) || (ch > pgm_read_byte(&fonts[_font].glyph_end)))
+    /* if not then look it up in the maps or use the default character */
+    if ((code < pgm_read_byte(&fonts[_font].glyph_beg)) || (code > pgm_read_byte(&fonts[_font].glyph_end)))
     {
 	uint8_t *map = (uint8_t *)pgm_read_word(&fonts[_font].map);
-	if (map != 0) {
-	    ch = pgm_read_byte(&map[(uint8_t)ch]);
+	if ((map != 0) && (code <= 0xFF)) {
+	    ch = pgm_read_byte(&map[code]);
 	} else {
 	    ch = pgm_read_byte(&fonts[_font].glyph_def);
 	}
+	ch = codepointGlyph((const codepoint_t *)pgm_read_word(&fonts[_font].cmap),
+			    pgm_read_byte(&fonts[_font].cmap_size), code, ch);
     }
 
     /* make zero based index into the font data arrays */
@@ -551,82 +1899,864 @@ uint8_t oled256::glyphDraw(uint16_t x, uint16_t y, char ch, uint16_t colour, uin
 	glyph_width = pgm_read_byte(&width_table[(uint8_t)ch]);	/* get the variable width instead */
     }
 
-    glyph_height = pgm_read_byte(&fonts[_font].glyph_height);
-    glyph_byte_width = pgm_read_byte(&fonts[_font].store_width);
+    if (glyph != NULL) {
+	uint8_t glyph_byte_width = _metrics.stride;
+	uint8_t glyph_height = _metrics.height;
+	*glyph = (const uint8_t *)pgm_read_word(&fonts[_font].glyph_table) + (uint8_t)ch * glyph_byte_width * glyph_height;
+    }
+
+    return glyph_width;
+}
+
+/**
+ * Expand one row of a 1bpp image into packed pixels, shifted to start
+ * xoff pixels into the first column group.
+ * @param out - groups*2 bytes of packed pixels
+ * @param data - image row, msb is the leftmost pixel
+ * @param stride - bytes in the image row (1-4)
+ * @param progmem - true if data is in flash
+ * @param xoff - pixel offset into the first column group (0-3)
+ * @param groups - column groups to expand
+ */
+void oled256::monoRow(uint8_t *out, const uint8_t *data, uint8_t stride, bool progmem,
+		      uint8_t xoff, uint8_t groups)
+{
+    uint32_t bits = 0;
+    uint16_t pixels;
+
+    for (uint8_t ind=0; (ind < stride) && (ind < 4); ind++) {
+	uint8_t data8 = progmem ? pgm_read_byte(&data[ind]) : data[ind];
+	bits |= (uint32_t)data8 << (24 - ind*8);
+    }
+
+    // the first group starts xoff pixels in
+    pixels = _expand[bits >> (28 + xoff)];
+    bits <<= 4 - xoff;
+    for (;;) {
+	*out++ = pixels >> 8;
+	*out++ = pixels;
+	if (--groups == 0) {
+	    break;
+	}
+	pixels = _expand[bits >> 28];
+	bits <<= 4;
+    }
+}
+
+/**
+ * Send one row of packed pixels within a stream, merging the first and
+ * last column groups with the pixels already there.
+ * @param y - display row
+ * @param first - first column group
+ * @param groups - column groups in the row
+ * @param lmask - nibbles of the first group to draw
+ * @param rmask - nibbles of the last group to draw
+ * @param row - groups*2 bytes of packed pixels
+ */
+void oled256::packedRow(uint8_t y, uint8_t first, uint8_t groups, uint16_t lmask, uint16_t rmask,
+			const uint8_t *row)
+{
+    uint16_t left = edgeMerge(y, first, (row[0] << 8) | row[1], lmask);
+    uint16_t right = left;
+
+    streamPixels(left);
+    if (groups > 1) {
+	row += 2;
+	streamData(row, (groups - 2) * 2);
+	row += (groups - 2) * 2;
+	right = edgeMerge(y, first+groups-1, (row[0] << 8) | row[1], rmask);
+	streamPixels(right);
+    }
+    edgeSave(y, first, left, first+groups-1, right);
+}
+
+/**
+ * Draw a 1bpp image of up to 32 pixels wide at x,y.
+ * Pixels in the column groups shared with neighbouring drawing are kept.
+ * @param x - left pixel column
+ * @param y - top pixel row
+ * @param width - image width in pixels (1-32)
+ * @param height - image height in pixels
+ * @param data - image rows, msb is the leftmost pixel
+ * @param stride - bytes per image row
+ * @param progmem - true if data is in flash
+ * @param colour - colour of set pixels
+ * @param bg - colour of clear pixels
+ */
+void oled256::monoDraw(int16_t x, int16_t y, uint8_t width, uint8_t height, const uint8_t *data,
+		       uint8_t stride, bool progmem, uint8_t colour, uint8_t bg)
+{
+    part_t part;
+    uint8_t xoff = x & 0x3;
+    uint8_t row[18];		// 32 pixels offset by up to 3
+
+    if (!clipPart(x, y, width, height, &part)) {
+	return;
+    }
+
+    expandColours(colour & 0x0F, bg & 0x0F);
 
-    glyph = (uint8_t *)pgm_read_word(&fonts[_font].glyph_table) + ch * glyph_byte_width * glyph_height;
+    setWindow(part.x, part.y, part.xend, part.y+part.rows-1);
+    beginStream();
 
-    setWindow(x, y, x+glyph_width-1, y+glyph_height-1);
-    writeCommand(CMD_WRITE_RAM);
+    data += (uint16_t)part.skipRows * stride;
+    for (uint8_t yind=0; yind<part.rows; yind++) {
+	monoRow(row, data, stride, progmem, xoff, part.skip + part.groups);
+	packedRow(part.y+yind, part.first, part.groups, part.lmask, part.rmask, &row[part.skip * 2]);
+	data += stride;
+    }
+    endStream();
+}
 
-    // load pixel data
-    for (uint16_t yind=0; yind<glyph_height; yind++) {
-	ind = (uint8_t)(yind*glyph_byte_width);
-	switch (glyph_byte_width) {
-	    case 1:
-		bits = (uint32_t)pgm_read_byte(&glyph[ind]) << 24;
-		break;
-	    case 2:
-		bits = (uint32_t)pgm_read_byte(&glyph[ind]) << 24 | (uint32_t)pgm_read_byte(&glyph[ind+1]) << 16;
-		break;
-	    case 3:
-		bits = (uint32_t)pgm_read_byte(&glyph[ind]) << 24 | (uint32_t)pgm_read_byte(&glyph[ind+1]) << 16 | (uint32_t)pgm_read_byte(&glyph[ind+2]) << 8;
-		break;
-	    case 4:
-		bits = (uint32_t)pgm_read_byte(&glyph[ind]) << 24 | (uint32_t)pgm_read_byte(&glyph[ind+1]) << 16 | (uint32_t)pgm_read_byte(&glyph[ind+2]) << 8 | (uint32_t)pgm_read_byte(&glyph[ind+3]);
+/**
+ * Draw an image that is already packed for the display at x,y.
+ * Pixels in the column groups shared with neighbouring drawing are kept.
+ * @param x - left pixel column
+ * @param y - top pixel row
+ * @param width - image width in pixels
+ * @param height - image height in pixels
+ * @param data - rows of packed pixels, shifted to start x&3 pixels into
+ *        the first column group, one byte per two pixels and two bytes
+ *        per column group
+ * @param aligned - true if the rows start at the first pixel of a column
+ *        group instead, they are shifted to x as they are sent. Images up
+ *        to OLED_LCD_GLYPH_WIDTH pixels wide can be shifted.
+ */
+void oled256::packedDraw(int16_t x, int16_t y, uint8_t width, uint8_t height, const uint8_t *data,
+			 bool aligned)
+{
+    part_t part;
+    uint8_t xoff = x & 0x3;
+    uint8_t groups = ((aligned ? 0 : xoff) + width + 3) / 4;
+    uint8_t row[(OLED_LCD_GLYPH_WIDTH + 6) / 4 * 2];
+
+    if (aligned && xoff && (width > OLED_LCD_GLYPH_WIDTH)) {
+	return;
+    }
+    if (!clipPart(x, y, width, height, &part)) {
+	return;
+    }
+
+    setWindow(part.x, part.y, part.xend, part.y+part.rows-1);
+    beginStream();
+
+    if (!aligned || !xoff) {
+	data += ((uint16_t)part.skipRows * groups + part.skip) * 2;
+	for (uint8_t yind=0; yind<part.rows; yind++) {
+	    packedRow(part.y+yind, part.first, part.groups, part.lmask, part.rmask, data);
+	    data += groups * 2;
+	}
+	endStream();
+	return;
+    }
+
+    // shift each row by xoff nibbles
+    uint8_t lead = xoff / 2;
+    uint8_t len = (xoff + width + 3) / 4 * 2;
+    data += (uint16_t)part.skipRows * groups * 2;
+    for (uint8_t yind=0; yind<part.rows; yind++) {
+	uint8_t prev = 0;
+	for (uint8_t ind=0; ind<len; ind++) {
+	    uint8_t next = ((ind >= lead) && (ind - lead < groups * 2)) ? data[ind - lead] : 0;
+	    row[ind] = (xoff & 1) ? ((prev << 4) | (next >> 4)) : next;
+	    prev = next;
+	}
+	packedRow(part.y+yind, part.first, part.groups, part.lmask, part.rmask, &row[part.skip * 2]);
+	data += groups * 2;
+    }
+    endStream();
+}
+
+#ifdef OLED_GLYPH_CACHE
+/**
+ * Look up a glyph in the glyph cache, expanding it into the least
+ * recently used slot if it is not there.
+ * @param ch - character in the current font
+ * @param xoff - pixel offset into the first column group (0-3)
+ * @param glyph - 1bpp glyph data in flash
+ * @param width - glyph width in pixels
+ * @param height - glyph height in pixels
+ * @param stride - bytes per glyph row
+ * @param colour - colour of set pixels
+ * @param bg - colour of clear pixels
+ * @returns packed glyph rows, or NULL if the glyph is too big to cache
+ */
+const uint8_t *oled256::glyphCache(uint16_t ch, uint8_t xoff, const uint8_t *glyph, uint8_t width,
+				   uint8_t height, uint8_t stride, uint8_t colour, uint8_t bg)
+{
+    uint8_t groups = (xoff+width+3)/4;
+    uint8_t colours = (colour << 4) | bg;
+    uint8_t slot = 0;
+
+    for (uint8_t ind=0; ind<OLED_GLYPH_CACHE_SLOTS; ind++) {
+	if ((_glyphCache[ind].height != 0) && (_glyphCache[ind].ch == ch) &&
+	    (_glyphCache[ind].font == _font) && (_glyphCache[ind].colours == colours) &&
+	    (_glyphCache[ind].xoff == xoff)) {
+	    _glyphCache[ind].used = ++_glyphClock;
+	    _glyphHits++;
+	    return _glyphCache[ind].data;
+	}
+	if ((_glyphCache[slot].height != 0) && ((_glyphCache[ind].height == 0) ||
+	    ((uint16_t)(_glyphClock - _glyphCache[ind].used) > (uint16_t)(_glyphClock - _glyphCache[slot].used)))) {
+	    slot = ind;
+	}
+    }
+
+    _glyphMisses++;
+    if ((uint16_t)groups * height * 2 > OLED_GLYPH_CACHE_BYTES) {
+	return NULL;
+    }
+
+    // replace the least recently used glyph
+    uint8_t *out = _glyphCache[slot].data;
+    _glyphCache[slot].font = _font;
+    _glyphCache[slot].ch = ch;
+    _glyphCache[slot].colours = colours;
+    _glyphCache[slot].xoff = xoff;
+    _glyphCache[slot].height = height;
+    _glyphCache[slot].used = ++_glyphClock;
+
+    expandColours(colour, bg);
+    for (uint8_t yind=0; yind<height; yind++) {
+	monoRow(out, glyph, stride, true, xoff, groups);
+	out += groups * 2;
+	glyph += stride;
+    }
+    return _glyphCache[slot].data;
+}
+
+/**
+ * Empty the glyph cache and reset its counters.
+ */
+void oled256::clearGlyphCache(void)
+{
+    for (uint8_t ind=0; ind<OLED_GLYPH_CACHE_SLOTS; ind++) {
+	_glyphCache[ind].height = 0;
+	_glyphCache[ind].used = 0;
+    }
+    _glyphClock = 0;
+    _glyphHits = 0;
+    _glyphMisses = 0;
+}
+
+/**
+ * Get the number of glyphs drawn straight from the glyph cache.
+ * @returns cache hits since the last clearGlyphCache()
+ */
+uint32_t oled256::getGlyphCacheHits(void)
+{
+    return _glyphHits;
+}
+
+/**
+ * Get the number of glyphs that had to be expanded from the font.
+ * @returns cache misses since the last clearGlyphCache()
+ */
+uint32_t oled256::getGlyphCacheMisses(void)
+{
+    return _glyphMisses;
+}
+#endif
+
+#ifdef OLED_HOT_GLYPHS
+/**
+ * Pre-shift glyphs that are drawn often, such as the digits of a clock.
+ * Each glyph is expanded into buf four times, once for each pixel
+ * offset into a column group, so drawing it at any x is a straight copy
+ * to the display. The copies are for the current font and colours and
+ * are only used while those are selected. Call again after changing
+ * them, or with an empty string to stop using the buffer.
+ * @param chars - UTF-8 characters to pre-shift, at most OLED_HOT_MAX
+ * @param buf - buffer for the pre-shifted glyphs
+ * @param size - size of buf in bytes
+ * @returns number of characters that fitted in buf
+ */
+uint8_t oled256::setHotGlyphs(const char *chars, uint8_t *buf, uint16_t size)
+{
+    uint16_t used = 0;
+
+    _hot.buf = buf;
+    _hot.count = 0;
+    _hot.font = _font;
+    _hot.fontHQ = _fontHQ;
+#ifdef OLED_FONT_SOURCE
+    _hot.extFont = _extFont;
+#endif
+    _hot.colours = (foreground << 4) | ((foreground == background) ? 0 : background);
+    expandColours(foreground, _hot.colours & 0x0F);
+
+    while (*chars && (_hot.count < OLED_HOT_MAX)) {
+	const uint8_t *glyph;
+	uint8_t width;
+	uint8_t height;
+	uint8_t stride;
+	uint16_t ch;
+
+	chars += utf8Decode(chars, 4, &ch);
+	if (_fontHQ == NULL) {
+	    width = monoGlyph(ch, &glyph);
+	    height = _metrics.height;
+	    stride = _metrics.stride;
+	} else {
+	    uint8_t gind = hqIndex(ch);
+	    glyph = (const uint8_t *)pgm_read_word(&_fontHQ->glyphs[gind].glyph);
+	    if (glyph == NULL) {
+		width = (uint8_t)pgm_read_byte(&(_fontHQ->glyphs[gind].width));
+		height = _fontHQ->height;
+	    } else {
+		width = (uint8_t)pgm_read_byte(&(_fontHQ->glyphs[gind].xrect));
+		height = (uint8_t)pgm_read_byte(&(_fontHQ->glyphs[gind].yrect));
+	    }
+	    stride = _fontHQ->packed ? (width + 1) / 2 : width;
+	}
+
+	uint16_t need = 0;
+	for (uint8_t xoff=0; xoff<4; xoff++) {
+	    need += (uint16_t)height * ((xoff + width + 3) / 4) * 2;
+	}
+	if ((width == 0) || (used + need > size)) {
+	    break;
+	}
+
+	_hot.glyph[_hot.count].ch = ch;
+	_hot.glyph[_hot.count].width = width;
+	_hot.glyph[_hot.count].height = height;
+	_hot.glyph[_hot.count].offset = used;
+	_hot.count++;
+
+	for (uint8_t xoff=0; xoff<4; xoff++) {
+	    uint8_t groups = (xoff + width + 3) / 4;
+	    const uint8_t *row = glyph;
+	    for (uint8_t yind=0; yind<height; yind++) {
+		if (_fontHQ == NULL) {
+		    monoRow(&buf[used], row, stride, _metrics.progmem, xoff, groups);
+		} else {
+		    hqRow(&buf[used], row, width, xoff, groups);
+		}
+		used += groups * 2;
+		if (row != NULL) {
+		    row += stride;
+		}
+	    }
+	}
+    }
+
+    return _hot.count;
+}
+
+/**
+ * Find the pre-shifted copy of a glyph made by setHotGlyphs().
+ * @param ch - character
+ * @param xoff - pixel offset into the first column group (0-3)
+ * @param colour - foreground colour it will be drawn in
+ * @param bg - background colour it will be drawn in
+ * @param width - set to the glyph width, can be NULL
+ * @param height - set to the glyph height, can be NULL
+ * @returns packed glyph rows, or NULL if ch is not hot in this font and colours
+ */
+const uint8_t *oled256::hotGlyph(uint16_t ch, uint8_t xoff, uint8_t colour, uint8_t bg,
+				 uint8_t *width, uint8_t *height)
+{
+    if ((_hot.count == 0) || (_hot.font != _font) || (_hot.fontHQ != _fontHQ) ||
+	(_hot.colours != ((colour << 4) | bg))) {
+	return NULL;
+    }
+#ifdef OLED_FONT_SOURCE
+    if (_hot.extFont != _extFont) {
+	return NULL;
+    }
+#endif
+
+    for (uint8_t ind=0; ind<_hot.count; ind++) {
+	if (_hot.glyph[ind].ch == ch) {
+	    uint16_t offset = _hot.glyph[ind].offset;
+	    for (uint8_t shift=0; shift<xoff; shift++) {
+		offset += (uint16_t)_hot.glyph[ind].height * ((shift + _hot.glyph[ind].width + 3) / 4) * 2;
+	    }
+	    if (width != NULL) {
+		*width = _hot.glyph[ind].width;
+	    }
+	    if (height != NULL) {
+		*height = _hot.glyph[ind].height;
+	    }
+	    return &_hot.buf[offset];
+	}
+    }
+    return NULL;
+}
+#endif
+
+/**
+ * Draw a character glyph on the screen at x,y.
+ * @param x - x position to start glyph (x=0 for left, x=256-glyphWidth() for right)
+ * @param y - y position to start glyph (y=0 for top, y=64-glyphHeight() for bottom)
+ * @param ch - the character to draw (unicode code point)
+ * @param colour - foreground colour
+ * @param bg - background colour
+ * @returns width of the glyph
+ */
+uint8_t oled256::glyphDraw(int16_t x, int16_t y, uint16_t ch, uint16_t colour, uint16_t bg)
+{
+    if (_fontHQ != NULL) {
+	return glyphDrawHQ(x,y,ch,colour,bg);
+    }
+
+    const uint8_t *glyph;
+    uint16_t glyph_width;
+    uint16_t glyph_height;
+    uint16_t glyph_byte_width;
+
+    if (colour == bg) {
+	bg = 0;
+    }
+
+#ifdef OLED_HOT_GLYPHS
+    uint8_t hot_width;
+    uint8_t hot_height;
+    const uint8_t *hot = hotGlyph(ch, x & 0x3, colour & 0x0F, bg & 0x0F, &hot_width, &hot_height);
+    if (hot != NULL) {
+	packedDraw(x, y, hot_width, hot_height, hot);
+	return hot_width;
+    }
+#endif
+
+    glyph_width = monoGlyph(ch, &glyph);
+    glyph_height = _metrics.height;
+    glyph_byte_width = _metrics.stride;
+
+#ifdef OLED_GLYPH_CACHE
+    // glyphs from external storage are cached by their oledFont
+    if (_metrics.progmem) {
+	const uint8_t *packed = glyphCache(ch, x & 0x3, glyph, glyph_width, glyph_height, glyph_byte_width,
+					   colour & 0x0F, bg & 0x0F);
+	if (packed != NULL) {
+	    packedDraw(x, y, glyph_width, glyph_height, packed);
+	    return (uint8_t)glyph_width;
+	}
+    }
+#endif
+    monoDraw(x, y, glyph_width, glyph_height, glyph, glyph_byte_width, _metrics.progmem, colour, bg);
+
+    return (uint8_t)glyph_width;
+}
+
+/**
+ * Draw a run of characters on one line at x,y.
+ * With a 1bpp font the whole run is sent as one window, a scanline at a
+ * time across every glyph, so the pixels neighbouring glyphs share are
+ * put together as they are sent. The run stops at a control character,
+ * at a byte that is not ascii, at a glyph that would end past right or
+ * start past the clip rectangle, or after OLED_RUN_MAX glyphs. Glyphs
+ * left of the clip rectangle are passed over without being sent.
+ * @param x - x position to start the run, advanced past the glyphs drawn
+ * @param y - y position of the top of the run
+ * @param str - characters to draw
+ * @param len - number of characters available
+ * @param right - glyphs must end before this column, e.g. OLED_WIDTH to
+ *        leave glyphs that don't fit on the line for wrapping
+ * @param colour - foreground colour
+ * @param bg - background colour
+ * @returns number of characters drawn
+ */
+uint8_t oled256::textRun(int16_t *x, int16_t y, const char *str, uint8_t len, int16_t right,
+			 uint8_t colour, uint8_t bg)
+{
+    const uint8_t *glyph[OLED_RUN_MAX];
+    uint8_t width[OLED_RUN_MAX];
+    uint8_t count = 0;		// characters used
+    uint8_t sent = 0;		// glyphs in the window
+    uint16_t total = 0;
+
+    if (_fontHQ != NULL) {
+	// HQ glyphs have their own offsets and heights, draw them one at a time
+	while ((count < len) && ((uint8_t)str[count] >= ' ') && ((uint8_t)str[count] < 0x80) &&
+	       (*x + glyphWidth(str[count]) <= right) && (*x <= _clip.x1)) {
+	    *x += glyphDrawHQ(*x, y, str[count], colour, bg);
+	    count++;
+	}
+	return count;
+    }
+
+    uint8_t limit = (len < OLED_RUN_MAX) ? len : OLED_RUN_MAX;
+#ifdef OLED_FONT_SOURCE
+    if (_extFont != NULL) {
+	// read the run's glyphs together, and only as many as stay cached
+	limit = _extFont->prefetch(str, limit);
+    }
+#endif
+
+    // measure the run
+    while ((count < limit) && ((uint8_t)str[count] >= ' ') &&
+	   ((uint8_t)str[count] < 0x80)) {
+	uint8_t glyph_width = monoGlyph(str[count], &glyph[sent]);
+	if ((*x + total + glyph_width > right) || (*x + total > _clip.x1)) {
+	    break;
+	}
+	count++;
+	if ((sent == 0) && (*x + glyph_width <= _clip.x0)) {
+	    // not visible
+	    *x += glyph_width;
+	    continue;
+	}
+	width[sent++] = glyph_width;
+	total += glyph_width;
+    }
+
+    part_t part;
+    if ((total == 0) || !clipPart(*x, y, total, _metrics.height, &part)) {
+	*x += total;
+	return count;
+    }
+
+    if (colour == bg) {
+	bg = 0;
+    }
+    expandColours(colour & 0x0F, bg & 0x0F);
+
+    uint8_t stride = _metrics.stride;
+    bool progmem = _metrics.progmem;
+    uint8_t xoff = *x & 0x3;
+    uint8_t groups = part.skip + part.groups;	// groups built, the first part.skip aren't sent
+    uint16_t offset = (uint16_t)part.skipRows * stride;	// of the glyph row being sent
+
+    setWindow(part.x, part.y, part.xend, part.y+part.rows-1);
+    beginStream();
+
+    for (uint8_t yind=0; yind<part.rows; yind++) {
+	uint32_t bits = 0;	// pixels waiting to be sent, msb first
+	uint8_t nbits = xoff;	// the first group starts xoff pixels in
+	uint8_t ind = 0;	// glyph being read
+	uint8_t byte = 0;	// byte of the glyph row being read
+	uint8_t left = width[0];	// pixels of the glyph row still to read
+	uint16_t leftPixels = 0;
+	uint16_t pixels = 0;
+
+	for (uint8_t xind=0; xind<groups; xind++) {
+	    while (nbits < 4) {
+		if (ind == sent) {
+		    // pad the last group
+		    nbits = 4;
+		    break;
+		}
+		uint8_t take = (left < 8) ? left : 8;
+		const uint8_t *data = &glyph[ind][offset + byte];
+		uint8_t data8 = progmem ? pgm_read_byte(data) : *data;
+		data8 &= (uint8_t)(0xFF << (8 - take));
+		byte++;
+		bits |= (uint32_t)data8 << (24 - nbits);
+		nbits += take;
+		left -= take;
+		if (left == 0) {
+		    // next glyph
+		    if (++ind < sent) {
+			left = width[ind];
+		    }
+		    byte = 0;
+		}
+	    }
+
+	    pixels = _expand[bits >> 28];
+	    bits <<= 4;
+	    nbits -= 4;
+	    if (xind < part.skip) {
+		continue;
+	    }
+	    if (xind == part.skip) {
+		pixels = edgeMerge(part.y+yind, part.first, pixels, part.lmask);
+		leftPixels = pixels;
+	    } else if (xind == groups-1) {
+		pixels = edgeMerge(part.y+yind, part.first+part.groups-1, pixels, part.rmask);
+	    }
+	    streamPixels(pixels);
+	}
+	edgeSave(part.y+yind, part.first, leftPixels, part.first+part.groups-1, pixels);
+	offset += stride;
+    }
+    endStream();
+
+    *x += total;
+    return count;
+}
+
+/**
+ * Draw a UTF-8 string at x,y in the current colours without moving the
+ * cursor. Runs of ascii characters are drawn by textRun(). Control
+ * characters are skipped and the string is not wrapped. Glyphs are cut
+ * to the clip rectangle, and the string stops at its right edge.
+ * @param x - x position to start the string, can be negative
+ * @param y - y position of the top of the string, can be negative
+ * @param str - string to draw
+ * @returns width of the string drawn
+ */
+uint16_t oled256::drawString(int16_t x, int16_t y, const char *str)
+{
+    return drawString(x, y, str, strlen(str));
+}
+
+/**
+ * Draw the first len bytes of a UTF-8 string at x,y.
+ * @param x - x position to start the string, can be negative
+ * @param y - y position of the top of the string, can be negative
+ * @param str - string to draw
+ * @param len - number of bytes to draw
+ * @returns width of the string drawn
+ */
+uint16_t oled256::drawString(int16_t x, int16_t y, const char *str, size_t len)
+{
+    int16_t start = x;
+
+    while (len > 0) {
+	uint8_t count = textRun(&x, y, str, (len > 255) ? 255 : len, INT16_MAX, foreground, background);
+	if (count == 0) {
+	    uint16_t ch;
+	    count = utf8Decode(str, len, &ch);
+	    if (count == 0) {
+		// sequence cut short by len
+		ch = 0xFFFD;
+		count = len;
+	    }
+	    if (ch >= 0x80) {
+		if (x > _clip.x1) {
+		    break;
+		}
+		x += glyphDraw(x, y, ch, foreground, background);
+	    } else if (ch >= ' ') {
+		// past the right of the clip rectangle
 		break;
+	    }
+	}
+	str += count;
+	len -= count;
+    }
+
+    return x - start;
+}
+
+/**
+ * Draw the first len bytes of a UTF-8 string at x,y in the current
+ * colours, with each glyph filling its whole cell, its advance by the
+ * font height. Text drawn this way replaces whatever was there without
+ * clearing it first. 1bpp glyphs always fill their cells, so this is
+ * drawString(). HQ glyphs are otherwise drawn as just the rectangle
+ * around their ink; here up to OLED_HQ_RUN_MAX of them are sent as one
+ * window, with any ink above or below the cell cut off.
+ * @param x - x position to start the string, can be negative
+ * @param y - y position of the top of the string, can be negative
+ * @param str - string to draw
+ * @param len - number of bytes to draw
+ * @returns width of the string drawn
+ */
+uint16_t oled256::drawStringCells(int16_t x, int16_t y, const char *str, size_t len)
+{
+    int16_t start = x;
+
+    if (_fontHQ == NULL) {
+	return drawString(x, y, str, len);
+    }
+    while ((len > 0) && (x <= _clip.x1)) {
+	size_t count = hqRun(&x, y, str, len);
+	str += count;
+	len -= count;
+    }
+    return x - start;
+}
+
+/**
+ * Draw a run of HQ glyphs with their cells, for drawStringCells(). The
+ * run is sent as one window a scanline at a time, each pixel blended
+ * from the ink of the glyph whose cell it is in, or of the next glyph
+ * where that starts left of its cell. Control characters are skipped.
+ * The run stops at a glyph that starts past the clip rectangle, or
+ * after OLED_HQ_RUN_MAX glyphs.
+ * @param x - x position to start the run, advanced past the glyphs drawn
+ * @param y - y position of the top of the run
+ * @param str - characters to draw
+ * @param len - number of bytes available
+ * @returns number of bytes drawn
+ */
+size_t oled256::hqRun(int16_t *x, int16_t y, const char *str, size_t len)
+{
+    struct {
+	const uint8_t *data;	// ink rows, NULL for a blank glyph
+	int16_t x;		// ink rectangle, from the start of the run
+	int8_t y;
+	uint8_t width;
+	uint8_t height;
+	uint16_t end;		// where the cell ends, from the start of the run
+    } glyph[OLED_HQ_RUN_MAX];
+    uint8_t count = 0;
+    uint16_t total = 0;
+    size_t used = 0;
+
+    while ((used < len) && (count < OLED_HQ_RUN_MAX) && (*x + total <= _clip.x1)) {
+	uint16_t ch;
+	uint8_t bytes = utf8Decode(&str[used], len - used, &ch);
+	if (bytes == 0) {
+	    // sequence cut short by len
+	    ch = 0xFFFD;
+	    bytes = len - used;
+	}
+	used += bytes;
+	if (ch < ' ') {
+	    continue;
+	}
+
+	const glyph_t *hq = &_fontHQ->glyphs[hqIndex(ch)];
+	uint8_t advance = glyphWidth(ch);
+	if ((count == 0) && (*x + advance <= _clip.x0)) {
+	    // not visible
+	    *x += advance;
+	    continue;
+	}
+	glyph[count].data = (const uint8_t *)pgm_read_word(&hq->glyph);
+	glyph[count].x = total + (int8_t)pgm_read_byte(&hq->xoffset);
+	glyph[count].y = (int8_t)pgm_read_byte(&hq->yoffset);
+	glyph[count].width = pgm_read_byte(&hq->xrect);
+	glyph[count].height = pgm_read_byte(&hq->yrect);
+	total += advance;
+	glyph[count++].end = total;
+    }
+
+    part_t part;
+    if ((total == 0) || !clipPart(*x, y, total, _metrics.height, &part)) {
+	*x += total;
+	return used;
+    }
+
+    uint8_t colour = foreground & 0x0F;
+    uint8_t bg = background & 0x0F;
+    if (colour == bg) {
+	bg = 0;
+    }
+    expandColours(colour, bg);
+
+    uint8_t xoff = *x & 0x3;
+    bool packed = _fontHQ->packed;
+
+    setWindow(part.x, part.y, part.xend, part.y+part.rows-1);
+    beginStream();
+
+    for (uint8_t yind=0; yind<part.rows; yind++) {
+	int16_t row = part.skipRows + yind;	// of the cell
+	uint8_t ind = 0;			// glyph whose cell the pixel is in
+	uint16_t leftPixels = 0;
+	uint16_t pixels = 0;
+
+	for (uint8_t xind=part.skip; xind<part.skip+part.groups; xind++) {
+	    pixels = 0;
+	    for (uint8_t nibble=0; nibble<4; nibble++) {
+		int16_t pix = xind*4 + nibble - xoff;
+		uint8_t alpha = 0;
+		if ((pix >= 0) && (pix < (int16_t)total)) {
+		    while (pix >= (int16_t)glyph[ind].end) {
+			ind++;
+		    }
+		    for (uint8_t gind=ind; (gind < count) && (gind <= ind+1); gind++) {
+			int16_t gx = pix - glyph[gind].x;
+			int16_t gy = row - glyph[gind].y;
+			if ((glyph[gind].data == NULL) || (gx < 0) || (gx >= glyph[gind].width) ||
+			    (gy < 0) || (gy >= glyph[gind].height)) {
+			    continue;
+			}
+			uint8_t ink;
+			if (packed) {
+			    ink = pgm_read_byte(&glyph[gind].data[gy * ((glyph[gind].width + 1) / 2) + gx / 2]);
+			    ink = (gx & 1) ? (ink & 0x0F) : (ink >> 4);
+			} else {
+			    ink = pgm_read_byte(&glyph[gind].data[gy * glyph[gind].width + gx]) & 0x0F;
+			}
+			if (ink > alpha) {
+			    alpha = ink;
+			}
+		    }
+		}
+		pixels = (pixels << 4) | _blend[alpha];
+	    }
+	    if (xind == part.skip) {
+		pixels = edgeMerge(part.y+yind, part.first, pixels, part.lmask);
+		leftPixels = pixels;
+	    } else if (xind == part.skip+part.groups-1) {
+		pixels = edgeMerge(part.y+yind, part.first+part.groups-1, pixels, part.rmask);
+	    }
+	    streamPixels(pixels);
 	}
+	edgeSave(part.y+yind, part.first, leftPixels, part.first+part.groups-1, pixels);
+    }
+    endStream();
 
-	uint16_t pixels;
+    *x += total;
+    return used;
+}
 
-	// check for shared pixel data to the left
-	if ((x/4) == gddram[yind].xaddr) {
-	    // overlap
-	    pixels = gddram[yind].pixels;	// 4 pixels
+/**
+ * Blend one row of an HQ glyph into packed pixels, shifted to start
+ * xoff pixels into the first column group.
+ * Packed glyphs starting on an even pixel line up with the display
+ * bytes and are copied a byte at a time, or straight from flash when
+ * drawing white on black.
+ * @param out - groups*2 bytes of packed pixels
+ * @param glyph - glyph row in flash, NULL for a blank row
+ * @param width - glyph width in pixels
+ * @param xoff - pixel offset into the first column group (0-3)
+ * @param groups - column groups to fill
+ */
+void oled256::hqRow(uint8_t *out, const uint8_t *glyph, uint8_t width, uint8_t xoff, uint8_t groups)
+{
+    uint8_t bgByte = _blend[0] * 0x11;
+    uint8_t len = groups * 2;
+    uint8_t ind = 0;
+
+    if ((glyph != NULL) && _fontHQ->packed && !(xoff & 1)) {
+	uint8_t bytes = (width + 1) / 2;
+	if (xoff) {
+	    out[ind++] = bgByte;
+	}
+	if (_blendCopy) {
+	    memcpy_P(&out[ind], glyph, bytes);
+	    ind += bytes;
 	} else {
-	    pixels = 0;
+	    for (uint8_t pind=0; pind<bytes; pind++) {
+		uint8_t data = pgm_read_byte(&glyph[pind]);
+		out[ind++] = (_blend[data >> 4] << 4) | _blend[data & 0x0F];
+	    }
 	}
+	while (ind < len) {
+	    out[ind++] = bgByte;
+	}
+	return;
+    }
 
-	// Merge with existing pixel data
-	uint8_t xoff = x - (x/4)*4;
-
-	// build pixels
-	for (pix=0; pix<glyph_width+xoff; pix+=4) {
-	    for (uint8_t pind=0; pind<4; pind++) {
-		if ((pind+pix) >= xoff) {
-		    pixels &= ~(0x000F << ((3-pind)*4));
-
-		    if ((pind+pix) < (glyph_width+xoff)) {
-			pixels |= ((bits & 0x80000000L) ? colour : bg) << ((3-pind)*4);
-			bits <<= 1;
-		    }
+    for (; ind<len; ind++) {
+	uint8_t data = 0;
+	for (uint8_t nibble=0; nibble<2; nibble++) {
+	    int16_t pix = ind*2 + nibble - xoff;
+	    uint8_t alpha = 0;
+	    if ((glyph != NULL) && (pix >= 0) && (pix < width)) {
+		if (_fontHQ->packed) {
+		    alpha = pgm_read_byte(&glyph[pix / 2]);
+		    alpha = (pix & 1) ? (alpha & 0x0F) : (alpha >> 4);
+		} else {
+		    alpha = pgm_read_byte(&glyph[pix]) & 0x0F;
 		}
 	    }
-	    writeData((uint8_t)(pixels >> 8));
-	    writeData((uint8_t)pixels);
+	    data = (data << 4) | _blend[alpha];
 	}
-	gddram[yind].pixels = pixels;
-	gddram[yind].xaddr = (x+glyph_width) / 4;
+	out[ind] = data;
     }
-
-    return (uint8_t)glyph_width;
 }
 
 /**
- * Draw a character glyph on the screen at x,y.
+ * Draw a character glyph on the screen at x,y. A glyph partly outside
+ * the clip rectangle is cut to it.
  * @param x - x position to start glyph (x=0 for left, x=256-glyphWidth() for right)
  * @param y - y position to start glyph (y=0 for top, y=64-glyphHeight() for bottom)
- * @param ch - the character to draw
+ * @param ch - the character to draw (unicode code point)
  * @param colour - foreground colour
  * @param bg - background colour
  * @returns width of the glyph
- * @note currently only works with fixed width glyphs due to display buffer used
- *       to determine the adjacent glyph when updating a shared cell (two pixels per byte)
  */
-uint8_t oled256::glyphDrawHQ(int16_t x, int16_t y, char ch, uint16_t colour, uint16_t bg)
+uint8_t oled256::glyphDrawHQ(int16_t x, int16_t y, uint16_t ch, uint16_t colour, uint16_t bg)
 {
-    uint8_t pix;
-    int ind;
     const uint8_t *glyph;
     uint8_t glyph_width;
     uint8_t glyph_height;
@@ -646,18 +2776,12 @@ uint8_t oled256::glyphDrawHQ(int16_t x, int16_t y, char ch, uint16_t colour, uin
     debug = true;
 #endif
 
-    // get glyph index
-    if (ch >= ' ' && ch <= 0x7f) {
-	gind = pgm_read_byte(&_fontHQ->map[ch - ' ']);
-    } else {
-	// default to a space
-	gind = 0;
-    }
+    gind = hqIndex(ch);
 
     glyph = (const uint8_t *)pgm_read_word(&_fontHQ->glyphs[gind].glyph);
 
     if (glyph == NULL) {
-	// space character, just fill in the gddram buffer and output background pixels
+	// space character, just output background pixels
 	glyph_width = (uint8_t)pgm_read_byte(&(_fontHQ->glyphs[gind].width));
 	glyph_height = _fontHQ->height;
 	glyph_offset = 0;
@@ -667,15 +2791,26 @@ uint8_t oled256::glyphDrawHQ(int16_t x, int16_t y, char ch, uint16_t colour, uin
 	glyph_offset = (int8_t)pgm_read_byte(&(_fontHQ->glyphs[gind].xoffset));
 	x += glyph_offset;
 	y += (int8_t) pgm_read_byte(&(_fontHQ->glyphs[gind].yoffset));
-	if (x < 0) x = 0;
-	if (y < 0) y = 0;
+    }
+
+    part_t part;
+    if (!clipPart(x, y, glyph_width, glyph_height, &part)) {
+	return (uint8_t)(glyph_width + glyph_offset) + 1;
     }
 
     uint8_t xoff = x & 0x3;
 
+#ifdef OLED_HOT_GLYPHS
+    const uint8_t *hot = hotGlyph(ch, xoff, colour & 0x0F, bg & 0x0F);
+    if (hot != NULL) {
+	packedDraw(x, y, glyph_width, glyph_height, hot);
+	return (uint8_t)(glyph_width + glyph_offset) + 1;
+    }
+#endif
+
 #ifdef DEBUG
     Serial.print(F("glyph '"));
-    Serial.print(ch);
+    Serial.print((char)ch);
     Serial.print(F("' "));
     Serial.print(gind,HEX);
     Serial.print(F(" height ")); Serial.print(glyph_height);
@@ -683,110 +2818,60 @@ uint8_t oled256::glyphDrawHQ(int16_t x, int16_t y, char ch, uint16_t colour, uin
     Serial.print(F(", xoff ")); Serial.println(xoff);
 #endif
 
-    byteWidth = (x+glyph_width-1)/4 - (x/4) + 1;
-#ifdef DEBUG
-    Serial.print(F("window (x,y,xend,yend) = ")); 
-    Serial.print(x);
-    Serial.print(',');
-    Serial.print(y);
-    Serial.print(',');
-    Serial.print(x+glyph_width-1);
-    Serial.print(',');
-    Serial.print(y+glyph_height-1);
-    Serial.print(F(", byteWidth = ")); 
-    Serial.println(byteWidth);
-#endif
-
-    setWindow(x, y, x+glyph_width-1, y+glyph_height-1);
-
-    writeCommand(CMD_WRITE_RAM);
-
-    // build pixel gddramdata
-    for (uint16_t yind=0; yind<glyph_height; yind++) {
-	ind = (uint8_t)(yind*glyph_width);
-	uint16_t pixels;
-	// check for shared pixel data to the left
-	if ((x/4) == gddram[y+yind].xaddr) {
-	    // overlap
-#ifdef DEBUG
-	    Serial.print(F("gddram.pixels = 0x"));
-	    Serial.println(gddram[y+yind].pixels,HEX);
-#endif
-	    pixels = gddram[y+yind].pixels >> ((3-xoff)*4);	// 4 pixels
-	} else {
-	    pixels = 0;
+    // glyph intensities are alpha between bg and colour
+    expandColours(colour & 0x0F, bg & 0x0F);
+
+    uint8_t stride = _fontHQ->packed ? (glyph_width + 1) / 2 : glyph_width;
+    uint8_t row[(OLED_HQ_WIDTH_MAX + 6) / 4 * 2];	// OLED_HQ_WIDTH_MAX pixels offset by up to 3
+
+    /*
+     * Wider glyphs are sent in slices of OLED_HQ_WIDTH_MAX pixels, each
+     * in its own window. Slices start on a column group boundary of the
+     * glyph, so they share xoff and the group between them is merged
+     * like any other neighbouring drawing.
+     */
+    for (uint8_t slice=0; slice<glyph_width; ) {
+	uint8_t width = glyph_width - slice;
+	if (width > OLED_HQ_WIDTH_MAX) {
+	    width = OLED_HQ_WIDTH_MAX;
 	}
-
-	// write a pixel row
-	uint8_t pind=0;
-	uint8_t byteCount = byteWidth;
-	for (pix=0; pix<glyph_width; pix+=4) {
-	    for (pind=0; pind<4; pind++) {
-		pixels &= 0xFFF0;
-		if (pix+pind < glyph_width) {
-		    uint8_t pixel = glyph ? pgm_read_byte(glyph++) : 0;
-#ifdef DEBUG
-		    Serial.print(F("    ")); Serial.print(pix+pind);
-		    Serial.print(F(" pixel 0x"));
-		    Serial.print(pixel,HEX);
-		    Serial.print(' ');
-		    Serial.print(pixels,HEX);
-		    Serial.print(F(" -> "));
-#endif
-		    pixels |= pixel;
-#ifdef DEBUG
-		    Serial.println(pixels,HEX);
-#endif
-		}
-		if (pind == (3-xoff)) {
-#ifdef DEBUG
-		    Serial.print(F("    ")); Serial.print(yind); Serial.print('.');
-		    Serial.print(pix+pind/4); Serial.print(F(" = 0x")); Serial.println(pixels,HEX);
-#endif
-		    writeData((uint8_t)(pixels >> 8));
-		    writeData((uint8_t)pixels);
-		    byteCount--;
-		} else {
-		    pixels <<= 4;
-		}
-	    }
+	if ((width < glyph_width) && !clipPart(x + slice, y, width, glyph_height, &part)) {
+	    slice += width;
+	    continue;
 	}
 
-	if (byteCount != 0) {
-	    // write final pixels
+	// groups built, the first part.skip aren't sent
+	byteWidth = part.skip + part.groups;
 #ifdef DEBUG
-	    Serial.print(F("  F ")); Serial.print(yind); Serial.print('.');
-	    Serial.print(pix+pind/4); Serial.print(F(" = 0x")); Serial.print(pixels,HEX);
-	    Serial.print(F(" pind=")); Serial.print(pind); 
-	    Serial.print(F(" xoff=")); Serial.println(xoff); 
+	Serial.print(F("window (x,y,xend,yend) = ")); 
+	Serial.print(part.x);
+	Serial.print(',');
+	Serial.print(part.y);
+	Serial.print(',');
+	Serial.print(part.xend);
+	Serial.print(',');
+	Serial.print(part.y+part.rows-1);
+	Serial.print(F(", byteWidth = ")); 
+	Serial.println(byteWidth);
 #endif
-	    pixels <<= (3-xoff)*4;
-	    writeData((uint8_t)(pixels >> 8));
-	    writeData((uint8_t)pixels);
-	}
 
-	// Include blank spacing pixel 
-	//pixels <<= 4;
+	setWindow(part.x, part.y, part.xend, part.y+part.rows-1);
 
-	if ((x+glyph_width) & 0x3) {
-#ifdef DEBUG
-	    Serial.print(F("gddram ind "));
-	    Serial.println(x+glyph_width);
-#endif
-	    gddram[y+yind].pixels = pixels;
-	} else {
-	    // rolled over 
-	    gddram[y+yind].pixels = 0;
+	beginStream();
+
+	const uint8_t *data = glyph;
+	if (data) {
+	    data += (uint16_t)part.skipRows * stride + (_fontHQ->packed ? slice / 2 : slice);
 	}
-	gddram[y+yind].xaddr = (x+glyph_width) / 4;
-#ifdef DEBUG
-	Serial.print(F("gddram["));
-	Serial.print(yind);
-	Serial.print(F("] = "));
-	Serial.print(gddram[y+yind].xaddr);
-	Serial.print(F(", 0x"));
-	Serial.println(gddram[y+yind].pixels,HEX);
-#endif
+	for (uint8_t yind=0; yind<part.rows; yind++) {
+	    hqRow(row, data, width, xoff, byteWidth);
+	    packedRow(part.y+yind, part.first, part.groups, part.lmask, part.rmask, &row[part.skip * 2]);
+	    if (data) {
+		data += stride;
+	    }
+	}
+	endStream();
+	slice += width;
     }
 
 #ifdef DEBUG
@@ -798,63 +2883,90 @@ uint8_t oled256::glyphDrawHQ(int16_t x, int16_t y, char ch, uint16_t colour, uin
 }
 
 
-void oled256::bitmapDraw(uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint16_t *image)
+/**
+ * Draw a 4bpp image at x,y.
+ * Pixels in the column groups shared with neighbouring drawing are kept.
+ * Only the part inside the clip rectangle is sent.
+ * @param x - left pixel column, can be negative
+ * @param y - top pixel row, can be negative
+ * @param width - image width in pixels
+ * @param height - image height in pixels
+ * @param image - image rows of (width+3)/4 words, leftmost pixel in the top nibble
+ */
+void oled256::bitmapDraw(int16_t x, int16_t y, uint8_t width, uint8_t height, const uint16_t *image)
 {
-    setWindow(x, y, x+width-1, y+height-1);
-    writeCommand(CMD_WRITE_RAM);
-
-    uint8_t xoff = x - (x / 4) * 4;
-    uint16_t pixels;
-    uint8_t xind;
+    part_t part;
+    uint8_t xoff = x & 0x3;
     uint8_t byteWidth = (width+3)/4;
 
-    if (xoff == 0) {
-	for (uint8_t yind=0; yind < height; yind++) {
-	    for (xind=0; xind < byteWidth; xind++) {
-		pixels = (uint16_t)pgm_read_byte(&image[yind*byteWidth+xind]) | pgm_read_byte((uint8_t *)&image[yind*byteWidth+xind]+1) << 8;
-		writeData((uint8_t)(pixels >> 8));
-		writeData((uint8_t)pixels);
-	    }
-	    gddram[yind].pixels = pixels;
-	    gddram[yind].xaddr = xind-1;
-	}
-    } else {
-	for (uint8_t yind=0; yind < height; yind++) {
+    if (!clipPart(x, y, width, height, &part)) {
+	return;
+    }
+
+    uint8_t groups = part.skip + part.groups;	// groups built, the first part.skip aren't sent
 
-	    if ((x/4) == gddram[yind].xaddr) {
-		// get the existing pixel data to handle the overlap
-		pixels = gddram[yind].pixels;
+    setWindow(part.x, part.y, part.xend, part.y+part.rows-1);
+    beginStream();
+
+    for (uint8_t yind=0; yind < part.rows; yind++) {
+	const uint16_t *row = &image[(uint16_t)(part.skipRows+yind)*byteWidth];
+	uint16_t imagePixels = 0;
+	uint16_t prev = 0;
+	uint16_t left = 0;
+	uint16_t pixels = 0;
+
+	for (uint8_t xind=0; xind < groups; xind++) {
+	    if (xind < byteWidth) {
+		imagePixels = (uint16_t)pgm_read_byte(&row[xind]) | pgm_read_byte((uint8_t *)&row[xind]+1) << 8;
 	    } else {
-		pixels = 0;
+		imagePixels = 0;
 	    }
+	    // image is offset in gddram, so each group takes the end of the previous word
+	    if (xoff) {
+		pixels = (prev << (16 - xoff*4)) | (imagePixels >> (xoff*4));
+	    } else {
+		pixels = imagePixels;
+	    }
+	    prev = imagePixels;
 
-	    uint16_t imagePixels;
-	    for (xind=0; xind < byteWidth; xind ++) {
-		// image is offset in gddram, so need to merge it with the previous pixel data
-		imagePixels = (uint16_t)pgm_read_byte(&image[yind*byteWidth+xind]) | pgm_read_byte((uint8_t *)&image[yind*byteWidth+xind]+1) << 8;
-
-		pixels |= imagePixels >> (4-xoff) * 4;
-		writeData((uint8_t)(pixels >> 8));
-		writeData((uint8_t)pixels);
-		pixels = imagePixels << 4*xoff;
+	    if (xind < part.skip) {
+		continue;
+	    }
+	    if (xind == part.skip) {
+		pixels = edgeMerge(part.y+yind, part.first, pixels, part.lmask);
+		left = pixels;
+	    } else if (xind == groups-1) {
+		pixels = edgeMerge(part.y+yind, part.first+part.groups-1, pixels, part.rmask);
 	    }
-	    writeData((uint8_t)(pixels >> 8));
-	    writeData((uint8_t)pixels);
-	    gddram[yind].pixels = pixels;
-	    gddram[yind].xaddr = xind-1;
+	    streamPixels(pixels);
 	}
+	edgeSave(part.y+yind, part.first, left, part.first+part.groups-1, pixels);
     }
+    endStream();
 }
 
 LcdDisplay::LcdDisplay(const uint8_t cs, const uint8_t dc, const uint8_t reset) : oled256(cs, dc, reset) {
+#ifdef OLED_LCD_GLYPHS
+    _glyphsUsed = 0;
+    _utf8Len = 0;
+#endif
 }
 
 void LcdDisplay::begin(uint8_t cols, uint8_t rows, uint8_t font)
 {
     oled256::begin(font);
+#ifdef OLED_LCD_GRID
+    _cols = (cols > OLED_LCD_COLS) ? OLED_LCD_COLS : (cols ? cols : 1);
+    _rows = (rows > OLED_LCD_ROWS) ? OLED_LCD_ROWS : (rows ? rows : 1);
+    _cellWidth = glyphWidth('0');
+    _cellHeight = glyphHeight();
+    _utf8Len = 0;
+    clear();
+#else
     clear();
     _cols = cols;
     _rows = rows;
+#endif
 }
 
 
@@ -865,13 +2977,18 @@ void LcdDisplay::begin(uint8_t cols, uint8_t rows, uint8_t font)
  */
 void LcdDisplay::setCursor(int16_t x, int16_t y)
 {
+#ifdef OLED_LCD_GRID
+    _col = x;
+    _row = y;
+#else
     setXY(x * glyphWidth('0'), y * glyphHeight());
+#endif
 }
 
 
 /**
  * Define a custom 8 by 8 character.
- * Characters 0 through 6 can be defined.
+ * Characters 0 through 7 can be defined.
  * @param ch - character to define
  * @param data - pointer an 8-byte array defining the character pattern
  */
@@ -880,10 +2997,214 @@ void LcdDisplay::createChar(uint8_t ch_id, uint8_t *data)
     if (ch_id > 7) 
 	return;
 
-    for (uint8_t ind=0; ind<7; ind++) {
+#ifdef OLED_LCD_GLYPHS
+    createGlyph(ch_id, 8, 8, data);
+#else
+    for (uint8_t ind=0; ind<8; ind++) {
 	userChar[ch_id][ind] = data[ind];
     }
+#ifdef OLED_LCD_GRID
+    markGlyph(ch_id);
+#endif
+#endif
+}
+
+/**
+ * Get the custom glyph a character is drawn with.
+ * @param ch - character
+ * @returns glyph id, or -1 if the character is drawn from the font
+ */
+int16_t LcdDisplay::glyphId(uint16_t ch)
+{
+    if (ch < 8) {
+	return ch;
+    }
+#ifdef OLED_LCD_GLYPHS
+    if ((ch >= OLED_LCD_GLYPH_CODE) && (ch < OLED_LCD_GLYPH_CODE + 0x100)) {
+	return ch - OLED_LCD_GLYPH_CODE;
+    }
+#endif
+    return -1;
+}
+
+#ifdef OLED_LCD_GRID
+/**
+ * Mark the cells showing a custom glyph for redrawing.
+ * @param id - glyph id, or -1 for all custom glyphs
+ */
+void LcdDisplay::markGlyph(int16_t id)
+{
+    for (uint8_t row=0; row<_rows; row++) {
+	for (uint8_t col=0; col<_cols; col++) {
+	    int16_t cellId = glyphId(_cell[row][col].ch);
+	    if ((cellId >= 0) && ((id < 0) || (cellId == id))) {
+		_changed[row] |= (uint32_t)1 << col;
+	    }
+	}
+    }
+}
+#endif
+
+#ifdef OLED_LCD_GLYPHS
+/**
+ * Define a custom glyph. The glyph is expanded into packed pixels now,
+ * so drawing it is a straight copy to the display. 1bpp glyphs are
+ * expanded in the current colours and drawn in the colours current
+ * when they are drawn, 4bpp glyphs keep their own grey levels.
+ * Glyphs 0-7 are written as characters 0-7, and every glyph as the
+ * code point OLED_LCD_GLYPH_CODE + id.
+ * @param id - glyph to define, replacing any earlier definition
+ * @param width - width in pixels, up to OLED_LCD_GLYPH_WIDTH
+ * @param height - height in pixels
+ * @param data - rows of pixels, each starting on a byte. 1bpp has the
+ *        msb as the leftmost pixel, 4bpp the high nibble.
+ * @param bpp - bits per pixel, 1 or 4
+ * @param progmem - true if data is in flash
+ * @returns false if the glyph doesn't fit in OLED_LCD_GLYPH_BYTES
+ */
+bool LcdDisplay::createGlyph(uint8_t id, uint8_t width, uint8_t height, const uint8_t *data,
+			     uint8_t bpp, bool progmem)
+{
+    uint8_t groups = (width + 3) / 4;
+    uint16_t size = 4 + (uint16_t)height * groups * 2;
+    uint16_t oldSize = 0;
+    uint8_t *old = findGlyph(id, &oldSize);
+
+    if ((width == 0) || (width > OLED_LCD_GLYPH_WIDTH) || (height == 0) ||
+	((bpp != 1) && (bpp != 4)) || (_glyphsUsed - oldSize + size > OLED_LCD_GLYPH_BYTES)) {
+	return false;
+    }
+    if (old != NULL) {
+	// the glyphs after the old definition move down
+	memmove(old, old + oldSize, _glyphsUsed - (old - _glyphs) - oldSize);
+	_glyphsUsed -= oldSize;
+    }
+
+    uint8_t fg = foreground & 0x0F;
+    uint8_t bg = background & 0x0F;
+    if (fg == bg) {
+	// keep the set pixels apart from the clear ones
+	fg = 0x0F;
+	bg = 0;
+    }
+
+    uint8_t *glyph = &_glyphs[_glyphsUsed];
+    uint8_t *out = &glyph[4];
+    uint8_t stride = (bpp == 1) ? (width + 7) / 8 : (width + 1) / 2;
+    glyph[0] = id;
+    glyph[1] = width;
+    glyph[2] = height;
+    glyph[3] = (bpp == 1) ? ((fg << 4) | bg) : 0;
+    for (uint8_t yind=0; yind<height; yind++) {
+	for (uint8_t pix=0; pix<groups*4; pix++) {
+	    uint8_t nibble = (bpp == 1) ? bg : 0;
+	    if (pix < width) {
+		uint8_t ind = (bpp == 1) ? pix / 8 : pix / 2;
+		uint8_t data8 = progmem ? pgm_read_byte(&data[ind]) : data[ind];
+		if (bpp == 1) {
+		    nibble = (data8 & (0x80 >> (pix & 7))) ? fg : bg;
+		} else {
+		    nibble = (pix & 1) ? (data8 & 0x0F) : (data8 >> 4);
+		}
+	    }
+	    if (pix & 1) {
+		out[pix / 2] |= nibble;
+	    } else {
+		out[pix / 2] = nibble << 4;
+	    }
+	}
+	out += groups * 2;
+	data += stride;
+    }
+    _glyphsUsed += size;
+#ifdef OLED_LCD_GRID
+    markGlyph(id);
+#endif
+    return true;
+}
+
+/**
+ * Forget all custom glyphs, including createChar() characters.
+ */
+void LcdDisplay::clearGlyphs(void)
+{
+    _glyphsUsed = 0;
+#ifdef OLED_LCD_GRID
+    markGlyph(-1);
+#endif
+}
+
+/**
+ * Get the room left for custom glyphs. A glyph takes 4 bytes plus
+ * 2 bytes for every 4 pixels, or part of 4, of each row.
+ * @returns bytes free
+ */
+uint16_t LcdDisplay::glyphBytesFree(void)
+{
+    return OLED_LCD_GLYPH_BYTES - _glyphsUsed;
+}
+
+/**
+ * Find a custom glyph.
+ * @param id - glyph id
+ * @param size - set to the bytes the glyph takes, can be NULL
+ * @returns the glyph header, or NULL if it is not defined
+ */
+uint8_t *LcdDisplay::findGlyph(uint8_t id, uint16_t *size)
+{
+    uint16_t pos = 0;
+
+    while (pos < _glyphsUsed) {
+	uint8_t *glyph = &_glyphs[pos];
+	uint16_t bytes = 4 + (uint16_t)glyph[2] * ((glyph[1] + 3) / 4) * 2;
+	if (glyph[0] == id) {
+	    if (size != NULL) {
+		*size = bytes;
+	    }
+	    return glyph;
+	}
+	pos += bytes;
+    }
+    return NULL;
+}
+
+/**
+ * Draw a custom glyph at x,y in the current colours. A 1bpp glyph last
+ * drawn in other colours is recoloured first, in place.
+ * @param x - left pixel column
+ * @param y - top pixel row
+ * @param id - glyph id
+ * @returns width of the glyph, 0 if it is not defined
+ */
+uint8_t LcdDisplay::drawGlyph(int16_t x, int16_t y, uint8_t id)
+{
+    uint8_t *glyph = findGlyph(id);
+    uint8_t fg = foreground & 0x0F;
+    uint8_t bg = background & 0x0F;
+
+    if (glyph == NULL) {
+	return 0;
+    }
+    if (glyph[3] != 0) {
+	if (fg == bg) {
+	    fillRect(x, y, glyph[1], glyph[2], fg);
+	    return glyph[1];
+	}
+	if (glyph[3] != ((fg << 4) | bg)) {
+	    uint8_t oldFg = glyph[3] >> 4;
+	    uint16_t bytes = (uint16_t)glyph[2] * ((glyph[1] + 3) / 4) * 2;
+	    for (uint16_t ind=4; ind<4+bytes; ind++) {
+		uint8_t data8 = glyph[ind];
+		glyph[ind] = ((((data8 >> 4) == oldFg) ? fg : bg) << 4) |
+			     (((data8 & 0x0F) == oldFg) ? fg : bg);
+	    }
+	    glyph[3] = (fg << 4) | bg;
+	}
+    }
+    packedDraw(x, y, glyph[1], glyph[2], &glyph[4], true);
+    return glyph[1];
 }
+#endif
 
 
 /**
@@ -891,36 +3212,334 @@ void LcdDisplay::createChar(uint8_t ch_id, uint8_t *data)
  * character location.
  * If the cursor reaches the end of the row, move it to the start of
  * the next row.
+ * With OLED_LCD_GRID the character is only stored in the cell at the
+ * cursor, UTF-8 sequences as one character, and update() draws it.
+ * Characters 0-7 are drawn as custom characters, and with
+ * OLED_LCD_GLYPHS so are code points from OLED_LCD_GLYPH_CODE.
  * @param ch - character to write
  * @returns number of characters written (Print class compatible)
  * @note this is used to support all of the inherited Print class methods.
  */
 size_t LcdDisplay::write(uint8_t ch)
 {
-    if (ch > 7) {
+#ifdef OLED_LCD_GRID
+    uint16_t code = ch;
+
+    if ((_utf8Len > 0) && ((ch & 0xC0) != 0x80)) {
+	// not a continuation byte, drop the incomplete sequence
+	_utf8Len = 0;
+    }
+    if (ch >= 0x80) {
+	_utf8[_utf8Len++] = ch;
+	if (utf8Decode(_utf8, _utf8Len, &code) == 0) {
+	    // wait for the rest of the sequence
+	    return 1;
+	}
+	_utf8Len = 0;
+    }
+
+    if (code == '\n') {
+	_col = 0;
+	_row++;
+    } else if (code == '\r') {
+	_col = 0;
+    } else if ((code > 7) && (code < ' ')) {
+	// other control characters
+    } else {
+	if (wrap && (_col >= _cols)) {
+	    _col = 0;
+	    _row++;
+	}
+	if ((_col < _cols) && (_row < _rows)) {
+	    cell_t cell = { code, (uint8_t)((foreground << 4) | background), fontCode() };
+	    cell_t *old = &_cell[_row][_col];
+	    if ((old->ch != cell.ch) || (old->colours != cell.colours) || (old->font != cell.font)) {
+		*old = cell;
+		_changed[_row] |= (uint32_t)1 << _col;
+	    }
+	}
+	_col++;
+    }
+    return 1;
+#else
+#ifdef OLED_LCD_GLYPHS
+    uint16_t code = ch;
+
+    if ((_utf8Len > 0) && ((ch & 0xC0) != 0x80)) {
+	// not a continuation byte, drop the incomplete sequence
+	_utf8Len = 0;
+    }
+    if (ch >= 0x80) {
+	_utf8[_utf8Len++] = ch;
+	if (utf8Decode(_utf8, _utf8Len, &code) == 0) {
+	    // wait for the rest of the sequence
+	    return 1;
+	}
+	uint8_t len = _utf8Len;
+	_utf8Len = 0;
+	if (glyphId(code) < 0) {
+	    for (uint8_t ind=0; ind<len; ind++) {
+		oled256::write(_utf8[ind]);
+	    }
+	    return 1;
+	}
+    }
+    int16_t id = glyphId(code);
+#else
+    int16_t id = glyphId(ch);
+#endif
+    if (id < 0) {
 	return oled256::write(ch);
     } else {
 	/* Custom character */
+#ifdef OLED_LCD_GLYPHS
+	const uint8_t *glyph = findGlyph(id);
+	uint8_t width = (glyph != NULL) ? glyph[1] : 0;
+#else
+	uint8_t width = 8;
+#endif
 
 	/* check for wrap */
-	if (wrap && ((cur_x + 8) > OLED_WIDTH)) {
+	if (wrap && ((cur_x + width) > OLED_WIDTH)) {
 	    cur_y += glyphHeight();
 	    cur_x = 0;
 	}
 	/* Draw the custom character using the current colours */
-	setWindow(cur_x, cur_y, cur_x+7, cur_y+7);
-	writeCommand(CMD_WRITE_RAM);
-	for (uint8_t ind=0; ind<8; ind++) {
-	    uint8_t line = userChar[ch][ind];
-	    for (uint8_t bit=0x80; bit; bit>>=2) {
-		uint8_t seg;
-		seg = (line & 0x80) ? foreground << 4 : background << 4;
-		seg |= (line & 0x40) ? foreground : background;
-		line <<= 2;
-		writeData(seg);
-	    }
-	}
-	cur_x += 8;
+#ifdef OLED_LCD_GLYPHS
+	drawGlyph(cur_x, cur_y, id);
+#else
+	monoDraw(cur_x, cur_y, 8, 8, userChar[id], 1, false, foreground, background);
+#endif
+	cur_x += width;
 	return 1;
     }
+#endif
+}
+
+#ifdef OLED_LCD_GRID
+/**
+ * Write text into the cells at the cursor.
+ * @param buf - text to write
+ * @param size - number of bytes
+ * @returns number of bytes written
+ */
+size_t LcdDisplay::write(const uint8_t *buf, size_t size)
+{
+    for (size_t ind=0; ind<size; ind++) {
+	write(buf[ind]);
+    }
+    return size;
+}
+
+/**
+ * Clear the display now, set every cell to a space in the current
+ * colours and font, and move the cursor to the top left.
+ */
+void LcdDisplay::clear(void)
+{
+    cell_t blank = { ' ', (uint8_t)((foreground << 4) | background), fontCode() };
+
+    fill(background);
+    for (uint8_t row=0; row<OLED_LCD_ROWS; row++) {
+	for (uint8_t col=0; col<OLED_LCD_COLS; col++) {
+	    _cell[row][col] = blank;
+	}
+	_changed[row] = 0;
+    }
+    _col = 0;
+    _row = 0;
+}
+
+/**
+ * Redraw the cells that changed since the last update(). Adjacent
+ * changed cells with the same colours and font are drawn together,
+ * in one window where the font is fixed width. Without a frame buffer
+ * the pixels of a column group shared with an unchanged cell can't
+ * be read back, so neighbouring cells are redrawn until the ends of
+ * each run fall on a group boundary.
+ */
+void LcdDisplay::update(void)
+{
+    uint8_t font = fontCode();
+    uint8_t current = font;
+    uint8_t fg = foreground;
+    uint8_t bg = background;
+
+    for (uint8_t row=0; row<_rows; row++) {
+	uint32_t changed = _changed[row];
+	if (changed == 0) {
+	    continue;
+	}
+#ifndef OLED_FRAMEBUFFER
+	for (uint8_t col=0; col+1 < _cols; col++) {
+	    if ((changed & ((uint32_t)1 << col)) && (((col+1) * _cellWidth) & 3)) {
+		changed |= (uint32_t)1 << (col+1);
+	    }
+	}
+	for (uint8_t col=_cols; col > 1; col--) {
+	    if ((changed & ((uint32_t)1 << (col-1))) && (((col-1) * _cellWidth) & 3)) {
+		changed |= (uint32_t)1 << (col-2);
+	    }
+	}
+#endif
+
+	for (uint8_t col=0; col < _cols; ) {
+	    if (!(changed & ((uint32_t)1 << col))) {
+		col++;
+		continue;
+	    }
+	    const cell_t *cell = &_cell[row][col];
+	    uint8_t first = col++;
+	    while ((col < _cols) && (changed & ((uint32_t)1 << col)) &&
+		   (_cell[row][col].colours == cell->colours) && (_cell[row][col].font == cell->font)) {
+		col++;
+	    }
+	    if (cell->font != current) {
+		useFont(cell->font);
+		current = cell->font;
+	    }
+	    drawRun(row, first, col);
+	}
+	_changed[row] = 0;
+    }
+
+    if (current != font) {
+	useFont(font);
+    }
+    setColour(fg);
+    setBackground(bg);
+}
+
+/**
+ * Draw a run of cells that share colours and font, in that font.
+ * @param row - cell row
+ * @param first - first cell
+ * @param end - cell after the last
+ */
+void LcdDisplay::drawRun(uint8_t row, uint8_t first, uint8_t end)
+{
+    const cell_t *cell = &_cell[row][first];
+    uint8_t fg = cell->colours >> 4;
+    uint8_t bg = cell->colours & 0x0F;
+    int16_t y = row * _cellHeight;
+    uint8_t height = glyphHeight();
+    char text[OLED_LCD_COLS];
+    bool fixed = true;
+    rect_t rect;
+
+    rect.x = first * _cellWidth;
+    rect.y = y;
+    rect.width = (end - first) * _cellWidth;
+    rect.height = _cellHeight;
+
+    setColour(fg);
+    setBackground(bg);
+    for (uint8_t col=first; col < end; col++) {
+	uint16_t ch = _cell[row][col].ch;
+	if ((ch < ' ') || (ch >= 0x80) || (glyphWidth(ch) != _cellWidth)) {
+	    fixed = false;
+	}
+	text[col - first] = ch;
+    }
+
+    if (fixed && (getFontHQ() == NULL)) {
+	// glyphs too tall for a cell are cut off
+	bool clipped = pushClip(rect);
+	drawString(rect.x, y, text, end - first);
+	if (height < _cellHeight) {
+	    fillRect(rect.x, y + height, rect.width, _cellHeight - height, bg);
+	}
+	if (clipped) {
+	    popClip();
+	}
+	return;
+    }
+
+    /*
+     * Each cell on its own, cut to the cell. What the glyph doesn't
+     * cover is filled around it, so that each part drawn only shares
+     * column groups with the part drawn just before it.
+     */
+    for (uint8_t col=first; col < end; col++) {
+	uint16_t ch = _cell[row][col].ch;
+	int16_t id = glyphId(ch);
+	rect_t ink = { 0, 0, 8, 8 };
+	if (id < 0) {
+	    ink = glyphBounds(ch);
+	}
+#ifdef OLED_LCD_GLYPHS
+	else {
+	    const uint8_t *glyph = findGlyph(id);
+	    ink.width = (glyph != NULL) ? glyph[1] : 0;
+	    ink.height = (glyph != NULL) ? glyph[2] : 0;
+	}
+#endif
+	int16_t x = col * _cellWidth;
+	int16_t left = (ink.x > 0) ? ink.x : 0;
+	int16_t top = (ink.y > 0) ? ink.y : 0;
+	int16_t right = ink.x + (int16_t)ink.width;
+	int16_t bottom = ink.y + (int16_t)ink.height;
+	if (right > _cellWidth) {
+	    right = _cellWidth;
+	}
+	if (bottom > _cellHeight) {
+	    bottom = _cellHeight;
+	}
+	if ((left >= right) || (top >= bottom)) {
+	    // nothing of the glyph shows
+	    fillRect(x, y, _cellWidth, _cellHeight, bg);
+	    continue;
+	}
+
+	rect_t clip = { x, y, _cellWidth, _cellHeight };
+	bool clipped = pushClip(clip);
+	if (top > 0) {
+	    fillRect(x, y, _cellWidth, top, bg);
+	}
+	if (left > 0) {
+	    fillRect(x, y + top, left, bottom - top, bg);
+	}
+	if (id >= 0) {
+#ifdef OLED_LCD_GLYPHS
+	    drawGlyph(x, y, id);
+#else
+	    monoDraw(x, y, 8, 8, userChar[id], 1, false, fg, bg);
+#endif
+	} else {
+	    glyphDraw(x, y, ch, fg, bg);
+	}
+	if (right < _cellWidth) {
+	    fillRect(x + right, y + top, _cellWidth - right, bottom - top, bg);
+	}
+	if (bottom < _cellHeight) {
+	    fillRect(x, y + bottom, _cellWidth, _cellHeight - bottom, bg);
+	}
+	if (clipped) {
+	    popClip();
+	}
+    }
+}
+
+/**
+ * Get a code for the current font to keep in a cell.
+ * @returns the 1bpp font, or 0x80 + the HQ font
+ */
+uint8_t LcdDisplay::fontCode(void)
+{
+    font_t *hq = getFontHQ();
+    return (hq != NULL) ? 0x80 | (hq - fontsHQ) : getFont();
+}
+
+/**
+ * Set the font from a code kept in a cell.
+ * @param code - 1bpp font, or 0x80 + HQ font
+ */
+void LcdDisplay::useFont(uint8_t code)
+{
+    if (code & 0x80) {
+	setFontHQ(code & 0x7F);
+    } else {
+	setFont(code);
+    }
 }
+#endif
@@ -31,6 +31,49 @@
 #include "fonts.h"
 #include "fontHQ.h"
 
+/* select desired driver options. (Simply #undef those not needed) */
+#undef OLED_ASYNC		/* interrupt driven SPI transmit queue */
+#undef OLED_FRAMEBUFFER		/* draw into an 8KB frame buffer, send it with flush() */
+#undef OLED_GLYPH_CACHE		/* keep recently drawn glyphs expanded in RAM */
+#undef OLED_HOT_GLYPHS		/* pre-shifted copies of chosen glyphs, see setHotGlyphs() */
+#undef OLED_FONT_SOURCE		/* 1bpp fonts read from external storage, see oledFont.h */
+#undef OLED_LCD_GRID		/* LcdDisplay remembers its cells, see LcdDisplay::update() */
+#undef OLED_LCD_GLYPHS		/* LcdDisplay custom glyphs of any size, see LcdDisplay::createGlyph() */
+#undef OLED_EDGE_CACHE		/* remember OLED_EDGE_WAYS edge groups per row instead of one */
+#define OLED_EDGE_WAYS	4	/* column groups OLED_EDGE_CACHE remembers per row, 3 bytes each */
+#define OLED_GLYPH_CACHE_SLOTS	8	/* glyphs kept by OLED_GLYPH_CACHE */
+#define OLED_GLYPH_CACHE_BYTES	96	/* largest glyph kept, 2 bytes per 4 pixels of each row */
+#define OLED_RUN_MAX	32	/* glyphs sent in one window by textRun() */
+#define OLED_HQ_RUN_MAX	8	/* HQ glyphs sent in one window by drawStringCells() */
+#define OLED_HQ_WIDTH_MAX	32	/* widest slice of an HQ glyph glyphDrawHQ() sends, a multiple of 4 */
+#define OLED_HOT_MAX	16	/* glyphs pre-shifted by setHotGlyphs() */
+#define OLED_CLIP_DEPTH	4	/* clip rectangles pushClip() can nest */
+#define OLED_LCD_COLS	32	/* columns OLED_LCD_GRID remembers, at most 32 */
+#define OLED_LCD_ROWS	8	/* rows OLED_LCD_GRID remembers */
+#define OLED_LCD_GLYPH_BYTES	320	/* RAM for OLED_LCD_GLYPHS glyphs, 36 bytes per 8x8 glyph */
+
+#ifndef OLED_EDGE_CACHE
+#undef OLED_EDGE_WAYS
+#define OLED_EDGE_WAYS	1	/* only the right edge of the last draw on each row */
+#endif
+
+#if defined(OLED_ASYNC) && !defined(SPI_STC_vect)
+#undef OLED_ASYNC		/* no SPI interrupt on this target, use polled SPI */
+#endif
+
+/* select the display interface to match BS1/BS0, see oledBus.h:
+ *   oledBusSpi4<>			4 line SPI
+ *   oledBusSpi3<>			3 line SPI, dc pin is not used
+ *   oledBus8080<DATA, CTRL, WR>	8080 parallel, e.g. oledBus8080<oledPortD, oledPortB, 0>
+ *   oledBus6800<DATA, CTRL, E>		6800 parallel
+ * CS and DC can be fixed at compile time for faster pin toggling by
+ * adding a pin policy, e.g. oledBusSpi4< oledFixedPins<10, 9> >
+ */
+#define OLED_BUS oledBusSpi4<>
+
+#include "oledBus.h"
+#include "oledFont.h"
+
 /**************************************************
 *    LM320Y-256064 (SSD1322 driver)
 *
@@ -63,6 +106,7 @@
 *      1   1	8-bit 6800 parallel
 *
 *      Note: SPI mode is write only (MOSI)
+*      Note: select the interface with OLED_BUS above.
 *
 **************************************************/
 
@@ -104,6 +148,38 @@
 #define LCD_CHAR_COLS 28
 #define LCD_CHAR_ROWS 5
 
+#define OLED_ALIGN_LEFT		0x00	/* drawText() alignment */
+#define OLED_ALIGN_CENTRE	0x01
+#define OLED_ALIGN_RIGHT	0x02
+#define OLED_ALIGN_JUSTIFY	0x03	/* drawTextBox() only */
+#define OLED_ALIGN_TOP		0x00
+#define OLED_ALIGN_MIDDLE	0x04
+#define OLED_ALIGN_BOTTOM	0x08
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    uint16_t width;
+    uint16_t height;
+} rect_t;
+
+#ifdef OLED_FRAMEBUFFER
+#define OLED_WINDOW_COST	7	/* bus bytes to open a window: column, row and write commands */
+
+typedef struct {
+    uint8_t x0;			// first column group (4 pixels)
+    uint8_t x1;			// last column group
+    uint8_t y0;			// first row
+    uint8_t y1;			// last row
+} update_t;
+
+typedef struct {
+    uint8_t count;		// windows to send
+    uint16_t cost;		// estimated bus bytes, commands and pixel data
+    update_t window[LCDHEIGHT];
+} plan_t;
+#endif
+
 class oled256 : public Print {
 public:
     oled256(const uint8_t cs, const uint8_t dc, const uint8_t reset);
@@ -111,19 +187,56 @@ public:
     void init(void);
     void writeCommand(uint8_t reg);
     void writeData(uint8_t data);
+    void beginStream(void);
+    void streamData(uint8_t data);
+    void streamData(const uint8_t *buf, uint16_t len);
+    void streamPixels(uint16_t pixels);
+    void streamFill(uint8_t data, uint16_t count);
+    void endStream(void);
+    void flush(void);
+    bool isBusy(void);
+    void setTxCallback(void (*callback)(void));
+    void renderBands(void (*draw)(void), uint8_t *buf, uint8_t rows);
+    void setDoubleBuffer(bool enable);
+    void flip(void);
+    void scroll(uint8_t rows);
+    uint8_t wrapRow(void);
+#ifdef OLED_FRAMEBUFFER
+    void setPixel(uint8_t x, uint8_t y, uint8_t colour);
+    uint8_t getPixel(uint8_t x, uint8_t y);
+    const plan_t &planFlush(void);
+#endif
+#ifdef OLED_GLYPH_CACHE
+    void clearGlyphCache(void);
+    uint32_t getGlyphCacheHits(void);
+    uint32_t getGlyphCacheMisses(void);
+#endif
+#ifdef OLED_HOT_GLYPHS
+    uint8_t setHotGlyphs(const char *chars, uint8_t *buf, uint16_t size);
+#endif
     void setColumnAddr(uint8_t start, uint8_t end);
     void setRowAddr(uint8_t start, uint8_t end);
     void fill(uint8_t colour);
+    void fillRect(int16_t x, int16_t y, uint16_t width, uint8_t height, uint8_t colour);
     void clear();
     void reset();
     void off();
     void on();
 
-    void bitmapDraw(uint8_t x, uint8_t y, uint8_t width, uint8_t height, const uint16_t *image);
+    void bitmapDraw(int16_t x, int16_t y, uint8_t width, uint8_t height, const uint16_t *image);
+
+    bool pushClip(const rect_t &rect);
+    void popClip(void);
+    rect_t getClip(void);
 
     void setWindow(uint8_t x, uint8_t y, uint8_t xend, uint8_t yend);
     void setFont(uint8_t font);
     void setFontHQ(uint8_t font);
+    uint8_t getFont(void);
+    font_t *getFontHQ(void);
+#ifdef OLED_FONT_SOURCE
+    void setFont(oledFont *font);
+#endif
     void setColour(uint8_t colour);
     void setContrast(uint8_t contrast);
     void setBackground(uint8_t colour);
@@ -134,11 +247,20 @@ public:
 
     void setXY(uint8_t col, uint8_t row);
 
-    uint8_t glyphWidth(char ch);
+    uint8_t glyphWidth(uint16_t ch);
     uint8_t glyphHeight();
-    uint8_t glyphDraw(uint16_t x, uint16_t y, char ch, uint16_t colour, uint16_t bg);
+    rect_t glyphBounds(uint16_t ch);
+    uint8_t glyphDraw(int16_t x, int16_t y, uint16_t ch, uint16_t colour, uint16_t bg);
 
-    uint8_t glyphDrawHQ(int16_t x, int16_t y, char ch, uint16_t colour, uint16_t bg);
+    uint8_t glyphDrawHQ(int16_t x, int16_t y, uint16_t ch, uint16_t colour, uint16_t bg);
+    uint16_t drawString(int16_t x, int16_t y, const char *str);
+    uint16_t drawString(int16_t x, int16_t y, const char *str, size_t len);
+    uint16_t drawStringCells(int16_t x, int16_t y, const char *str, size_t len);
+    uint16_t textWidth(const char *str);
+    rect_t textBounds(int16_t x, int16_t y, const char *str);
+    void drawText(const rect_t &box, const char *str, uint8_t align);
+    size_t drawTextBox(const rect_t &box, const char *str, uint8_t align);
+    static uint8_t utf8Decode(const char *str, size_t len, uint16_t *ch);
 
     virtual size_t write(uint8_t ch);
     virtual size_t write(const char *buf);
@@ -151,11 +273,16 @@ public:
     uint8_t background;
     bool wrap;
 
+ protected:
+    void monoDraw(int16_t x, int16_t y, uint8_t width, uint8_t height, const uint8_t *data,
+		  uint8_t stride, bool progmem, uint8_t colour, uint8_t bg);
+    void packedDraw(int16_t x, int16_t y, uint8_t width, uint8_t height, const uint8_t *data,
+		    bool aligned=false);
+    uint8_t textRun(int16_t *x, int16_t y, const char *str, uint8_t len, int16_t right,
+		    uint8_t colour, uint8_t bg);
+
  private:
-    uint8_t volatile *port_cs;
-    uint8_t volatile *port_dc;
-    uint8_t pin_cs;
-    uint8_t pin_dc;
+    OLED_BUS _bus;
     uint8_t _cs;		// chip select
     uint8_t _dc;		// data vs command
     uint8_t _reset;
@@ -166,31 +293,253 @@ public:
     uint8_t _offset;
     uint8_t _bufHeight;
 
+    // controller address window and write pointer, to skip redundant commands
     struct {
-	uint8_t xaddr;
+	uint8_t colStart;
+	uint8_t colEnd;
+	uint8_t col;
+	uint8_t rowStart;
+	uint8_t rowEnd;
+	uint8_t row;
+	bool colValid;
+	bool rowValid;
+	bool writing;		// CMD_WRITE_RAM is the current command
+    } _win;
+    uint16_t _streamCount;	// bytes sent in the current stream
+
+    bool _doubleBuffer;
+    uint8_t _drawRow;		// first RAM row being drawn into
+    uint8_t _showRow;		// first RAM row being displayed
+
+    void panelWindow(uint8_t x, uint8_t y, uint8_t xend, uint8_t yend);
+    void panelBegin(void);
+    void panelData(const uint8_t *buf, uint16_t len);
+    void panelEnd(void);
+
+    // memory buffer being drawn into instead of the display, or NULL
+    uint8_t *_mem;
+    uint8_t _memY;		// display row of the first buffer row
+    uint8_t _memRows;		// rows in the buffer
+    struct {
+	uint8_t x0;		// window, in bytes (two pixels)
+	uint8_t x1;
+	uint8_t y0;		// window, in display rows
+	uint8_t y1;
+	uint8_t x;		// write pointer
+	uint8_t y;
+    } _memWin;
+    void memWrite(uint8_t data);
+
+    // 1bpp to 4 pixel expansion and HQ alpha blend for the colours last drawn with
+    uint16_t _expand[16];
+    uint8_t _blend[16];
+    bool _blendCopy;		// blending leaves HQ glyph pixels unchanged
+    uint8_t _expandFg;
+    uint8_t _expandBg;
+    void expandColours(uint8_t colour, uint8_t bg);
+    uint8_t monoGlyph(uint16_t ch, const uint8_t **glyph);
+    uint8_t glyphAdvance(uint16_t ch);
+    uint8_t hqIndex(uint16_t ch);
+    uint8_t codepointGlyph(const codepoint_t *cmap, uint8_t size, uint16_t ch, uint8_t def);
+
+    // bytes of a UTF-8 sequence passed to write() one at a time
+    struct {
+	uint8_t buf[4];
+	uint8_t len;
+    } _utf8;
+
+    // current font, loaded by setFont() and setFontHQ()
+    struct {
+	uint8_t height;
+	uint8_t stride;		// bytes per 1bpp glyph row
+	bool progmem;		// 1bpp glyphs are in flash
+	uint8_t width[0x80 - ' '];	// widths of ' ' to 0x7F
+    } _metrics;
+    void loadMetrics(void);
+    void monoRow(uint8_t *out, const uint8_t *data, uint8_t stride, bool progmem,
+		 uint8_t xoff, uint8_t groups);
+    void hqRow(uint8_t *out, const uint8_t *glyph, uint8_t width, uint8_t xoff, uint8_t groups);
+    size_t hqRun(int16_t *x, int16_t y, const char *str, size_t len);
+    void packedRow(uint8_t y, uint8_t first, uint8_t groups, uint16_t lmask, uint16_t rmask,
+		   const uint8_t *row);
+
+#ifdef OLED_GLYPH_CACHE
+    // recently drawn 1bpp glyphs, expanded and shifted ready to send
+    struct {
+	uint8_t font;
+	uint16_t ch;		// character
+	uint8_t colours;	// foreground and background nibbles
+	uint8_t xoff;		// pixel offset into the first column group
+	uint8_t height;		// 0 if unused
+	uint16_t used;		// _glyphClock when last drawn
+	uint8_t data[OLED_GLYPH_CACHE_BYTES];
+    } _glyphCache[OLED_GLYPH_CACHE_SLOTS];
+    uint16_t _glyphClock;
+    uint32_t _glyphHits;
+    uint32_t _glyphMisses;
+    const uint8_t *glyphCache(uint16_t ch, uint8_t xoff, const uint8_t *glyph, uint8_t width,
+			      uint8_t height, uint8_t stride, uint8_t colour, uint8_t bg);
+#endif
+
+#ifdef OLED_HOT_GLYPHS
+    // glyphs pre-shifted for each pixel offset into a column group
+    struct {
+	uint8_t *buf;
+	uint8_t count;
+	uint8_t font;
+	font_t *fontHQ;
+#ifdef OLED_FONT_SOURCE
+	oledFont *extFont;
+#endif
+	uint8_t colours;	// foreground and background nibbles
+	struct {
+	    uint16_t ch;
+	    uint8_t width;
+	    uint8_t height;
+	    uint16_t offset;	// of the xoff 0 copy in buf, the others follow
+	} glyph[OLED_HOT_MAX];
+    } _hot;
+    const uint8_t *hotGlyph(uint16_t ch, uint8_t xoff, uint8_t colour, uint8_t bg,
+			    uint8_t *width=NULL, uint8_t *height=NULL);
+#endif
+
+#ifdef OLED_FRAMEBUFFER
+    uint8_t _frame[LCDHEIGHT][LCDWIDTH/2];
+    struct {
+	uint8_t start;		// changed column groups (4 pixels) in each row
+	uint8_t end;
+    } _dirty[LCDHEIGHT], _prevDirty[LCDHEIGHT];
+    plan_t _plan;
+#endif
+
+    // Pixels of the column groups (4 pixels) recently drawn at the left
+    // and right edges of each row, most recent first. Used to merge the
+    // pixels a new glyph or bitmap shares with its neighbours. Memory
+    // render targets are read back directly instead.
+    //
+    // By default only the right edge of the last draw on each row is
+    // kept (192 bytes), which is what text drawn left to right needs.
+    // OLED_EDGE_CACHE keeps OLED_EDGE_WAYS groups per row, which also
+    // covers drawing next to something drawn a few draws earlier. Older
+    // groups read back as the last fill() colour, so redrawing a glyph
+    // in the middle of a line can clear pixels of its neighbours. Use
+    // OLED_FRAMEBUFFER for that, or redraw the neighbours clipped to the
+    // shared groups, as oledField does.
+    struct edge_t {
+	uint8_t group;		// column group, 0xFF if unused
 	uint16_t pixels;
-    } gddram[LCDHEIGHT];
+    };
+#ifndef OLED_FRAMEBUFFER
+    edge_t _edge[LCDHEIGHT][OLED_EDGE_WAYS];
+#endif
+    uint16_t _edgeFill;		// pixels of any group not in the cache
+    void edgeReset(void);
+    uint16_t edgeRead(uint8_t y, uint8_t group);
+    uint16_t edgeMerge(uint8_t y, uint8_t group, uint16_t pixels, uint16_t mask);
+    void edgeSave(uint8_t y, uint8_t first, uint16_t left, uint8_t last, uint16_t right);
+
+    // drawing is limited to the clip rectangle, which is always within
+    // the display and is empty if x0 > x1 or y0 > y1
+    struct clip_t {
+	int16_t x0;		// first pixel column
+	int16_t y0;		// first row
+	int16_t x1;		// last pixel column
+	int16_t y1;		// last row
+    };
+    clip_t _clip;
+    clip_t _clipStack[OLED_CLIP_DEPTH];
+    uint8_t _clipDepth;
+    void clipTo(const rect_t &rect);
+
+    // the part of a draw inside the clip rectangle
+    struct part_t {
+	uint8_t x;		// first and last pixel columns sent
+	uint8_t xend;
+	uint8_t y;		// first row sent
+	uint8_t rows;		// rows sent
+	uint8_t first;		// first column group sent
+	uint8_t groups;		// column groups sent
+	uint8_t skip;		// column groups of the draw before the first sent
+	uint8_t skipRows;	// rows of the draw before the first sent
+	uint16_t lmask;		// nibbles of the first group to draw
+	uint16_t rmask;		// nibbles of the last group to draw
+    };
+    bool clipPart(int16_t x, int16_t y, uint16_t width, uint16_t height, part_t *part);
 
     uint8_t readByte();
     void writeByte(uint8_t data);
 
     uint8_t _font;
     font_t *_fontHQ;
+#ifdef OLED_FONT_SOURCE
+    oledFont *_extFont;		// used instead of _font if not NULL
+#endif
     bool debug;
 };
 
+#define OLED_LCD_GLYPH_CODE	0xE000	/* code point written for createGlyph() glyph 0 */
+#define OLED_LCD_GLYPH_WIDTH	64	/* widest createGlyph() glyph */
+
 class LcdDisplay : public oled256 {
     public:
 	LcdDisplay(const uint8_t cs, const uint8_t dc, const uint8_t reset);
 	void begin(uint8_t cols=32, uint8_t rows=5, uint8_t font=FONT_NINE_DOT);
 	void setCursor(int16_t x, int16_t y);
 	void createChar(uint8_t, uint8_t[]);
+#ifdef OLED_LCD_GLYPHS
+	bool createGlyph(uint8_t id, uint8_t width, uint8_t height, const uint8_t *data,
+			 uint8_t bpp=1, bool progmem=false);
+	void clearGlyphs(void);
+	uint16_t glyphBytesFree(void);
+	uint8_t drawGlyph(int16_t x, int16_t y, uint8_t id);
+#endif
 	virtual size_t write(uint8_t ch);
+#ifdef OLED_LCD_GRID
+	virtual size_t write(const uint8_t *buf, size_t size);
+	void clear(void);
+	void update(void);
+#endif
 
     private:
+#ifdef OLED_LCD_GLYPHS
+	/*
+	 * Glyphs one after the other, each a header of id, width, height
+	 * and the colours a 1bpp glyph is expanded in (0 for 4bpp), then
+	 * its rows of packed pixels. A row starts on a column group and
+	 * covers whole groups.
+	 */
+	uint8_t _glyphs[OLED_LCD_GLYPH_BYTES];
+	uint16_t _glyphsUsed;
+	uint8_t *findGlyph(uint8_t id, uint16_t *size=NULL);
+#else
 	uint8_t userChar[8][8];
+#endif
+	int16_t glyphId(uint16_t ch);
 	uint8_t _cols;
 	uint8_t _rows;
+#if defined(OLED_LCD_GRID) || defined(OLED_LCD_GLYPHS)
+	char _utf8[4];			// bytes of a UTF-8 sequence
+	uint8_t _utf8Len;
+#endif
+
+#ifdef OLED_LCD_GRID
+	// what each cell holds, and the cells changed since the last update()
+	struct cell_t {
+	    uint16_t ch;		// character, 0-7 or from OLED_LCD_GLYPH_CODE for custom glyphs
+	    uint8_t colours;		// foreground and background nibbles
+	    uint8_t font;		// 1bpp font, or 0x80 + HQ font
+	};
+	cell_t _cell[OLED_LCD_ROWS][OLED_LCD_COLS];
+	uint32_t _changed[OLED_LCD_ROWS];	// a bit for each column
+	uint8_t _col;			// cursor cell
+	uint8_t _row;
+	uint8_t _cellWidth;
+	uint8_t _cellHeight;
+	uint8_t fontCode(void);
+	void useFont(uint8_t code);
+	void drawRun(uint8_t row, uint8_t first, uint8_t end);
+	void markGlyph(int16_t id);
+#endif
 };
 
 
@@ -0,0 +1,472 @@
+/*-
+ * Copyright (c) 2014 Darran Hunt (darran [at] hunt dot net dot nz)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef OLEDBUS_H_
+#define OLEDBUS_H_
+
+#include "Arduino.h"
+#include <SPI.h>
+#include "oledTxQueue.h"
+
+/*
+ * Display interface (bus) policies, one per SSD1322 BS1/BS0 mode.
+ *
+ * The driver owns one bus object whose type is picked at compile time
+ * with OLED_BUS in oled256.h, so every call below inlines into the
+ * drawing code. Each bus provides:
+ *
+ *   begin(cs, dc)	set up the interface pins
+ *   command(reg)	send one command byte
+ *   data(data)		send one parameter byte
+ *   startWrite(reg)	send a command and hold the bus for its data
+ *   resumeWrite()	hold the bus for more data for the last command
+ *   write(data)	send a data byte after startWrite()/resumeWrite()
+ *   endWrite()		release the bus
+ *   flush(), isBusy(), setCallback()	transmit queue control
+ *
+ * The chip select and data/command pins are handled by a pin policy,
+ * either oledRuntimePins (pins passed to the oled256 constructor) or
+ * oledFixedPins<CS, DC> (pins fixed at compile time).
+ */
+
+#define pinLow(port, pin)	*port &= ~pin
+#define pinHigh(port, pin)	*port |= pin
+
+/*
+ * Whole 8-bit port access for the parallel interfaces.
+ */
+#define OLED_PORT(name, port, ddr) \
+    struct name { \
+	static volatile uint8_t &out() { return port; } \
+	static volatile uint8_t &dir() { return ddr; } \
+    };
+
+#ifdef PORTA
+OLED_PORT(oledPortA, PORTA, DDRA)
+#endif
+#ifdef PORTB
+OLED_PORT(oledPortB, PORTB, DDRB)
+#endif
+#ifdef PORTC
+OLED_PORT(oledPortC, PORTC, DDRC)
+#endif
+#ifdef PORTD
+OLED_PORT(oledPortD, PORTD, DDRD)
+#endif
+#ifdef PORTE
+OLED_PORT(oledPortE, PORTE, DDRE)
+#endif
+#ifdef PORTF
+OLED_PORT(oledPortF, PORTF, DDRF)
+#endif
+#ifdef PORTK
+OLED_PORT(oledPortK, PORTK, DDRK)
+#endif
+#ifdef PORTL
+OLED_PORT(oledPortL, PORTL, DDRL)
+#endif
+
+/*
+ * A single Arduino pin known at compile time. On the ATmega328P family
+ * the port and bit are constants, so low()/high() compile to a single
+ * cbi/sbi. Elsewhere the port is looked up once by output().
+ */
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega328__) || \
+    defined(__AVR_ATmega168__) || defined(__AVR_ATmega168P__) || \
+    defined(__AVR_ATmega88__) || defined(__AVR_ATmega88P__) || \
+    defined(__AVR_ATmega48__) || defined(__AVR_ATmega48P__)
+template <uint8_t PIN>
+struct oledPin {
+    static volatile uint8_t &out() { return PIN < 8 ? PORTD : PIN < 14 ? PORTB : PORTC; }
+    static volatile uint8_t &dir() { return PIN < 8 ? DDRD : PIN < 14 ? DDRB : DDRC; }
+    static const uint8_t mask = 1 << (PIN < 8 ? PIN : PIN < 14 ? PIN - 8 : PIN - 14);
+
+    static void output(void) { dir() |= mask; }
+    static void low(void) { out() &= ~mask; }
+    static void high(void) { out() |= mask; }
+    static uint8_t volatile *port(void) { return &out(); }
+};
+#else
+template <uint8_t PIN>
+struct oledPin {
+    static void output(void) {
+	_port = portOutputRegister(digitalPinToPort(PIN));
+	_mask = digitalPinToBitMask(PIN);
+	pinMode(PIN, OUTPUT);
+    }
+    static void low(void) { pinLow(_port, _mask); }
+    static void high(void) { pinHigh(_port, _mask); }
+    static uint8_t volatile *port(void) { return _port; }
+
+    static uint8_t volatile *_port;
+    static uint8_t _mask;
+    static const uint8_t &mask;
+};
+template <uint8_t PIN> uint8_t volatile *oledPin<PIN>::_port;
+template <uint8_t PIN> uint8_t oledPin<PIN>::_mask;
+template <uint8_t PIN> const uint8_t &oledPin<PIN>::mask = oledPin<PIN>::_mask;
+#endif
+
+/*
+ * Chip select and data/command pins looked up at run time from the
+ * pins passed to the oled256 constructor.
+ */
+class oledRuntimePins {
+public:
+    void beginCs(uint8_t cs) {
+	port_cs = portOutputRegister(digitalPinToPort(cs));
+	pin_cs = digitalPinToBitMask(cs);
+	pinMode(cs, OUTPUT);
+	pinHigh(port_cs, pin_cs);
+    }
+    void beginDc(uint8_t dc) {
+	port_dc = portOutputRegister(digitalPinToPort(dc));
+	pin_dc = digitalPinToBitMask(dc);
+	pinMode(dc, OUTPUT);
+    }
+
+    void csLow(void) { pinLow(port_cs, pin_cs); }
+    void csHigh(void) { pinHigh(port_cs, pin_cs); }
+    void dcLow(void) { pinLow(port_dc, pin_dc); }
+    void dcHigh(void) { pinHigh(port_dc, pin_dc); }
+    uint8_t volatile *csPort(void) { return port_cs; }
+    uint8_t csMask(void) { return pin_cs; }
+
+private:
+    uint8_t volatile *port_cs;
+    uint8_t volatile *port_dc;
+    uint8_t pin_cs;
+    uint8_t pin_dc;
+};
+
+/*
+ * Chip select and data/command pins fixed at compile time, e.g.
+ * oledFixedPins<10, 9>. The pins passed to the oled256 constructor
+ * are ignored.
+ */
+template <uint8_t CS, uint8_t DC>
+class oledFixedPins {
+public:
+    void beginCs(uint8_t) {
+	oledPin<CS>::output();
+	oledPin<CS>::high();
+    }
+    void beginDc(uint8_t) {
+	oledPin<DC>::output();
+    }
+
+    void csLow(void) { oledPin<CS>::low(); }
+    void csHigh(void) { oledPin<CS>::high(); }
+    void dcLow(void) { oledPin<DC>::low(); }
+    void dcHigh(void) { oledPin<DC>::high(); }
+    uint8_t volatile *csPort(void) { return oledPin<CS>::port(); }
+    uint8_t csMask(void) { return oledPin<CS>::mask; }
+};
+
+/*
+ * BS1=0 BS0=0: 4 line SPI, 8-bit data plus DC pin.
+ * The SPI bus must be started (SPI.begin()) by the sketch.
+ */
+template <class PINS = oledRuntimePins>
+class oledBusSpi4 : public PINS {
+public:
+    void begin(uint8_t cs, uint8_t dc) {
+	PINS::beginCs(cs);
+	PINS::beginDc(dc);
+#ifdef OLED_ASYNC
+	tx.begin(PINS::csPort(), PINS::csMask());
+#endif
+    }
+
+    void command(uint8_t reg) {
+	flush();
+	PINS::csLow();
+	PINS::dcLow();
+	SPI.transfer(reg);
+	PINS::csHigh();
+    }
+
+    void data(uint8_t data) {
+	flush();
+	PINS::csLow();
+	PINS::dcHigh();
+	SPI.transfer(data);
+	PINS::csHigh();
+    }
+
+    void startWrite(uint8_t reg) {
+	flush();
+	PINS::csLow();
+	PINS::dcLow();
+	SPI.transfer(reg);
+	PINS::dcHigh();
+    }
+
+    void resumeWrite(void) {
+	flush();
+	PINS::csLow();
+	PINS::dcHigh();
+    }
+
+    void write(uint8_t data) {
+#ifdef OLED_ASYNC
+	tx.put(data);
+#else
+	SPI.transfer(data);
+#endif
+    }
+
+    // With OLED_ASYNC the queue releases CS once the data has gone out.
+    void endWrite(void) {
+#ifdef OLED_ASYNC
+	tx.commit(true);
+#else
+	PINS::csHigh();
+#endif
+    }
+
+    void flush(void) {
+#ifdef OLED_ASYNC
+	tx.flush();
+#endif
+    }
+
+    bool isBusy(void) {
+#ifdef OLED_ASYNC
+	return tx.isBusy();
+#else
+	return false;
+#endif
+    }
+
+    void setCallback(void (*callback)(void)) {
+#ifdef OLED_ASYNC
+	tx.setCallback(callback);
+#else
+	(void)callback;
+#endif
+    }
+
+#ifdef OLED_ASYNC
+private:
+    oledTxQueue tx;
+#endif
+};
+
+/*
+ * BS1=0 BS0=1: 3 line SPI, 9-bit words with DC as the first bit.
+ * The DC pin is not used. Words are packed eight to nine bytes so the
+ * hardware SPI can still be used; a partial trailing byte is padded with
+ * zeros, which the controller discards when CS is raised.
+ */
+template <class PINS = oledRuntimePins>
+class oledBusSpi3 : public PINS {
+public:
+    void begin(uint8_t cs, uint8_t) {
+	PINS::beginCs(cs);
+	bits = 0;
+	nbits = 0;
+    }
+
+    void command(uint8_t reg) {
+	PINS::csLow();
+	shift(reg);
+	endWrite();
+    }
+
+    void data(uint8_t data) {
+	PINS::csLow();
+	shift(0x100 | data);
+	endWrite();
+    }
+
+    void startWrite(uint8_t reg) {
+	PINS::csLow();
+	shift(reg);
+    }
+
+    void resumeWrite(void) {
+	PINS::csLow();
+    }
+
+    void write(uint8_t data) {
+	shift(0x100 | data);
+    }
+
+    void endWrite(void) {
+	if (nbits != 0) {
+	    SPI.transfer((uint8_t)(bits << (8 - nbits)));
+	    bits = 0;
+	    nbits = 0;
+	}
+	PINS::csHigh();
+    }
+
+    void flush(void) {}
+    bool isBusy(void) { return false; }
+    void setCallback(void (*)(void)) {}
+
+private:
+    // append a 9-bit word, sending each byte as it fills
+    void shift(uint16_t word) {
+	bits = (bits << 9) | word;
+	nbits += 1;		// 9 bits in, 8 bits out
+	SPI.transfer((uint8_t)(bits >> nbits));
+	if (nbits == 8) {
+	    SPI.transfer((uint8_t)bits);
+	    nbits = 0;
+	}
+	bits &= (1 << nbits) - 1;
+    }
+
+    uint16_t bits;		// pending bits not yet sent
+    uint8_t nbits;		// number of pending bits (0-7)
+};
+
+/*
+ * BS1=1 BS0=0: 8080 parallel. D0-D7 on the whole of DATA port, data is
+ * latched on the rising edge of #WR (bit WR of CTRL port). #RD must be
+ * tied high.
+ */
+template <class DATA, class CTRL, uint8_t WR, class PINS = oledRuntimePins>
+class oledBus8080 : public PINS {
+public:
+    void begin(uint8_t cs, uint8_t dc) {
+	PINS::beginCs(cs);
+	PINS::beginDc(dc);
+	DATA::dir() = 0xFF;
+	CTRL::out() |= _BV(WR);
+	CTRL::dir() |= _BV(WR);
+    }
+
+    void command(uint8_t reg) {
+	PINS::csLow();
+	PINS::dcLow();
+	strobe(reg);
+	PINS::csHigh();
+    }
+
+    void data(uint8_t data) {
+	PINS::csLow();
+	PINS::dcHigh();
+	strobe(data);
+	PINS::csHigh();
+    }
+
+    void startWrite(uint8_t reg) {
+	PINS::csLow();
+	PINS::dcLow();
+	strobe(reg);
+	PINS::dcHigh();
+    }
+
+    void resumeWrite(void) {
+	PINS::csLow();
+	PINS::dcHigh();
+    }
+
+    void write(uint8_t data) {
+	strobe(data);
+    }
+
+    void endWrite(void) {
+	PINS::csHigh();
+    }
+
+    void flush(void) {}
+    bool isBusy(void) { return false; }
+    void setCallback(void (*)(void)) {}
+
+private:
+    void strobe(uint8_t data) {
+	DATA::out() = data;
+	CTRL::out() &= ~_BV(WR);
+	CTRL::out() |= _BV(WR);
+    }
+};
+
+/*
+ * BS1=1 BS0=1: 6800 parallel. D0-D7 on the whole of DATA port, data is
+ * latched on the falling edge of E (bit E of CTRL port). R/#W must be
+ * tied low.
+ */
+template <class DATA, class CTRL, uint8_t E, class PINS = oledRuntimePins>
+class oledBus6800 : public PINS {
+public:
+    void begin(uint8_t cs, uint8_t dc) {
+	PINS::beginCs(cs);
+	PINS::beginDc(dc);
+	DATA::dir() = 0xFF;
+	CTRL::out() &= ~_BV(E);
+	CTRL::dir() |= _BV(E);
+    }
+
+    void command(uint8_t reg) {
+	PINS::csLow();
+	PINS::dcLow();
+	strobe(reg);
+	PINS::csHigh();
+    }
+
+    void data(uint8_t data) {
+	PINS::csLow();
+	PINS::dcHigh();
+	strobe(data);
+	PINS::csHigh();
+    }
+
+    void startWrite(uint8_t reg) {
+	PINS::csLow();
+	PINS::dcLow();
+	strobe(reg);
+	PINS::dcHigh();
+    }
+
+    void resumeWrite(void) {
+	PINS::csLow();
+	PINS::dcHigh();
+    }
+
+    void write(uint8_t data) {
+	strobe(data);
+    }
+
+    void endWrite(void) {
+	PINS::csHigh();
+    }
+
+    void flush(void) {}
+    bool isBusy(void) { return false; }
+    void setCallback(void (*)(void)) {}
+
+private:
+    void strobe(uint8_t data) {
+	DATA::out() = data;
+	CTRL::out() |= _BV(E);
+	CTRL::out() &= ~_BV(E);
+    }
+};
+
+#endif
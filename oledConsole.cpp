@@ -0,0 +1,471 @@
+/*-
+ * Copyright (c) 2014 Darran Hunt (darran [at] hunt dot net dot nz)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file oledConsole scrolling text console using the display start line
+ */
+
+#include <oledConsole.h>
+
+#define CONSOLE_ESC	1	/* ESC received */
+#define CONSOLE_CSI	2	/* ESC [ received, reading parameters */
+
+#define CONSOLE_ANSI	0x10	/* colour is an ANSI colour, not a grey level */
+
+// grey levels for the luminance of the ANSI colours, the bright ones lifted by 5
+static const uint8_t ansiGrey[16] = {
+    0, 3, 6, 9, 1, 4, 7, 10,	// black, red, green, yellow, blue, magenta, cyan, white
+    5, 8, 11, 14, 6, 9, 12, 15
+};
+
+/**
+ * Create a console. Nothing is drawn until begin().
+ * @param oled - display to draw on
+ */
+oledConsole::oledConsole(oled256 &oled) :
+    _oled(oled)
+{
+    _height = 0;
+    _lines = 0;
+    _cell = 0;
+    _x = 0;
+    _line = 0;
+    _esc = 0;
+    _params = 0;
+    _utf8Len = 0;
+}
+
+/**
+ * Start the console in the display's current font and colours, and
+ * clear the display.
+ */
+void oledConsole::begin(void)
+{
+    _height = _oled.glyphHeight();
+    _lines = LCDHEIGHT / _height;
+    _cell = _oled.glyphWidth('0');
+    _fgDefault = _oled.foreground;
+    _bgDefault = _oled.background;
+    _fg = _fgDefault;
+    _bg = _bgDefault;
+    _bold = false;
+    _dim = false;
+    _reverse = false;
+    _esc = 0;
+    _utf8Len = 0;
+    clear();
+}
+
+/**
+ * Clear the display in the current background and move the cursor to
+ * the top left.
+ */
+void oledConsole::clear(void)
+{
+    colours();
+    _oled.fill(_oled.background);
+    _x = 0;
+    _line = 0;
+}
+
+/**
+ * Write a byte of UTF-8 text or of an escape sequence.
+ * @param ch - byte to write
+ * @returns 1
+ */
+size_t oledConsole::write(uint8_t ch)
+{
+    if (_esc) {
+	escape(ch);
+	return 1;
+    }
+
+    if ((_utf8Len > 0) && ((ch & 0xC0) != 0x80)) {
+	// not a continuation byte, drop the incomplete sequence
+	_utf8Len = 0;
+    }
+    if (ch >= 0x80) {
+	uint16_t code;
+	_utf8[_utf8Len++] = ch;
+	if (oled256::utf8Decode(_utf8, _utf8Len, &code) == 0) {
+	    // wait for the rest of the sequence
+	    return 1;
+	}
+	uint8_t width = _oled.glyphWidth(code);
+	if (_x + width > LCDWIDTH) {
+	    newline();
+	}
+	draw(_utf8, _utf8Len, width);
+	_utf8Len = 0;
+	return 1;
+    }
+
+    switch (ch) {
+    case '\n':
+	newline();
+	break;
+    case '\r':
+	_x = 0;
+	break;
+    case '\b':
+	_x = (_x > _cell) ? _x - _cell : 0;
+	break;
+    case 0x1B:
+	_esc = CONSOLE_ESC;
+	break;
+    default:
+	if ((ch >= ' ') && (ch < 0x7F)) {
+	    uint8_t width = _oled.glyphWidth(ch);
+	    if (_x + width > LCDWIDTH) {
+		newline();
+	    }
+	    draw((const char *)&ch, 1, width);
+	}
+	break;
+    }
+    return 1;
+}
+
+/**
+ * Write text. Runs of printable ascii that fit on the line are drawn
+ * together, everything else goes through write(uint8_t).
+ * @param buf - text to write
+ * @param size - number of bytes
+ * @returns number of bytes written
+ */
+size_t oledConsole::write(const uint8_t *buf, size_t size)
+{
+    size_t count = size;
+
+    while (size > 0) {
+	uint8_t len = 0;
+	uint16_t width = 0;
+	if ((_esc == 0) && (_utf8Len == 0)) {
+	    while ((len < size) && (len < 255) && (buf[len] >= ' ') && (buf[len] < 0x7F)) {
+		uint8_t advance = _oled.glyphWidth(buf[len]);
+		if (_x + width + advance > LCDWIDTH) {
+		    break;
+		}
+		width += advance;
+		len++;
+	    }
+	}
+	if (len == 0) {
+	    // control character, escape sequence, UTF-8 or wrapping
+	    write(*buf);
+	    len = 1;
+	} else {
+	    draw((const char *)buf, len, width);
+	}
+	buf += len;
+	size -= len;
+    }
+
+    return count;
+}
+
+/**
+ * Move the cursor to the start of the next line. On the last line the
+ * display scrolls up a line and only the rows scrolled in are cleared.
+ */
+void oledConsole::newline(void)
+{
+    _x = 0;
+    if (_line + 1 < _lines) {
+	_line++;
+	return;
+    }
+
+    _oled.scroll(_height);
+
+    // the new last line and any rows below it
+    rect_t band[2];
+    uint8_t y = (_lines - 1) * _height;
+    colours();
+    for (uint8_t ind=0, count=bands(y, LCDHEIGHT - y, band); ind < count; ind++) {
+	_oled.fillRect(band[ind].x, band[ind].y, band[ind].width, band[ind].height, _oled.background);
+    }
+}
+
+/**
+ * Split rows of the display where they wrap from the end of the
+ * controller's RAM to the start, as a draw can't cross it.
+ * @param y - first row
+ * @param height - rows
+ * @param band - set to the full width bands to draw in
+ * @returns number of bands, 1 or 2
+ */
+uint8_t oledConsole::bands(uint8_t y, uint8_t height, rect_t *band)
+{
+    uint8_t wrap = _oled.wrapRow();
+
+    band[0].x = 0;
+    band[0].y = y;
+    band[0].width = LCDWIDTH;
+    band[0].height = height;
+    if ((y < wrap) && (wrap < y + height)) {
+	band[0].height = wrap - y;
+	band[1].x = 0;
+	band[1].y = wrap;
+	band[1].width = LCDWIDTH;
+	band[1].height = y + height - wrap;
+	return 2;
+    }
+    return 1;
+}
+
+/**
+ * Draw text at the cursor and move the cursor past it.
+ * @param str - text, which fits on the line
+ * @param len - number of bytes
+ * @param width - width of the text in pixels
+ */
+void oledConsole::draw(const char *str, uint8_t len, uint16_t width)
+{
+    rect_t band[2];
+
+    colours();
+    for (uint8_t ind=0, count=bands(_line * _height, _height, band); ind < count; ind++) {
+	bool clipped = _oled.pushClip(band[ind]);
+	_oled.drawString(_x, _line * _height, str, len);
+	if (clipped) {
+	    _oled.popClip();
+	}
+    }
+    _x += width;
+}
+
+/**
+ * Clear part of a line in the current background.
+ * @param line - text line
+ * @param x - first pixel column
+ * @param xend - pixel column after the last
+ */
+void oledConsole::erase(uint8_t line, uint16_t x, uint16_t xend)
+{
+    rect_t band[2];
+
+    if (xend > LCDWIDTH) {
+	xend = LCDWIDTH;
+    }
+    if (x >= xend) {
+	return;
+    }
+    colours();
+    for (uint8_t ind=0, count=bands(line * _height, _height, band); ind < count; ind++) {
+	_oled.fillRect(x, band[ind].y, xend - x, band[ind].height, _oled.background);
+    }
+}
+
+/**
+ * Handle a byte of an escape sequence.
+ * @param ch - byte following ESC
+ */
+void oledConsole::escape(uint8_t ch)
+{
+    if (_esc == CONSOLE_ESC) {
+	if (ch == '[') {
+	    _esc = CONSOLE_CSI;
+	    _params = 0;
+	    memset(_param, 0, sizeof(_param));
+	} else {
+	    // not supported
+	    _esc = 0;
+	}
+	return;
+    }
+
+    if ((ch >= '0') && (ch <= '9')) {
+	if (_params < OLED_CONSOLE_PARAMS) {
+	    uint16_t value = _param[_params] * 10 + (ch - '0');
+	    _param[_params] = (value > 255) ? 255 : value;
+	}
+	return;
+    }
+    if (ch == ';') {
+	if (_params < OLED_CONSOLE_PARAMS) {
+	    _params++;
+	}
+	return;
+    }
+    if ((ch < 0x40) || (ch > 0x7E)) {
+	// intermediate and private marker bytes
+	return;
+    }
+
+    _esc = 0;
+    if (_params < OLED_CONSOLE_PARAMS) {
+	_params++;
+    }
+
+    uint8_t count = _param[0] ? _param[0] : 1;
+    uint16_t move = count * _cell;
+
+    switch (ch) {
+    case 'A':
+	_line = (_line > count) ? _line - count : 0;
+	break;
+    case 'B':
+	_line = (_line + count < _lines) ? _line + count : _lines - 1;
+	break;
+    case 'C':
+	_x = (_x + move < LCDWIDTH) ? _x + move : LCDWIDTH;
+	break;
+    case 'D':
+	_x = (_x > move) ? _x - move : 0;
+	break;
+    case 'G':
+	_x = (move - _cell < LCDWIDTH) ? move - _cell : LCDWIDTH;
+	break;
+    case 'H':
+    case 'f':
+	_line = (count - 1 < _lines) ? count - 1 : _lines - 1;
+	move = (_param[1] ? _param[1] - 1 : 0) * _cell;
+	_x = (move < LCDWIDTH) ? move : LCDWIDTH;
+	break;
+    case 'K':
+	if (_param[0] == 0) {
+	    erase(_line, _x, LCDWIDTH);
+	} else if (_param[0] == 1) {
+	    erase(_line, 0, _x + _cell);
+	} else if (_param[0] == 2) {
+	    erase(_line, 0, LCDWIDTH);
+	}
+	break;
+    case 'J':
+	if (_param[0] == 0) {
+	    erase(_line, _x, LCDWIDTH);
+	    for (uint8_t line=_line+1; line < _lines; line++) {
+		erase(line, 0, LCDWIDTH);
+	    }
+	} else if (_param[0] == 1) {
+	    for (uint8_t line=0; line < _line; line++) {
+		erase(line, 0, LCDWIDTH);
+	    }
+	    erase(_line, 0, _x + _cell);
+	} else if (_param[0] == 2) {
+	    colours();
+	    _oled.fill(_oled.background);
+	}
+	break;
+    case 'm':
+	sgr();
+	break;
+    }
+}
+
+/**
+ * Apply an SGR (select graphic rendition) sequence. Colours become
+ * grey levels.
+ */
+void oledConsole::sgr(void)
+{
+    for (uint8_t ind=0; ind < _params; ind++) {
+	uint8_t code = _param[ind];
+
+	if ((code == 38) || (code == 48)) {
+	    // 256 colour palette: ANSI colours, a 6x6x6 cube and a grey ramp
+	    if ((ind + 2 >= _params) || (_param[ind+1] != 5)) {
+		return;
+	    }
+	    uint8_t colour = _param[ind+2];
+	    uint8_t grey;
+	    if (colour < 16) {
+		grey = CONSOLE_ANSI | colour;
+	    } else if (colour < 232) {
+		colour -= 16;
+		grey = (30 * (colour / 36) + 59 * (colour / 6 % 6) + 11 * (colour % 6)) * 15 / 500;
+	    } else {
+		grey = (colour - 232) * 15 / 23;
+	    }
+	    if (code == 38) {
+		_fg = grey;
+	    } else {
+		_bg = grey;
+	    }
+	    ind += 2;
+	} else if (code == 0) {
+	    _fg = _fgDefault;
+	    _bg = _bgDefault;
+	    _bold = false;
+	    _dim = false;
+	    _reverse = false;
+	} else if (code == 1) {
+	    _bold = true;
+	} else if (code == 2) {
+	    _dim = true;
+	} else if (code == 7) {
+	    _reverse = true;
+	} else if (code == 22) {
+	    _bold = false;
+	    _dim = false;
+	} else if (code == 27) {
+	    _reverse = false;
+	} else if ((code >= 30) && (code <= 37)) {
+	    _fg = CONSOLE_ANSI | (code - 30);
+	} else if (code == 39) {
+	    _fg = _fgDefault;
+	} else if ((code >= 40) && (code <= 47)) {
+	    _bg = CONSOLE_ANSI | (code - 40);
+	} else if (code == 49) {
+	    _bg = _bgDefault;
+	} else if ((code >= 90) && (code <= 97)) {
+	    _fg = CONSOLE_ANSI | (code - 90 + 8);
+	} else if ((code >= 100) && (code <= 107)) {
+	    _bg = CONSOLE_ANSI | (code - 100 + 8);
+	}
+    }
+}
+
+/**
+ * Set the display colours from the SGR state.
+ */
+void oledConsole::colours(void)
+{
+    uint8_t fg = _fg;
+    uint8_t bg = _bg;
+
+    if (fg & CONSOLE_ANSI) {
+	// bold brightens the normal ANSI colours
+	fg &= 0x0F;
+	fg = ansiGrey[(_bold && (fg < 8)) ? fg + 8 : fg];
+    }
+    if (bg & CONSOLE_ANSI) {
+	bg = ansiGrey[bg & 0x0F];
+    }
+    if (_dim) {
+	fg = (fg + bg) / 2;
+    }
+    if (_reverse) {
+	uint8_t swap = fg;
+	fg = bg;
+	bg = swap;
+    }
+    if ((fg != _oled.foreground) || (bg != _oled.background)) {
+	_oled.setColour(fg);
+	_oled.setBackground(bg);
+    }
+}
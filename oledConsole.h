@@ -0,0 +1,102 @@
+/*-
+ * Copyright (c) 2014 Darran Hunt (darran [at] hunt dot net dot nz)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef OLEDCONSOLE_H_
+#define OLEDCONSOLE_H_
+
+#include "oled256.h"
+
+/*
+ * A scrolling text console, such as a log tail.
+ *
+ * Text lines are kept in the controller's 128 RAM rows as a ring.
+ * A new line at the bottom scrolls the display by moving the display
+ * start line, then clears and draws only that line, instead of
+ * redrawing the whole screen.
+ *
+ * A small subset of ANSI escape sequences is understood:
+ *   ESC[nA ESC[nB ESC[nC ESC[nD	cursor up, down, forward and back
+ *   ESC[r;cH ESC[r;cf ESC[nG	cursor position and column
+ *   ESC[nK				erase line: 0 to the end, 1 from the start, 2 all
+ *   ESC[nJ				erase screen: 0 to the end, 1 from the start, 2 all
+ *   ESC[...m			grey levels: 0, 1, 2, 7, 22, 27, 30-39, 40-49,
+ *					90-97, 100-107, 38;5;n and 48;5;n
+ * Columns are the width of '0' in the font. Anything else is ignored.
+ *
+ * The console draws in the display's font at begin(). It shares the
+ * display, so other drawing must allow for oled256::scroll().
+ */
+
+#ifndef OLED_CONSOLE_PARAMS
+#define OLED_CONSOLE_PARAMS	4	/* numbers kept from an escape sequence */
+#endif
+
+class oledConsole : public Print {
+public:
+    oledConsole(oled256 &oled);
+    void begin(void);
+    void clear(void);
+    virtual size_t write(uint8_t ch);
+    virtual size_t write(const uint8_t *buf, size_t size);
+    using Print::write;
+
+private:
+    oled256 &_oled;
+    uint8_t _height;		// text line height in pixels
+    uint8_t _lines;		// text lines on the display
+    uint8_t _cell;		// column width for cursor movement
+
+    uint16_t _x;		// cursor pixel column
+    uint8_t _line;		// cursor text line
+
+    // colours from the SGR escape sequence
+    uint8_t _fgDefault;
+    uint8_t _bgDefault;
+    uint8_t _fg;		// grey level, or 0x10 + ANSI colour 0-7 to follow bold
+    uint8_t _bg;
+    bool _bold;
+    bool _dim;
+    bool _reverse;
+
+    // escape sequence being received
+    uint8_t _esc;		// 0, ESC seen, or in a CSI sequence
+    uint8_t _param[OLED_CONSOLE_PARAMS];
+    uint8_t _params;
+
+    // bytes of a UTF-8 sequence
+    char _utf8[4];
+    uint8_t _utf8Len;
+
+    void newline(void);
+    void escape(uint8_t ch);
+    void sgr(void);
+    void colours(void);
+    uint8_t bands(uint8_t y, uint8_t height, rect_t *band);
+    void erase(uint8_t line, uint16_t x, uint16_t xend);
+    void draw(const char *str, uint8_t len, uint16_t width);
+};
+
+#endif
@@ -0,0 +1,274 @@
+/*-
+ * Copyright (c) 2014 Darran Hunt (darran [at] hunt dot net dot nz)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file oledField text field that redraws only what changed
+ */
+
+#include <oledField.h>
+
+/**
+ * Create a field. Nothing is drawn until the first update().
+ * @param oled - display to draw on
+ * @param x - left edge of the field
+ * @param y - top of the field
+ * @param width - width of the field in pixels, text beyond it is dropped
+ * @param align - OLED_ALIGN_LEFT, OLED_ALIGN_CENTRE or OLED_ALIGN_RIGHT
+ */
+oledField::oledField(oled256 &oled, uint16_t x, uint8_t y, uint16_t width, uint8_t align) :
+    _oled(oled)
+{
+    _x = x;
+    _y = y;
+    _width = width;
+    _align = align;
+    _text[0] = '\0';
+    _start = x;
+    _end = x;
+    _height = 0;
+    _colours = 0;
+}
+
+/**
+ * Forget what the field shows, so the next update() clears the field
+ * and draws all of its text.
+ */
+void oledField::invalidate(void)
+{
+    _height = 0;
+}
+
+/**
+ * Show a number in the field.
+ * @param value - number to show
+ * @returns number of glyphs drawn
+ */
+uint8_t oledField::update(long value)
+{
+    char buf[12];
+    char *str = &buf[sizeof(buf) - 1];
+    unsigned long digits = (value < 0) ? -(unsigned long)value : value;
+
+    *str = '\0';
+    do {
+	*--str = '0' + digits % 10;
+	digits /= 10;
+    } while (digits != 0);
+    if (value < 0) {
+	*--str = '-';
+    }
+    return update(str);
+}
+
+/**
+ * Show a UTF-8 string in the field, drawing only the glyphs that
+ * differ from what is on the display. Glyphs are compared by character
+ * and position, so glyphs that move because the text got wider or
+ * narrower are redrawn too. Adjacent glyphs that need drawing are sent
+ * together.
+ * @param str - text to show
+ * @returns number of glyphs drawn
+ */
+uint8_t oledField::update(const char *str)
+{
+    uint8_t height = _oled.glyphHeight();
+    uint8_t colours = (_oled.foreground << 4) | (_oled.background & 0x0F);
+    char text[OLED_FIELD_MAX+1];
+    uint16_t width = 0;
+    uint8_t len = 0;
+    uint8_t drawn = 0;
+
+    if ((height != _height) || (colours != _colours)) {
+	// what is on the display can't be reused
+	_oled.fillRect(_x, _y, _width, (height > _height) ? height : _height, _oled.background);
+	_text[0] = '\0';
+	_start = _x;
+	_end = _x;
+	_height = height;
+	_colours = colours;
+    }
+
+    // measure the whole characters that fit
+    while (str[len]) {
+	uint16_t ch;
+	uint8_t bytes = oled256::utf8Decode(&str[len], 4, &ch);
+	uint8_t advance = _oled.glyphWidth(ch);
+	if ((len + bytes > OLED_FIELD_MAX) || (width + advance > _width)) {
+	    break;
+	}
+	width += advance;
+	len += bytes;
+    }
+    memcpy(text, str, len);
+    text[len] = '\0';
+
+    uint16_t start = _x;
+    if (_align & OLED_ALIGN_CENTRE) {
+	start += (_width - width) / 2;
+    } else if (_align & OLED_ALIGN_RIGHT) {
+	start += _width - width;
+    }
+
+    // find the glyphs whose character or position changed
+    uint8_t index[OLED_FIELD_MAX+1];	// byte offset of each glyph, and of the end
+    uint16_t pos[OLED_FIELD_MAX+1];	// x of each glyph, and of the end
+    bool changed[OLED_FIELD_MAX];
+    uint8_t count = 0;
+    uint16_t oldX = _start;
+    uint8_t oldInd = 0;
+    uint16_t newX = start;
+    uint8_t newInd = 0;
+
+    while (text[newInd]) {
+	uint16_t ch;
+	uint8_t bytes = oled256::utf8Decode(&text[newInd], 4, &ch);
+	bool same = false;
+
+	while (_text[oldInd] && (oldX <= newX)) {
+	    uint16_t oldCh;
+	    uint8_t oldBytes = oled256::utf8Decode(&_text[oldInd], 4, &oldCh);
+	    if (oldX == newX) {
+		same = (oldCh == ch);
+		break;
+	    }
+	    oldX += _oled.glyphWidth(oldCh);
+	    oldInd += oldBytes;
+	}
+	index[count] = newInd;
+	pos[count] = newX;
+	changed[count] = !same;
+	count++;
+	newX += _oled.glyphWidth(ch);
+	newInd += bytes;
+    }
+    index[count] = newInd;
+    pos[count] = newX;
+
+    // what to redraw, left to right: the old text left of the new, the
+    // runs of changed glyphs, and the old text right of the new
+    int16_t from[OLED_FIELD_MAX/2 + 3];
+    int16_t to[OLED_FIELD_MAX/2 + 3];
+    uint8_t spans = 0;
+
+    if (_start < start) {
+	from[spans] = _start;
+	to[spans++] = (_end < start) ? _end : start;
+    }
+    for (uint8_t ind=0; ind < count; ) {
+	if (!changed[ind]) {
+	    ind++;
+	    continue;
+	}
+	uint8_t first = ind;
+	while ((ind < count) && changed[ind]) {
+	    ind++;
+	}
+	from[spans] = pos[first];
+	to[spans++] = pos[ind];
+	drawn += ind - first;
+    }
+    if (_end > newX) {
+	from[spans] = (_start > newX) ? _start : newX;
+	to[spans++] = _end;
+    }
+
+    for (uint8_t ind=0; ind < spans; ) {
+	int16_t left = from[ind];
+	int16_t right = to[ind++];
+#ifndef OLED_FRAMEBUFFER
+	/*
+	 * Without a frame buffer the pixels of a column group shared with
+	 * an unchanged glyph can't be read back, so redraw whole groups,
+	 * and spans that then meet together.
+	 */
+	left &= ~3;
+	right = (right + 3) & ~3;
+	while ((ind < spans) && ((from[ind] & ~3) <= right)) {
+	    right = (to[ind++] + 3) & ~3;
+	}
+#endif
+	drawSpan(left, right, text, index, pos, count);
+    }
+
+    memcpy(_text, text, len + 1);
+    _start = start;
+    _end = newX;
+    return drawn;
+}
+
+/**
+ * Redraw the columns from left to right of the field with the new text.
+ * Glyphs that are partly in the span are cut to it, and the columns the
+ * text doesn't reach are cleared.
+ * @param left - first column
+ * @param right - column after the last
+ * @param text - the new text
+ * @param index - byte offset of each glyph in text, and of the end
+ * @param pos - x of each glyph, and of the end
+ * @param count - number of glyphs
+ */
+void oledField::drawSpan(int16_t left, int16_t right, const char *text, const uint8_t *index,
+			 const uint16_t *pos, uint8_t count)
+{
+    if (left < (int16_t)_x) {
+	left = _x;
+    }
+    if (right > (int16_t)(_x + _width)) {
+	right = _x + _width;
+    }
+    if (left >= right) {
+	return;
+    }
+
+    // the glyphs in the span, and the one after whose ink can start left of its cell
+    uint8_t first = 0;
+    while ((first < count) && ((int16_t)pos[first+1] <= left)) {
+	first++;
+    }
+    uint8_t end = first;
+    while ((end < count) && ((int16_t)pos[end] < right)) {
+	end++;
+    }
+    if (end < count) {
+	end++;
+    }
+
+    rect_t clip = { left, (int16_t)_y, (uint16_t)(right - left), _height };
+    bool clipped = _oled.pushClip(clip);
+    if (left < (int16_t)pos[0]) {
+	int16_t fillEnd = (right < (int16_t)pos[0]) ? right : pos[0];
+	_oled.fillRect(left, _y, fillEnd - left, _height, _oled.background);
+    }
+    if (first < end) {
+	_oled.drawStringCells(pos[first], _y, &text[index[first]], index[end] - index[first]);
+    }
+    if (right > (int16_t)pos[count]) {
+	int16_t fillStart = (left > (int16_t)pos[count]) ? left : pos[count];
+	_oled.fillRect(fillStart, _y, right - fillStart, _height, _oled.background);
+    }
+    if (clipped) {
+	_oled.popClip();
+    }
+}
@@ -0,0 +1,74 @@
+/*-
+ * Copyright (c) 2014 Darran Hunt (darran [at] hunt dot net dot nz)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef OLEDFIELD_H_
+#define OLEDFIELD_H_
+
+#include "oled256.h"
+
+/*
+ * A line of text at a fixed place on the display, such as a counter or
+ * a reading.
+ *
+ * The field remembers the text it last drew. update() redraws only the
+ * glyphs whose character or position changed, and clears whatever the
+ * new text no longer covers. A counter going from 1299 to 1300 redraws
+ * three glyphs, and one going from 1300 to 1301 redraws one. Without
+ * OLED_FRAMEBUFFER the neighbours of a changed glyph are redrawn too,
+ * but only in the column groups they share with it.
+ *
+ * Fields draw in the display's current font and colours. A change of
+ * colours is noticed, but call invalidate() after changing the font.
+ */
+
+#ifndef OLED_FIELD_MAX
+#define OLED_FIELD_MAX	16	/* bytes of text a field holds */
+#endif
+
+class oledField {
+public:
+    oledField(oled256 &oled, uint16_t x, uint8_t y, uint16_t width, uint8_t align=OLED_ALIGN_RIGHT);
+    uint8_t update(const char *str);
+    uint8_t update(long value);
+    void invalidate(void);
+
+private:
+    oled256 &_oled;
+    uint16_t _x;
+    uint8_t _y;
+    uint16_t _width;
+    uint8_t _align;
+
+    char _text[OLED_FIELD_MAX+1];	// text on the display
+    uint16_t _start;		// where the text starts and ends
+    uint16_t _end;
+    uint8_t _height;		// font height it was drawn in, 0 to redraw everything
+    uint8_t _colours;		// foreground and background nibbles it was drawn in
+
+    void drawSpan(int16_t left, int16_t right, const char *text, const uint8_t *index,
+		  const uint16_t *pos, uint8_t count);
+};
+
+#endif
@@ -0,0 +1,403 @@
+/*-
+ * Copyright (c) 2014 Darran Hunt (darran [at] hunt dot net dot nz)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file oledFont 1bpp fonts read from external storage
+ */
+
+#include <oled256.h>
+
+#ifdef OLED_FONT_SOURCE
+
+#define FONT_HEAD_SIZE	12	/* bytes before the width table */
+
+/**
+ * Read the header of a font image and empty the glyph cache.
+ * @param source - storage holding the image
+ * @param base - address of the image in the storage
+ * @returns false if the image could not be read, is not a font or
+ *          has glyphs too big for OLED_FONT_GLYPH_BYTES
+ */
+bool oledFont::begin(oledFontSource *source, uint32_t base)
+{
+    uint8_t head[FONT_HEAD_SIZE];
+
+    _source = source;
+    _base = base;
+    _aheadAddr = 0;
+    _aheadLen = 0;
+    _clock = 0;
+    _hits = 0;
+    _misses = 0;
+    _reads = 1;
+    for (uint8_t ind=0; ind<OLED_FONT_SLOTS; ind++) {
+	_slot[ind].index = 0xFFFF;
+    }
+
+    // an empty font until the header has been checked, nothing can be read
+    _size = 0;
+    _storeWidth = 0;
+    _height = 0;
+    _fixedWidth = 0;
+    _beg = 0;
+    _end = 0;
+    _def = 0;
+    _cmapSize = 0;
+
+    if (!source->read(base, head, sizeof(head)) ||
+	(head[0] != 'O') || (head[1] != 'F') || (head[2] != '1') || (head[3] != 0) ||
+	(head[8] < head[7]) || (head[9] < head[7]) || (head[9] > head[8]) ||
+	(head[4] > 4) || ((uint16_t)head[4] * head[5] > OLED_FONT_GLYPH_BYTES)) {
+	// glyphs are drawn by monoDraw(), at most 32 pixels wide
+	return false;
+    }
+    _storeWidth = head[4];
+    _height = head[5];
+    _fixedWidth = (head[6] > _storeWidth * 8) ? _storeWidth * 8 : head[6];
+    _beg = head[7];
+    _end = head[8];
+    _def = head[9];
+    _cmapSize = head[10] | (head[11] << 8);
+
+    _cmap = FONT_HEAD_SIZE + ((_fixedWidth == 0) ? _end - _beg + 1 : 0);
+    _glyphs = _cmap + (uint32_t)_cmapSize * 3;
+    _size = _glyphs + (uint32_t)(_end - _beg + 1) * _storeWidth * _height;
+    return true;
+}
+
+/**
+ * Get the height of the font. All characters are the same height.
+ * @returns height of the glyphs
+ */
+uint8_t oledFont::height(void)
+{
+    return _height;
+}
+
+/**
+ * Get the number of bytes in each row of a glyph.
+ * @returns bytes per glyph row
+ */
+uint8_t oledFont::stride(void)
+{
+    return _storeWidth;
+}
+
+/**
+ * Work out the width of a character, without reading its glyph.
+ * @param ch - character (unicode code point)
+ * @returns width of the glyph
+ */
+uint8_t oledFont::advance(uint16_t ch)
+{
+    uint8_t width = _fixedWidth;
+
+    if ((width == 0) && !fetch(FONT_HEAD_SIZE + index(ch), &width, 1)) {
+	return 0;
+    }
+    return (width > _storeWidth * 8) ? _storeWidth * 8 : width;
+}
+
+/**
+ * Get a glyph, reading it from the storage if it is not cached.
+ * The glyph data stays valid until the next glyph() or prefetch().
+ * @param ch - character (unicode code point)
+ * @param width - set to the width of the glyph, can be NULL
+ * @returns glyph rows, store_width bytes each, msb is the leftmost pixel
+ */
+const uint8_t *oledFont::glyph(uint16_t ch, uint8_t *width)
+{
+    uint8_t ind = index(ch);
+    uint8_t slot = find(ind);
+
+    if (slot < OLED_FONT_SLOTS) {
+	_hits++;
+    } else {
+	slot = load(ind);
+    }
+    _slot[slot].used = ++_clock;
+    if (width != NULL) {
+	*width = _slot[slot].width;
+    }
+    return _slot[slot].data;
+}
+
+/**
+ * Read the glyphs of a string into the cache before drawing it. Glyphs
+ * that are missing are read in the order they are stored, so glyphs
+ * next to each other in the font come from one read.
+ * Stops at a control character or a byte that is not ascii, or once
+ * the cache is full of the string's glyphs.
+ * @param str - characters about to be drawn
+ * @param len - number of characters
+ * @returns number of characters whose glyphs are all in the cache
+ */
+uint8_t oledFont::prefetch(const char *str, uint8_t len)
+{
+    uint8_t want[OLED_FONT_SLOTS];	// glyphs to read, sorted
+    uint8_t wanted = 0;
+    uint8_t held = 0;			// glyphs of the string already cached
+    uint16_t start = _clock;
+    uint8_t count;
+
+    for (count=0; count<len; count++) {
+	uint8_t ch = str[count];
+	if ((ch < ' ') || (ch >= 0x80)) {
+	    break;
+	}
+
+	uint8_t ind = index(ch);
+	uint8_t slot = find(ind);
+	if (slot < OLED_FONT_SLOTS) {
+	    if ((uint16_t)(_clock - _slot[slot].used) >= (uint16_t)(_clock - start)) {
+		if (held + wanted == OLED_FONT_SLOTS) {
+		    break;
+		}
+		// keep it from being replaced by the glyphs read below
+		_slot[slot].used = ++_clock;
+		held++;
+	    }
+	    continue;
+	}
+
+	uint8_t pos = wanted;
+	while ((pos > 0) && (want[pos-1] >= ind)) {
+	    pos--;
+	}
+	if ((pos < wanted) && (want[pos] == ind)) {
+	    continue;
+	}
+	if (held + wanted == OLED_FONT_SLOTS) {
+	    break;
+	}
+	memmove(&want[pos+1], &want[pos], wanted - pos);
+	want[pos] = ind;
+	wanted++;
+    }
+
+    // claim every slot first, then read all the widths and all the rows,
+    // each in the order they are stored
+    for (uint8_t ind=0; ind<wanted; ind++) {
+	want[ind] = claim(want[ind]);
+    }
+    for (uint8_t ind=0; ind<wanted; ind++) {
+	loadWidth(want[ind]);
+    }
+    for (uint8_t ind=0; ind<wanted; ind++) {
+	loadRows(want[ind]);
+    }
+    return count;
+}
+
+/**
+ * Get the number of glyphs found in the cache.
+ * @returns cache hits since begin()
+ */
+uint32_t oledFont::getHits(void)
+{
+    return _hits;
+}
+
+/**
+ * Get the number of glyphs read from the storage.
+ * @returns cache misses since begin()
+ */
+uint32_t oledFont::getMisses(void)
+{
+    return _misses;
+}
+
+/**
+ * Get the number of reads made from the storage.
+ * @returns reads since begin(), including the header
+ */
+uint32_t oledFont::getReads(void)
+{
+    return _reads;
+}
+
+/**
+ * Read bytes of the font image. Small reads are served from the
+ * read-ahead buffer, which is refilled from addr when it does not hold
+ * them.
+ * @param addr - offset into the image
+ * @param buf - buffer for the bytes
+ * @param len - number of bytes
+ * @returns true if the bytes were read
+ */
+bool oledFont::fetch(uint32_t addr, uint8_t *buf, uint16_t len)
+{
+    if ((addr >= _aheadAddr) && (addr + len <= _aheadAddr + _aheadLen)) {
+	memcpy(buf, &_ahead[addr - _aheadAddr], len);
+	return true;
+    }
+    if (addr + len > _size) {
+	return false;
+    }
+
+    _reads++;
+    if (len > sizeof(_ahead)) {
+	return _source->read(_base + addr, buf, len);
+    }
+    _aheadAddr = addr;
+    _aheadLen = (_size - addr < sizeof(_ahead)) ? _size - addr : sizeof(_ahead);
+    if (!_source->read(_base + addr, _ahead, _aheadLen)) {
+	_aheadLen = 0;
+	return false;
+    }
+    memcpy(buf, _ahead, len);
+    return true;
+}
+
+/**
+ * Find the glyph table index of a character, using the code point
+ * table for characters outside glyph_beg..glyph_end.
+ * @param ch - character (unicode code point)
+ * @returns index of the character's glyph, or of glyph_def if the
+ *          font does not have it
+ */
+uint8_t oledFont::index(uint16_t ch)
+{
+    uint16_t low = 0;
+    uint16_t high = _cmapSize;
+
+    if ((ch >= _beg) && (ch <= _end)) {
+	return ch - _beg;
+    }
+
+    // binary search
+    while (low < high) {
+	uint16_t mid = (low + high) / 2;
+	uint8_t entry[3];
+	if (!fetch(_cmap + (uint32_t)mid * 3, entry, sizeof(entry))) {
+	    break;
+	}
+	uint16_t code = entry[0] | (entry[1] << 8);
+	if (code == ch) {
+	    if ((entry[2] >= _beg) && (entry[2] <= _end)) {
+		return entry[2] - _beg;
+	    }
+	    break;
+	}
+	if (code < ch) {
+	    low = mid + 1;
+	} else {
+	    high = mid;
+	}
+    }
+    return _def - _beg;
+}
+
+/**
+ * Find a glyph in the cache.
+ * @param index - glyph table index
+ * @returns slot holding the glyph, OLED_FONT_SLOTS if it is not cached
+ */
+uint8_t oledFont::find(uint8_t index)
+{
+    for (uint8_t slot=0; slot<OLED_FONT_SLOTS; slot++) {
+	if (_slot[slot].index == index) {
+	    return slot;
+	}
+    }
+    return OLED_FONT_SLOTS;
+}
+
+/**
+ * Read a glyph into the least recently used slot of the cache.
+ * @param index - glyph table index
+ * @returns slot holding the glyph
+ */
+uint8_t oledFont::load(uint8_t index)
+{
+    uint8_t slot = claim(index);
+
+    loadWidth(slot);
+    loadRows(slot);
+    return slot;
+}
+
+/**
+ * Take the least recently used slot of the cache for a glyph, ready
+ * for loadWidth() and loadRows().
+ * @param index - glyph table index
+ * @returns slot for the glyph
+ */
+uint8_t oledFont::claim(uint8_t index)
+{
+    uint8_t slot = 0;
+
+    for (uint8_t ind=1; ind<OLED_FONT_SLOTS; ind++) {
+	if (_slot[slot].index == 0xFFFF) {
+	    break;
+	}
+	if ((_slot[ind].index == 0xFFFF) ||
+	    ((uint16_t)(_clock - _slot[ind].used) > (uint16_t)(_clock - _slot[slot].used))) {
+	    slot = ind;
+	}
+    }
+
+    _misses++;
+    _slot[slot].index = index;
+    _slot[slot].width = _fixedWidth;
+    _slot[slot].used = ++_clock;
+    return slot;
+}
+
+/**
+ * Read the width of the glyph in a slot from the width table.
+ * A glyph that cannot be read is left blank and not kept.
+ * @param slot - slot from claim()
+ */
+void oledFont::loadWidth(uint8_t slot)
+{
+    if ((_fixedWidth == 0) && (_slot[slot].index != 0xFFFF) &&
+	!fetch(FONT_HEAD_SIZE + _slot[slot].index, &_slot[slot].width, 1)) {
+	memset(_slot[slot].data, 0, sizeof(_slot[slot].data));
+	_slot[slot].index = 0xFFFF;
+    }
+    if (_slot[slot].width > _storeWidth * 8) {
+	// a width the glyph rows don't have
+	_slot[slot].width = _storeWidth * 8;
+    }
+}
+
+/**
+ * Read the rows of the glyph in a slot from the glyph table.
+ * A glyph that cannot be read is left blank and not kept.
+ * @param slot - slot from claim()
+ */
+void oledFont::loadRows(uint8_t slot)
+{
+    uint16_t bytes = (uint16_t)_storeWidth * _height;
+
+    if ((_slot[slot].index != 0xFFFF) &&
+	!fetch(_glyphs + (uint32_t)_slot[slot].index * bytes, _slot[slot].data, bytes)) {
+	memset(_slot[slot].data, 0, sizeof(_slot[slot].data));
+	_slot[slot].index = 0xFFFF;
+    }
+}
+
+#endif
@@ -0,0 +1,133 @@
+/*-
+ * Copyright (c) 2014 Darran Hunt (darran [at] hunt dot net dot nz)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef OLEDFONT_H_
+#define OLEDFONT_H_
+
+#include "Arduino.h"
+
+/*
+ * 1bpp fonts kept in external storage instead of flash.
+ *
+ * Glyphs are read through an oledFontSource when they are drawn and kept
+ * in a small RAM cache. Small reads go through a read-ahead buffer, and
+ * the missing glyphs of a string are fetched in the order they are
+ * stored, so glyphs stored close together, such as digits, share reads.
+ *
+ * A font image holds the same tables as a FONT_DEF, all multibyte
+ * values little endian:
+ *   0	'O', 'F', '1', 0	magic
+ *   4	store_width		bytes per glyph row, at most 4
+ *   5	glyph_height
+ *   6	fixed_width		0 if there is a width table
+ *   7	glyph_beg		first character in the glyph table
+ *   8	glyph_end		last character in the glyph table
+ *   9	glyph_def		character drawn for those the font does not have
+ *   10	cmap_size		uint16_t, entries in the code point table
+ *   12	width table		glyph_end-glyph_beg+1 bytes, only if fixed_width is 0
+ *   	code point table	cmap_size entries of uint16_t code, uint8_t character,
+ *   				sorted by code
+ *   	glyph table		store_width*glyph_height bytes per character,
+ *   				from glyph_beg to glyph_end
+ */
+
+#ifndef OLED_FONT_SLOTS
+#define OLED_FONT_SLOTS		8	/* glyphs kept in RAM */
+#endif
+#ifndef OLED_FONT_GLYPH_BYTES
+#define OLED_FONT_GLYPH_BYTES	54	/* largest glyph, store_width*glyph_height */
+#endif
+#ifndef OLED_FONT_READ_AHEAD
+#define OLED_FONT_READ_AHEAD	64	/* bytes read at a time for small reads */
+#endif
+
+/*
+ * Storage holding font images: SPI NOR flash, a file on an SD card,
+ * a file on a host build, and so on.
+ */
+class oledFontSource {
+public:
+    /**
+     * Read bytes from the storage.
+     * @param addr - address of the first byte
+     * @param buf - buffer for the bytes
+     * @param len - number of bytes to read
+     * @returns true if all the bytes were read
+     */
+    virtual bool read(uint32_t addr, uint8_t *buf, uint16_t len) = 0;
+};
+
+class oledFont {
+public:
+    bool begin(oledFontSource *source, uint32_t base=0);
+    uint8_t height(void);
+    uint8_t stride(void);
+    uint8_t advance(uint16_t ch);
+    const uint8_t *glyph(uint16_t ch, uint8_t *width);
+    uint8_t prefetch(const char *str, uint8_t len);
+    uint32_t getHits(void);
+    uint32_t getMisses(void);
+    uint32_t getReads(void);
+
+private:
+    oledFontSource *_source;
+    uint32_t _base;		// address of the image in the storage
+    uint32_t _size;		// bytes in the image
+    uint32_t _cmap;		// offset of the code point table
+    uint32_t _glyphs;		// offset of the glyph table
+    uint16_t _cmapSize;
+    uint8_t _storeWidth;
+    uint8_t _height;
+    uint8_t _fixedWidth;
+    uint8_t _beg;
+    uint8_t _end;
+    uint8_t _def;
+
+    struct {
+	uint16_t index;		// glyph table index, 0xFFFF if unused
+	uint8_t width;
+	uint16_t used;		// _clock when last drawn
+	uint8_t data[OLED_FONT_GLYPH_BYTES];
+    } _slot[OLED_FONT_SLOTS];
+    uint16_t _clock;
+
+    uint8_t _ahead[OLED_FONT_READ_AHEAD];
+    uint32_t _aheadAddr;	// image offset of _ahead[0]
+    uint16_t _aheadLen;		// bytes in _ahead
+
+    uint32_t _hits;
+    uint32_t _misses;
+    uint32_t _reads;
+
+    bool fetch(uint32_t addr, uint8_t *buf, uint16_t len);
+    uint8_t index(uint16_t ch);
+    uint8_t find(uint8_t index);
+    uint8_t load(uint8_t index);
+    uint8_t claim(uint8_t index);
+    void loadWidth(uint8_t slot);
+    void loadRows(uint8_t slot);
+};
+
+#endif
@@ -0,0 +1,163 @@
+/*-
+ * Copyright (c) 2014 Darran Hunt (darran [at] hunt dot net dot nz)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file oledTxQueue interrupt driven SPI transmit queue
+ */
+
+#include <oled256.h>
+
+#ifdef OLED_ASYNC
+
+oledTxQueue *oledTxQueue::active = NULL;
+
+/**
+ * Prepare the queue and claim the SPI transfer complete interrupt.
+ * @param port_cs - chip select port, released once a stream has been sent
+ * @param pin_cs - chip select pin mask
+ */
+void oledTxQueue::begin(uint8_t volatile *port_cs, uint8_t pin_cs)
+{
+    this->port_cs = port_cs;
+    this->pin_cs = pin_cs;
+    head = 0;
+    fill = 0;
+    tail = 0;
+    pos = 0;
+    queued = 0;
+    release = false;
+    callback = NULL;
+    active = this;
+}
+
+/**
+ * Add a byte to the queue. Blocks only if every staging buffer
+ * is waiting to be sent.
+ * @param data - byte to send
+ */
+void oledTxQueue::put(uint8_t data)
+{
+    if (fill == 0) {
+	// wait for the isr to hand back the head buffer
+	while (queued == OLED_TXBUF_COUNT);
+    }
+    buf[head].data[fill++] = data;
+    if (fill == OLED_TXBUF_SIZE) {
+	commit(false);
+    }
+}
+
+/**
+ * Hand the buffer being filled to the isr, starting transmission if
+ * the SPI is idle.
+ * @param release - raise CS once everything queued has been sent
+ */
+void oledTxQueue::commit(bool release)
+{
+    uint8_t sreg = SREG;
+    cli();
+    if (fill != 0) {
+	buf[head].len = fill;
+	head = (head + 1) % OLED_TXBUF_COUNT;
+	fill = 0;
+	if (queued++ == 0) {
+	    // idle, kick off the first byte
+	    pos = 0;
+	    SPCR |= _BV(SPIE);
+	    SPDR = buf[tail].data[0];
+	}
+    }
+    if (release) {
+	if (queued == 0) {
+	    *port_cs |= pin_cs;
+	} else {
+	    this->release = true;
+	}
+    }
+    SREG = sreg;
+}
+
+/**
+ * Wait until all queued data has been sent.
+ */
+void oledTxQueue::flush(void)
+{
+    while (queued != 0);
+}
+
+/**
+ * Check for queued data.
+ * @returns true if data is waiting to be sent or being sent
+ */
+bool oledTxQueue::isBusy(void)
+{
+    return (queued != 0) || (fill != 0);
+}
+
+/**
+ * Set a function to call when the queue has drained.
+ * The function is called from interrupt context.
+ * @param callback - function to call, or NULL for none
+ */
+void oledTxQueue::setCallback(void (*callback)(void))
+{
+    this->callback = callback;
+}
+
+/**
+ * SPI transfer complete handler. Sends the next queued byte.
+ */
+void oledTxQueue::isr(void)
+{
+    if (++pos < buf[tail].len) {
+	SPDR = buf[tail].data[pos];
+	return;
+    }
+
+    // finished a buffer
+    pos = 0;
+    tail = (tail + 1) % OLED_TXBUF_COUNT;
+    if (--queued != 0) {
+	SPDR = buf[tail].data[0];
+	return;
+    }
+
+    // drained
+    SPCR &= ~_BV(SPIE);
+    if (release) {
+	release = false;
+	*port_cs |= pin_cs;
+    }
+    if (callback) {
+	callback();
+    }
+}
+
+ISR(SPI_STC_vect)
+{
+    oledTxQueue::active->isr();
+}
+
+#endif
@@ -0,0 +1,80 @@
+/*-
+ * Copyright (c) 2014 Darran Hunt (darran [at] hunt dot net dot nz)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+ * AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef OLEDTXQUEUE_H_
+#define OLEDTXQUEUE_H_
+
+#include "Arduino.h"
+
+/*
+ * Interrupt driven SPI transmit queue.
+ *
+ * Pixel data is copied into a ring of small staging buffers. Full
+ * buffers are shifted out by the SPI transfer complete interrupt while
+ * the caller carries on rendering into the next buffer.
+ *
+ * Only one queue (and therefore one display) can own the SPI interrupt.
+ * Each byte costs an interrupt, so this helps most when the SPI clock is
+ * slow relative to the CPU; at SPI_CLOCK_DIV2 the polled path is faster.
+ */
+
+#ifndef OLED_TXBUF_SIZE
+#define OLED_TXBUF_SIZE		32	/* bytes per staging buffer */
+#endif
+#ifndef OLED_TXBUF_COUNT
+#define OLED_TXBUF_COUNT	2	/* number of staging buffers */
+#endif
+
+class oledTxQueue {
+public:
+    void begin(uint8_t volatile *port_cs, uint8_t pin_cs);
+    void put(uint8_t data);
+    void commit(bool release);
+    void flush(void);
+    bool isBusy(void);
+    void setCallback(void (*callback)(void));
+    void isr(void);
+
+    static oledTxQueue *active;
+
+private:
+    struct {
+	uint8_t data[OLED_TXBUF_SIZE];
+	uint8_t len;
+    } buf[OLED_TXBUF_COUNT];
+
+    uint8_t head;		// buffer being filled by put()
+    uint8_t fill;		// bytes in the head buffer
+    volatile uint8_t tail;	// buffer being sent by the isr
+    volatile uint8_t pos;	// byte in the tail buffer being sent
+    volatile uint8_t queued;	// buffers waiting for or in transmission
+    volatile bool release;	// raise CS once the queue drains
+
+    uint8_t volatile *port_cs;
+    uint8_t pin_cs;
+    void (*callback)(void);
+};
+
+#endif